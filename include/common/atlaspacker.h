@@ -0,0 +1,53 @@
+#pragma once
+
+#include "common/lmath.h"
+
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Skyline bottom-left rectangle packer
+    ** Only deals in integer rectangles, so it has no
+    ** ties to any graphics backend
+    */
+    class AtlasPacker
+    {
+        public:
+            AtlasPacker(int width, int height);
+
+            /* Find room for a @width x @height rectangle, false when the page is full */
+            bool Pack(int width, int height, Rect & out);
+
+            void Reset();
+
+            /* Grow the page, everything packed so far stays where it is */
+            void Resize(int width, int height);
+
+            int GetWidth() const;
+
+            int GetHeight() const;
+
+            /* Fraction of the page covered by packed rectangles */
+            float GetOccupancy() const;
+
+        private:
+            struct Level
+            {
+                int x;
+                int y;
+                int width;
+            };
+
+            bool Fits(size_t index, int width, int height, int & y) const;
+
+            void AddLevel(size_t index, const Rect & rect);
+
+            std::vector<Level> skyline;
+
+            int width;
+            int height;
+
+            size_t usedArea;
+    };
+}
@@ -4,6 +4,8 @@
     #include <3ds/types.h>
 #elif defined (__SWITCH__)
     #include <switch/types.h>
+#elif defined (__HEADLESS__)
+    #include "headless.h"
 #endif
 
 namespace love
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace love
+{
+    /*
+    ** Fixed-size lock-free ring (Vyukov's bounded queue)
+    ** Every cell carries a sequence number telling whether it's
+    ** free for the push or filled for the pop at a given position,
+    ** so neither side ever takes a lock
+    ** With @multiple false there is one producer and one consumer,
+    ** and the positions are advanced without compare-and-swap
+    */
+    template <typename T>
+    class BoundedQueue
+    {
+        public:
+            /* @capacity is rounded up to a power of two */
+            BoundedQueue(size_t capacity, bool multiple) : multiple(multiple)
+            {
+                size_t size = 1;
+
+                while (size < capacity)
+                    size <<= 1;
+
+                this->mask  = size - 1;
+                this->cells = std::make_unique<Cell[]>(size);
+
+                for (size_t index = 0; index < size; index++)
+                    this->cells[index].sequence.store(index, std::memory_order_relaxed);
+            }
+
+            /* Add @value, false when full; @ticket is its position, counting from 0 */
+            bool TryPush(const T & value, uint64_t & ticket)
+            {
+                uint64_t position = this->pushPosition.load(std::memory_order_relaxed);
+                Cell * cell = nullptr;
+
+                while (true)
+                {
+                    cell = &this->cells[position & this->mask];
+
+                    uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+                    int64_t difference = (int64_t)(sequence - position);
+
+                    if (difference == 0)
+                    {
+                        if (!this->multiple)
+                        {
+                            this->pushPosition.store(position + 1, std::memory_order_relaxed);
+                            break;
+                        }
+
+                        if (this->pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (difference < 0)
+                        return false;
+                    else
+                        position = this->pushPosition.load(std::memory_order_relaxed);
+                }
+
+                cell->value = value;
+                cell->sequence.store(position + 1, std::memory_order_release);
+
+                ticket = position;
+
+                return true;
+            }
+
+            /* Take the oldest value into @out, false when empty */
+            bool TryPop(T & out)
+            {
+                uint64_t position = this->popPosition.load(std::memory_order_relaxed);
+                Cell * cell = nullptr;
+
+                while (true)
+                {
+                    cell = &this->cells[position & this->mask];
+
+                    uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+                    int64_t difference = (int64_t)(sequence - (position + 1));
+
+                    if (difference == 0)
+                    {
+                        if (!this->multiple)
+                        {
+                            this->popPosition.store(position + 1, std::memory_order_relaxed);
+                            break;
+                        }
+
+                        if (this->popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (difference < 0)
+                        return false;
+                    else
+                        position = this->popPosition.load(std::memory_order_relaxed);
+                }
+
+                out = std::move(cell->value);
+
+                /* Don't hold on to whatever the value references */
+                cell->value = T();
+                cell->sequence.store(position + this->mask + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            /* Only exact while nothing is pushing or popping */
+            size_t GetSize() const
+            {
+                uint64_t pushed = this->pushPosition.load(std::memory_order_acquire);
+                uint64_t popped = this->popPosition.load(std::memory_order_acquire);
+
+                return (pushed > popped) ? (size_t)(pushed - popped) : 0;
+            }
+
+            size_t GetCapacity() const
+            {
+                return this->mask + 1;
+            }
+
+            bool IsMultiple() const
+            {
+                return this->multiple;
+            }
+
+        private:
+            /* Separate cache lines, so producers and consumers don't fight over them */
+            static constexpr size_t CACHE_LINE = 64;
+
+            struct Cell
+            {
+                std::atomic<uint64_t> sequence;
+                T value;
+            };
+
+            std::unique_ptr<Cell[]> cells;
+            size_t mask;
+
+            bool multiple;
+
+            alignas(CACHE_LINE) std::atomic<uint64_t> pushPosition { 0 };
+            alignas(CACHE_LINE) std::atomic<uint64_t> popPosition { 0 };
+    };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace love
+{
+    /*
+    ** Signed distance fields from coverage bitmaps
+    ** No platform code in here, so the output can be
+    ** checked against reference bitmaps on any host
+    */
+    namespace DistanceField
+    {
+        /* Pixels added on every side, for a given @spread */
+        inline int GetPadded(int size, int spread)
+        {
+            return size + spread * 2;
+        }
+
+        /*
+        ** Turn @width by @height coverage values, @pitch bytes per row,
+        ** into a padded field in @out, GetPadded(@width) bytes per row
+        ** 128 is on the outline, 255 and 0 are @spread pixels inside and outside,
+        ** and @spread has to be at least 1
+        */
+        void Generate(const uint8_t * coverage, size_t pitch, int width, int height,
+                      int spread, uint8_t * out);
+    }
+}
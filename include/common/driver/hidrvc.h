@@ -2,12 +2,14 @@
 
 #if defined (_3DS)
     #include <3ds.h>
-#else
+#elif defined (__SWITCH__)
     #include <switch.h>
+#elif defined (__HEADLESS__)
+    #include "headless.h"
 #endif
 
-#include <list>
 #include <array>
+#include <vector>
 
 #include "modules/thread/types/mutex.h"
 #include "modules/thread/types/lock.h"
@@ -103,8 +105,61 @@ namespace love::common::driver
                 TYPE_QUIT
             };
 
+            /*
+            ** Events waiting for Poll, read from the front
+            ** Like the event module's queue, draining it starts over
+            ** at the front without giving up the storage, so steady
+            ** input never allocates; same calls as the std::list it was
+            */
+            class EventQueue
+            {
+                public:
+                    bool empty() const
+                    {
+                        return this->head == this->items.size();
+                    }
+
+                    LOVE_Event & front()
+                    {
+                        return this->items[this->head];
+                    }
+
+                    LOVE_Event & emplace_back()
+                    {
+                        return this->items.emplace_back();
+                    }
+
+                    void pop_front()
+                    {
+                        this->head++;
+                        this->Rewind();
+                    }
+
+                    void pop_back()
+                    {
+                        this->items.pop_back();
+                        this->Rewind();
+                    }
+
+                private:
+                    void Rewind()
+                    {
+                        if (this->head != this->items.size())
+                            return;
+
+                        this->items.clear();
+                        this->head = 0;
+                    }
+
+                    std::vector<LOVE_Event> items;
+                    size_t head = 0;
+            };
+
             Hidrv();
 
+            virtual ~Hidrv()
+            {}
+
             uint64_t GetButtonPressed();
 
             uint64_t GetButtonReleased();
@@ -125,7 +180,7 @@ namespace love::common::driver
 
         protected:
             bool hysteresis;
-            std::list<LOVE_Event> events;
+            EventQueue events;
 
             struct ButtonState
             {
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Bump allocator for data that only lives until the end of the frame
+    ** Memory is kept across Reset, so once the busiest frame
+    ** has been seen, allocating from it never touches the heap
+    */
+    class FrameArena
+    {
+        public:
+            static constexpr size_t BLOCK_SIZE = 0x40000;
+
+            FrameArena();
+
+            template <typename T>
+            T * Allocate(size_t count)
+            {
+                static_assert(std::is_trivially_destructible_v<T>, "Arena memory is never destructed");
+
+                return static_cast<T *>(this->Allocate(count * sizeof(T), alignof(T)));
+            }
+
+            void * Allocate(size_t size, size_t alignment);
+
+            /* Release everything handed out since the last Reset */
+            void Reset();
+
+            /* Bytes handed out since the last Reset */
+            size_t GetUsed() const;
+
+            size_t GetCapacity() const;
+
+        private:
+            struct Block
+            {
+                std::unique_ptr<uint8_t[]> data;
+                size_t size;
+            };
+
+            std::vector<Block> blocks;
+
+            size_t current;
+            size_t offset;
+            size_t used;
+    };
+}
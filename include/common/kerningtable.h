@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Kerning pairs, looked up once and kept
+    ** Pairs of codepoints below DENSE_GLYPHS go in a flat table,
+    ** NaN until looked up, so the usual text never hashes;
+    ** the rest fall back to a hash map
+    */
+    class KerningTable
+    {
+        public:
+            static constexpr uint32_t DENSE_GLYPHS = 256;
+
+            /* Kerning between @left and @right, calling @find(left, right) on a miss */
+            template <typename Find>
+            float Get(uint32_t left, uint32_t right, Find && find)
+            {
+                if (left < DENSE_GLYPHS && right < DENSE_GLYPHS)
+                {
+                    if (this->dense.empty())
+                        this->dense.assign(DENSE_GLYPHS * DENSE_GLYPHS, NAN);
+
+                    float & kern = this->dense[left * DENSE_GLYPHS + right];
+
+                    if (std::isnan(kern))
+                        kern = find(left, right);
+
+                    return kern;
+                }
+
+                uint64_t packed = ((uint64_t)left << 32) | (uint64_t)right;
+                const auto iterator = this->sparse.find(packed);
+
+                if (iterator != this->sparse.end())
+                    return iterator->second;
+
+                float kern = find(left, right);
+                this->sparse[packed] = kern;
+
+                return kern;
+            }
+
+            void Clear()
+            {
+                this->dense.clear();
+                this->sparse.clear();
+            }
+
+        private:
+            std::vector<float> dense;
+            std::unordered_map<uint64_t, float> sparse;
+    };
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace love
+{
+    /*
+    ** Bounded map that drops the least recently used entries
+    ** Entries live in a list ordered by use, most recent first,
+    ** with a hash map pointing into it
+    ** Each entry has a cost, 1 unless given, and the capacity
+    ** bounds their sum; no platform code in here, so it's
+    ** usable for any kind of cached resource
+    */
+    template <typename Key, typename Value, typename Hash = std::hash<Key>>
+    class LRUCache
+    {
+        public:
+            LRUCache(size_t capacity) : capacity(capacity),
+                                        cost(0),
+                                        hits(0),
+                                        misses(0)
+            {}
+
+            /* Look up @key and mark it as used, nullptr when it isn't cached */
+            Value * Find(const Key & key)
+            {
+                auto found = this->index.find(key);
+
+                if (found == this->index.end())
+                {
+                    this->misses++;
+                    return nullptr;
+                }
+
+                this->hits++;
+                this->entries.splice(this->entries.begin(), this->entries, found->second);
+
+                return &found->second->value;
+            }
+
+            /* Whether an entry costing @cost can be cached at all */
+            bool Fits(size_t cost) const
+            {
+                return cost <= this->capacity;
+            }
+
+            /*
+            ** Add or replace @key, evicting the oldest entries
+            ** until @cost fits; see Fits
+            */
+            Value & Insert(const Key & key, Value && value, size_t cost = 1)
+            {
+                auto found = this->index.find(key);
+
+                if (found != this->index.end())
+                    this->Erase(found->second);
+
+                while (!this->entries.empty() && this->cost + cost > this->capacity)
+                    this->Evict();
+
+                this->entries.push_front({ key, std::move(value), cost });
+                this->index.emplace(key, this->entries.begin());
+
+                this->cost += cost;
+
+                return this->entries.front().value;
+            }
+
+            /* Drop the least recently used entry */
+            void Evict()
+            {
+                this->Erase(std::prev(this->entries.end()));
+            }
+
+            void Clear()
+            {
+                this->index.clear();
+                this->entries.clear();
+
+                this->cost = 0;
+            }
+
+            bool IsEmpty() const
+            {
+                return this->entries.empty();
+            }
+
+            size_t GetSize() const
+            {
+                return this->entries.size();
+            }
+
+            size_t GetCapacity() const
+            {
+                return this->capacity;
+            }
+
+            size_t GetCost() const
+            {
+                return this->cost;
+            }
+
+            size_t GetHits() const
+            {
+                return this->hits;
+            }
+
+            size_t GetMisses() const
+            {
+                return this->misses;
+            }
+
+        private:
+            struct Entry
+            {
+                Key key;
+                Value value;
+                size_t cost;
+            };
+
+            using Iterator = typename std::list<Entry>::iterator;
+
+            void Erase(Iterator entry)
+            {
+                this->cost -= entry->cost;
+
+                this->index.erase(entry->key);
+                this->entries.erase(entry);
+            }
+
+            std::list<Entry> entries;
+            std::unordered_map<Key, Iterator, Hash> index;
+
+            size_t capacity;
+            size_t cost;
+
+            size_t hits;
+            size_t misses;
+    };
+}
@@ -23,6 +23,7 @@ extern "C" {
 #include <algorithm>
 #include <string.h>
 #include <memory>
+#include <vector>
 
 namespace love
 {
@@ -3,7 +3,7 @@
 #if defined (_3DS)
     #include <citro2d.h>
     typedef C3D_Mtx Elements;
-#elif defined (__SWITCH__)
+#elif defined (__SWITCH__) || defined (__HEADLESS__)
     typedef float Elements[16];
 #endif
 
@@ -88,7 +88,7 @@ namespace love
             static void Multiply(const Matrix4 & a, const Matrix4 & b, Elements & c);
     };
 
-    #if defined (__SWITCH__)
+    #if defined (__SWITCH__) || defined (__HEADLESS__)
         template <typename Vdst, typename Vsrc>
         void Matrix4::TransformXY(Vdst * dst, const Vsrc * src, int size) const
         {
@@ -2,6 +2,7 @@
 
 #include "common/variant.h"
 
+#include <array>
 #include <vector>
 
 namespace love
@@ -9,6 +10,9 @@ namespace love
     class Message : public Object
     {
         public:
+            /* Arguments past this many go in a vector, only messages from Lua get there */
+            static constexpr size_t MAX_INLINE_ARGS = 6;
+
             Message(const std::string & name, const std::vector<Variant> & args = {});
 
             virtual ~Message();
@@ -17,8 +21,46 @@ namespace love
 
             int ToLua(lua_State * L);
 
+            /* Start over as @name with no arguments, keeping the storage */
+            void Reset(const char * name);
+
+            void AddArg(const Variant & arg);
+
+            /* Replace an argument that was already added */
+            void SetArg(size_t index, const Variant & arg);
+
+            size_t GetArgCount() const;
+
+        private:
+            std::string name;
+
+            std::array<Variant, MAX_INLINE_ARGS> inlineArgs;
+            std::vector<Variant> extraArgs;
+
+            size_t argCount;
+    };
+
+    /*
+    ** Messages made up front for the event path, handed out
+    ** again once nothing but the pool holds on to them
+    */
+    class MessagePool
+    {
+        public:
+            static constexpr size_t CAPACITY = 64;
+
+            MessagePool();
+
+            ~MessagePool();
+
+            /*
+            ** A free pooled Message named @name, or a new one when they're all in use
+            ** Either way the caller owns a reference, like with new
+            */
+            Message * Acquire(const char * name);
+
         private:
-            const std::string name;
-            const std::vector<Variant> args;
+            std::array<Message *, CAPACITY> messages;
+            size_t next;
     };
 }
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/*
+** Stream draw batching
+** Keeps a single draw pending for as long as new vertices share its
+** state and follow on directly from the ones already pending.
+** Anything else closes the pending draw and hands it to @flush.
+**
+** Nothing in here knows about deko3d, so the merging rules can be
+** exercised off-device with any comparable @State type.
+*/
+template <typename State>
+class StreamBatch
+{
+    public:
+        struct Draw
+        {
+            State state;
+
+            uint32_t firstVertex;
+            uint32_t vertexCount;
+        };
+
+        typedef std::function<void(const Draw & draw)> FlushFunction;
+
+        StreamBatch(FlushFunction flush) : flush(flush),
+                                           pending{},
+                                           flushCount(0)
+        {}
+
+        /*
+        ** Queue @count vertices starting at @firstVertex
+        ** Merges into the pending draw when possible
+        ** returns true if the vertices were merged
+        */
+        bool Add(const State & state, uint32_t firstVertex, uint32_t count)
+        {
+            if (count == 0)
+                return false;
+
+            if (this->IsPending())
+            {
+                bool contiguous = (this->pending.firstVertex + this->pending.vertexCount) == firstVertex;
+
+                if (contiguous && this->pending.state == state)
+                {
+                    this->pending.vertexCount += count;
+                    return true;
+                }
+
+                this->Flush();
+            }
+
+            this->pending = { state, firstVertex, count };
+
+            return false;
+        }
+
+        /* Emit the pending draw, if there is one */
+        void Flush()
+        {
+            if (!this->IsPending())
+                return;
+
+            Draw draw = this->pending;
+            this->pending.vertexCount = 0;
+
+            this->flush(draw);
+            this->flushCount++;
+        }
+
+        /* Drop the pending draw without emitting it */
+        void Discard()
+        {
+            this->pending.vertexCount = 0;
+        }
+
+        bool IsPending() const
+        {
+            return this->pending.vertexCount > 0;
+        }
+
+        const Draw & GetPending() const
+        {
+            return this->pending;
+        }
+
+        size_t GetFlushCount() const
+        {
+            return this->flushCount;
+        }
+
+        void ResetFlushCount()
+        {
+            this->flushCount = 0;
+        }
+
+    private:
+        FlushFunction flush;
+        Draw pending;
+
+        size_t flushCount;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "common/vector.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** Builds shape outlines out of cached unit tables
+    ** Tables are keyed by segment count, so drawing the same
+    ** kind of shape again only costs a scale and an offset per point
+    */
+    class Tessellator
+    {
+        public:
+            /* Space for @count points, reused by the next call */
+            Vector2 * GetScratch(size_t count);
+
+            /*
+            ** Write @points + 1 points around an ellipse into @out,
+            ** the last one closing the loop
+            */
+            void Ellipse(Vector2 * out, float x, float y, float a, float b, int points);
+
+            /* Write @points + 1 points along an arc from @angle1 to @angle2 into @out */
+            void Arc(Vector2 * out, float x, float y, float radius, float angle1, float angle2, int points);
+
+            /*
+            ** Write a closed rounded rectangle outline into @out
+            ** @points is per corner, see GetRoundedRectangleSize
+            */
+            void RoundedRectangle(Vector2 * out, float x, float y, float width, float height,
+                                  float rx, float ry, int points);
+
+            static int GetRoundedRectangleSize(int points);
+
+        private:
+            using TableMap = std::unordered_map<int, std::vector<Vector2>>;
+
+            /* Tables beyond this are dropped, detail levels are few in practice */
+            static constexpr size_t MAX_TABLES = 64;
+
+            /* cos and sin of @step * i for i in [0, @count) */
+            const Vector2 * GetTable(TableMap & tables, int key, float step, int count);
+
+            TableMap circles;
+            TableMap corners;
+
+            std::vector<Vector2> scratch;
+    };
+}
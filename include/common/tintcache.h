@@ -0,0 +1,94 @@
+#pragma once
+
+#include "common/vertex.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** A copy of some vertices with a draw color multiplied in,
+    ** for renderers whose shaders have no tint of their own
+    ** Only vertices that changed since the last Get are tinted
+    ** again, or all of them when the color did
+    */
+    class TintCache
+    {
+        public:
+            TintCache() : color(1.0f, 1.0f, 1.0f, 1.0f),
+                          dirtyStart(NONE),
+                          dirtyEnd(0),
+                          tintCount(0)
+            {}
+
+            /* The source vertices in [@first, @first + @count) changed */
+            void Invalidate(size_t first, size_t count)
+            {
+                this->dirtyStart = std::min(this->dirtyStart, first);
+                this->dirtyEnd   = std::max(this->dirtyEnd, first + count);
+            }
+
+            /*
+            ** @source with @color applied, up to @end at least
+            ** Valid until @source changes or the next call
+            */
+            const vertex::Vertex * Get(const std::vector<vertex::Vertex> & source, size_t end,
+                                       const Colorf & color)
+            {
+                if (this->tinted.size() != source.size())
+                {
+                    this->tinted.resize(source.size());
+                    this->Invalidate(0, source.size());
+                }
+
+                if (color != this->color)
+                {
+                    this->color = color;
+                    this->Invalidate(0, source.size());
+                }
+
+                end = std::min({ end, this->dirtyEnd, source.size() });
+
+                for (size_t index = this->dirtyStart; index < end; index++)
+                {
+                    this->tinted[index] = source[index];
+                    vertex::Tint(this->tinted[index], color);
+                }
+
+                if (end > this->dirtyStart)
+                {
+                    this->tintCount += end - this->dirtyStart;
+                    this->dirtyStart = end;
+                }
+
+                if (this->dirtyStart >= this->dirtyEnd)
+                {
+                    this->dirtyStart = NONE;
+                    this->dirtyEnd   = 0;
+                }
+
+                return this->tinted.data();
+            }
+
+            /* Vertices tinted so far */
+            size_t GetTintCount() const
+            {
+                return this->tintCount;
+            }
+
+        private:
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+            std::vector<vertex::Vertex> tinted;
+            Colorf color;
+
+            /* What changed since it was last tinted, empty when start > end */
+            size_t dirtyStart;
+            size_t dirtyEnd;
+
+            size_t tintCount;
+    };
+}
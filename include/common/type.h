@@ -7,6 +7,8 @@
     #include <3ds.h>
 #elif defined (__SWITCH__)
     #include <switch.h>
+#elif defined (__HEADLESS__)
+    #include "headless.h"
 #endif
 
 namespace love
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "common/exception.h"
+
+#include "utf8/utf8.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined (__ARM_NEON)
+    #include <arm_neon.h>
+#elif defined (__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace love
+{
+    /*
+    ** UTF-8 decoding with a fast path for ASCII
+    ** Text is checked 16 bytes at a time and plain ASCII blocks
+    ** are widened as they are; anything else goes through the
+    ** utf8 library, so bad sequences are still reported
+    */
+    namespace UTF8
+    {
+        static constexpr size_t BLOCK_SIZE = 16;
+
+        /* Whether the BLOCK_SIZE bytes at @text are all ASCII */
+        inline bool IsASCIIBlock(const char * text)
+        {
+            #if defined (__ARM_NEON)
+                return vmaxvq_u8(vld1q_u8((const uint8_t *)text)) < 0x80;
+            #elif defined (__SSE2__)
+                return _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)text)) == 0;
+            #else
+                uint64_t words[2];
+                std::memcpy(words, text, sizeof(words));
+
+                return ((words[0] | words[1]) & 0x8080808080808080ULL) == 0;
+            #endif
+        }
+
+        /*
+        ** Decode one multi-byte sequence at @current, moving past it
+        ** Well-formed two and three byte sequences, which cover
+        ** Latin, Greek, Cyrillic and CJK, are decoded here;
+        ** the rest go to the utf8 library to be checked
+        */
+        inline uint32_t Next(const char *& current, const char * end)
+        {
+            const uint8_t * bytes = (const uint8_t *)current;
+            size_t remaining      = end - current;
+
+            if (bytes[0] >= 0xC2 && bytes[0] <= 0xDF && remaining >= 2 && (bytes[1] & 0xC0) == 0x80)
+            {
+                current += 2;
+                return ((bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F);
+            }
+
+            if ((bytes[0] & 0xF0) == 0xE0 && remaining >= 3 && (bytes[1] & 0xC0) == 0x80 &&
+                (bytes[2] & 0xC0) == 0x80)
+            {
+                uint32_t codepoint = ((bytes[0] & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6) | (bytes[2] & 0x3F);
+
+                /* Overlong forms and surrogate halves are errors */
+                if (codepoint >= 0x800 && (codepoint < 0xD800 || codepoint > 0xDFFF))
+                {
+                    current += 3;
+                    return codepoint;
+                }
+            }
+
+            try
+            {
+                return ::utf8::next(current, end);
+            }
+            catch (::utf8::exception & e)
+            {
+                throw love::Exception("UTF-8 decoding error: %s", e.what());
+            }
+        }
+
+        /* Call @func with each codepoint in @text */
+        template <typename Func>
+        void ForEach(const char * text, size_t length, Func && func)
+        {
+            const char * current = text;
+            const char * end     = text + length;
+
+            while (current != end)
+            {
+                while ((size_t)(end - current) >= BLOCK_SIZE && IsASCIIBlock(current))
+                {
+                    for (size_t index = 0; index < BLOCK_SIZE; index++)
+                        func((uint32_t)(uint8_t)current[index]);
+
+                    current += BLOCK_SIZE;
+                }
+
+                /* The block check failed, so don't repeat it before passing this block */
+                const char * blockEnd = current + std::min(BLOCK_SIZE, (size_t)(end - current));
+
+                while (current < blockEnd)
+                {
+                    if ((uint8_t)*current < 0x80)
+                        func((uint32_t)(uint8_t)*current++);
+                    else
+                        func(UTF8::Next(current, end));
+                }
+            }
+        }
+
+        /* Append the codepoints in @text to @out */
+        inline void Decode(const char * text, size_t length, std::vector<uint32_t> & out)
+        {
+            /* There are never more codepoints than bytes */
+            size_t start = out.size();
+            out.resize(start + length);
+
+            uint32_t * dest = out.data() + start;
+
+            const char * current = text;
+            const char * end     = text + length;
+
+            try
+            {
+                while (current != end)
+                {
+                    while ((size_t)(end - current) >= BLOCK_SIZE && IsASCIIBlock(current))
+                    {
+                        for (size_t index = 0; index < BLOCK_SIZE; index++)
+                            dest[index] = (uint8_t)current[index];
+
+                        dest    += BLOCK_SIZE;
+                        current += BLOCK_SIZE;
+                    }
+
+                    const char * blockEnd = current + std::min(BLOCK_SIZE, (size_t)(end - current));
+
+                    while (current < blockEnd)
+                    {
+                        if ((uint8_t)*current < 0x80)
+                            *dest++ = (uint8_t)*current++;
+                        else
+                            *dest++ = UTF8::Next(current, end);
+                    }
+                }
+            }
+            catch (love::Exception &)
+            {
+                /* Keep what was decoded, like the utf8 iterators would */
+                out.resize(dest - out.data());
+                throw;
+            }
+
+            out.resize(dest - out.data());
+        }
+    }
+}
@@ -7,7 +7,6 @@
 
 #include <variant>
 #include <vector>
-#include <set>
 
 namespace love
 {
@@ -42,21 +41,26 @@ namespace love
             uint8_t length;
         };
 
+        /*
+        ** A whole table, nested ones included, flattened into one buffer
+        ** See variant.cpp for the encoding; objects in it stay retained
+        ** for as long as the buffer lives
+        */
         class SharedTable : public Object
         {
             public:
-                SharedTable(std::vector<std::pair<Variant, Variant>> * table) : table(table)
-                {}
+                SharedTable(std::vector<uint8_t> && data, bool hasObjects);
 
-                virtual ~SharedTable() {
-                    delete this->table;
-                }
+                virtual ~SharedTable();
 
-                std::vector<std::pair<Variant, Variant>> * table;
+                std::vector<uint8_t> data;
+                bool hasObjects;
         };
 
+        Variant(SharedTable * table) : variant(table) {}
+
         private:
-            std::variant<std::monostate, bool, float, Variant::SharedString *, Variant::SmallString, Variant::SharedTable *, void *, Proxy, Nil> variant;
+            std::variant<std::monostate, bool, double, Variant::SharedString *, Variant::SmallString, Variant::SharedTable *, void *, Proxy, Nil> variant;
 
         public:
 
@@ -79,14 +83,14 @@ namespace love
 
             Variant(bool v) : variant(v) {}
 
-            Variant(float v) : variant(v) {}
+            Variant(float v) : variant((double)v) {}
+
+            Variant(double v) : variant(v) {}
 
             Variant(const std::string & v);
 
             Variant(const char * v, size_t length);
 
-            Variant(std::vector<std::pair<Variant, Variant>> * table);
-
             Variant(void * v) : variant(v) {}
 
             Variant(love::Type * type, Object * object);
@@ -97,7 +101,10 @@ namespace love
 
             Variant & operator= (const Variant & v);
 
-            Variant(Variant && other);
+            /* Moving leaves @other Nil, so only one side releases the payload */
+            Variant(Variant && other) noexcept;
+
+            Variant & operator= (Variant && other) noexcept;
 
             ~Variant();
 
@@ -119,7 +126,7 @@ namespace love
 
             std::string GetTypeString() const;
 
-            static Variant FromLua(lua_State * L, int n, std::set<const void *> * tableSet = nullptr);
+            static Variant FromLua(lua_State * L, int n);
 
             void ToLua(lua_State * L) const;
     };
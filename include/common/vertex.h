@@ -0,0 +1,71 @@
+#pragma once
+
+#include "common/vector.h"
+#include "common/colors.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace vertex
+{
+    /*
+    ** 2D only: z is always 0 and colors end up 8-bit anyway,
+    ** so a vertex packs into 16 bytes instead of 32
+    */
+    struct Vertex
+    {
+        float position[2];
+        uint8_t color[4];
+        uint16_t texcoord[2];
+    };
+
+    static_assert(sizeof(Vertex) == 16);
+
+    struct GlyphVertex
+    {
+        float    x, y;
+        uint16_t s, t;
+
+        Colorf color;
+    };
+
+    inline uint8_t normto8t(float in)
+    {
+        return uint8_t(std::clamp(in, 0.0f, 1.0f) * 0xFF + 0.5f);
+    }
+
+    inline void PackColor(const Colorf & in, uint8_t out[4])
+    {
+        out[0] = normto8t(in.r);
+        out[1] = normto8t(in.g);
+        out[2] = normto8t(in.b);
+        out[3] = normto8t(in.a);
+    }
+
+    inline Colorf UnpackColor(const uint8_t in[4])
+    {
+        return Colorf(in[0] / 255.0f, in[1] / 255.0f, in[2] / 255.0f, in[3] / 255.0f);
+    }
+
+    /* Multiply the vertex color by @color */
+    inline void Tint(Vertex & vertex, const Colorf & color)
+    {
+        Colorf tinted = UnpackColor(vertex.color);
+        tinted *= color;
+
+        PackColor(tinted, vertex.color);
+    }
+
+    /*
+    ** The generators write @count vertices to @out, which is
+    ** usually frame arena memory or a resident vertex array
+    */
+    void GeneratePrimitiveFromVectors(Vertex * out, const love::Vector2 * points, size_t count,
+                                      const Colorf * colors, size_t colorCount);
+
+    void GenerateTextureFromVectors(Vertex * out, const love::Vector2 * points, const love::Vector2 * texcoord,
+                                    size_t count, const Colorf & color);
+
+    void GenerateTextureFromGlyphs(Vertex * out, const GlyphVertex * verts, size_t count);
+}
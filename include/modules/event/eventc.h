@@ -16,7 +16,6 @@
 
 #include "driver/hidrv.h"
 
-#include <queue>
 #include <vector>
 #include <memory>
 
@@ -50,6 +49,15 @@ namespace love::common
 
             bool Poll(Message *& message);
 
+            /*
+            ** Merge touchmoved and gamepadaxis events into the newest one
+            ** queued for the same touch or axis, unless that touch was
+            ** pressed or released, or that gamepad changed, in between
+            */
+            void SetCoalescing(bool enable);
+
+            bool IsCoalescing() const;
+
             void ExceptionIfInRenderPass(const char * name);
 
             std::unique_ptr<love::driver::Hidrv> & GetDriver();
@@ -60,11 +68,33 @@ namespace love::common
             std::unique_ptr<love::driver::Hidrv> driver;
 
         private:
-            std::queue<Message *> queue;
+            /* Polled from queueHead on, so draining it never frees anything */
+            std::vector<Message *> queue;
+            size_t queueHead;
+
+            MessagePool pool;
+
+            bool coalescing;
+
+            /*
+            ** The driver event behind each queued message, by index
+            ** Pushed messages have none and coalescing stops at them
+            */
+            struct Source
+            {
+                driver::Hidrv::LOVE_Event event;
+                bool converted;
+            };
+
+            std::vector<Source> sources;
+
+            bool Coalesce(const driver::Hidrv::LOVE_Event & event);
+
+            void UpdateTouches(const driver::Hidrv::LOVE_Event & event);
 
             Message * Convert(const driver::Hidrv::LOVE_Event & event);
 
-            Message * ConvertJoystickEvent(const driver::Hidrv::LOVE_Event & event) const;
+            Message * ConvertJoystickEvent(const driver::Hidrv::LOVE_Event & event);
 
             Message * ConvertWindowEvent(const driver::Hidrv::LOVE_Event & event);
     };
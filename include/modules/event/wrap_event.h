@@ -12,6 +12,10 @@ namespace Wrap_Event
 
     int Quit(lua_State * L);
 
+    int SetCoalescing(lua_State * L);
+
+    int IsCoalescing(lua_State * L);
+
     int Wait(lua_State * L);
 
     int Register(lua_State * L);
@@ -9,6 +9,9 @@
 #include "common/stringmap.h"
 #include "common/vector.h"
 #include "common/colors.h"
+#include "common/tessellator.h"
+
+#include <optional>
 
 /* OBJECTS */
 
@@ -32,6 +35,12 @@
 #include "objects/text/wrap_text.h"
 #include "objects/text/text.h"
 
+#include "objects/spritebatch/wrap_spritebatch.h"
+#include "objects/spritebatch/spritebatch.h"
+
+#include "objects/particlesystem/wrap_particlesystem.h"
+#include "objects/particlesystem/particlesystem.h"
+
 #if defined(__SWITCH__)
     // #include "objects/font.h"
     // using gFont = love::deko3d::Font;
@@ -40,6 +49,12 @@
     #include "deko3d/vertex.h"
 
     #include "objects/shader/wrap_shader.h"
+
+    #include "objects/mesh/wrap_mesh.h"
+    #include "objects/mesh/mesh.h"
+
+    #include "objects/atlas/wrap_atlas.h"
+    #include "objects/atlas/atlas.h"
 #endif
 
 namespace love
@@ -51,7 +66,7 @@ namespace love
 
             enum class Screen: uint8_t;
 
-            #if defined(__SWITCH__)
+            #if defined(__SWITCH__) || defined(__HEADLESS__)
                 static constexpr int MAX_SCREENS = 1;
             #elif defined(_3DS)
                 static constexpr int MAX_SCREENS = 3;
@@ -116,6 +131,14 @@ namespace love
                 std::string device;
             };
 
+            /* Counted over the last presented frame */
+            struct Stats
+            {
+                int drawCalls;
+                int drawCallsBatched; //< draws merged into the one before them
+                int vertexOverflows;  //< times the renderer ran out of vertex memory
+            };
+
             enum StackType
             {
                 STACK_ALL,
@@ -242,7 +265,7 @@ namespace love
                 virtual Font * NewDefaultFont(int size, TrueTypeRasterizer::Hinting hinting, const Texture::Filter & filter = Texture::defaultFilter) = 0;
 
                 virtual Font * NewFont(Rasterizer * rasterizer, const Texture::Filter & filter = Texture::defaultFilter) = 0;
-            #elif defined (_3DS)
+            #elif defined (_3DS) || defined (__HEADLESS__)
                 virtual Font * NewDefaultFont(int size, const Texture::Filter & filter = Texture::defaultFilter) = 0;
 
                 virtual Font * NewFont(const Rasterizer & rasterizer, const Texture::Filter & filter = Texture::defaultFilter) = 0;
@@ -253,6 +276,20 @@ namespace love
 
             Text * NewText(Font * font, const std::vector<Font::ColoredString> &text = {});
 
+            SpriteBatch * NewSpriteBatch(Texture * texture, int size);
+
+            ParticleSystem * NewParticleSystem(Texture * texture, uint32_t size);
+
+            #if defined (__SWITCH__)
+                Mesh * NewMesh(const std::vector<Mesh::AttribFormat> & format, const std::vector<float> & data,
+                               size_t vertexCount, Mesh::DrawMode mode, Mesh::Usage usage);
+
+                Mesh * NewMesh(const std::vector<Mesh::AttribFormat> & format, size_t vertexCount,
+                               Mesh::DrawMode mode, Mesh::Usage usage);
+
+                Atlas * NewAtlas(int pageSize);
+            #endif
+
             void SetFont(Font * font);
 
             Font * GetFont();
@@ -304,42 +341,44 @@ namespace love
                 virtual void SetFrontFaceWinding(vertex::Winding winding) = 0;
             #endif
 
-            /* Primitives */
+            /*
+            ** Primitives
+            ** Shapes are tessellated here and handed to Polygon,
+            ** renderers with native shape drawing override them
+            */
 
-            virtual void Rectangle(DrawMode mode, float x, float y, float width, float height) = 0;
+            virtual void Rectangle(DrawMode mode, float x, float y, float width, float height);
 
-            virtual void Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry) = 0;
+            virtual void Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry);
 
-            virtual void Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry, int points) = 0;
+            virtual void Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry, int points);
 
-            virtual void Ellipse(DrawMode mode, float x, float y, float a, float b) = 0;
+            virtual void Ellipse(DrawMode mode, float x, float y, float a, float b);
 
-            virtual void Ellipse(DrawMode mode, float x, float y, float a, float b, int points) = 0;
+            virtual void Ellipse(DrawMode mode, float x, float y, float a, float b, int points);
 
-            virtual void Circle(DrawMode mode, float x, float y, float radius) = 0;
+            virtual void Circle(DrawMode mode, float x, float y, float radius);
 
-            virtual void Circle(DrawMode mode, float x, float y, float radius, int points) = 0;
+            virtual void Circle(DrawMode mode, float x, float y, float radius, int points);
 
-            #if defined(__SWITCH__)
-                virtual void Polygon(DrawMode mode, const Vector2 * points, size_t count, bool skipLastFilledVertex = true) = 0;
-            #else
-                virtual void Polygon(DrawMode mode, const Vector2 * points, size_t count) = 0;
-            #endif
+            virtual void Polygon(DrawMode mode, const Vector2 * points, size_t count, bool skipLastFilledVertex = true) = 0;
 
-            virtual void Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2) = 0;
+            virtual void Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2);
 
-            virtual void Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2, int points) = 0;
+            virtual void Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2, int points);
 
             virtual void Points(const Vector2 * points, size_t count, const Colorf * colors, size_t colorCount) = 0;
 
             virtual void SetPointSize(float size) = 0;
 
-            virtual void Line(const Vector2 * points, int count) = 0;
+            virtual void Line(const Vector2 * points, int count);
 
             virtual void SetLineWidth(float width) = 0;
 
             virtual RendererInfo GetRendererInfo() const = 0;
 
+            virtual Stats GetStats() const = 0;
+
             Vector2 TransformPoint(Vector2 point);
 
             Vector2 InverseTransformPoint(Vector2 point);
@@ -500,16 +539,6 @@ namespace love
                     Graphics * gfx;
             };
 
-            struct Stats
-            {
-                int drawCalls;
-                int canvasSwitches;
-                int shaderSwitches;
-                int canvases;
-                int images;
-                int fonts;
-            };
-
             void PushTransform();
 
             void PopTransform();
@@ -609,6 +638,10 @@ namespace love
 
             void RestoreStateChecked(const DisplayState & state);
 
+            int CalculateEllipsePoints(float rx, float ry) const;
+
+            Tessellator tessellator;
+
             int width;
             int height;
 
@@ -6,6 +6,8 @@
     #include "deko3d/graphics.h"
 #elif defined (_3DS)
     #include "citro2d/graphics.h"
+#elif defined (__HEADLESS__)
+    #include "recorder/graphics.h"
 #endif
 
 #include "modules/window/window.h"
@@ -81,6 +83,16 @@ namespace Wrap_Graphics
 
     int NewText(lua_State * L);
 
+    int NewSpriteBatch(lua_State * L);
+
+    int NewParticleSystem(lua_State * L);
+
+    #if defined (__SWITCH__)
+        int NewMesh(lua_State * L);
+
+        int NewAtlas(lua_State * L);
+    #endif
+
     int NewCanvas(lua_State * L);
 
     int SetDefaultFilter(lua_State * L);
@@ -95,6 +107,8 @@ namespace Wrap_Graphics
 
     int GetRendererInfo(lua_State * L);
 
+    int GetStats(lua_State * L);
+
     int GetBackgroundColor(lua_State * L);
 
     int GetCanvas(lua_State * L);
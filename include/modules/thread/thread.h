@@ -9,6 +9,9 @@
 #elif defined (__SWITCH__)
     #define LOVE_WaitThread(thread) threadWaitForExit(&(thread))
     #define LOVE_CloseThread(thread) threadClose(&(thread))
+#elif defined (__HEADLESS__)
+    #define LOVE_WaitThread(thread) threadWaitForExit(&(thread))
+    #define LOVE_CloseThread(thread) threadClose(&(thread))
 #endif
 
 namespace love
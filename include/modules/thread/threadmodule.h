@@ -22,6 +22,8 @@ namespace love
 
             Channel * NewChannel();
 
+            Channel * NewChannel(Channel::Mode mode, size_t capacity);
+
             Channel * GetChannel(const std::string & name);
 
             LuaThread * NewThread(const std::string & name, love::Data * data);
@@ -31,5 +31,8 @@ namespace love
         protected:
             LOVE_Thread * owner;
             std::string threadName;
+
+            /* Set before Start, in bytes */
+            size_t stackSize;
     };
 }
\ No newline at end of file
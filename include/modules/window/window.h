@@ -2,6 +2,8 @@
 
 #include "modules/graphics/graphics.h"
 
+#include <array>
+
 namespace love
 {
     class Window : public Module
@@ -1,12 +1,16 @@
 #pragma once
 
 #include "common/variant.h"
+#include "common/boundedqueue.h"
+#include "common/stringmap.h"
 #include "objects/object.h"
 
 #include "modules/thread/types/mutex.h"
 #include "modules/thread/types/conditional.h"
 #include "modules/thread/types/lock.h"
 
+#include <atomic>
+#include <memory>
 #include <queue>
 
 namespace love
@@ -19,12 +23,35 @@ namespace love
         public:
             static love::Type type;
 
+            /*
+            ** MODE_LOCKED is unbounded, behind a mutex
+            ** The others are bounded and lock-free, for one producer
+            ** and one consumer or any number of either; an SPSC
+            ** Channel errors when a second thread pushes or pops
+            */
+            enum Mode
+            {
+                MODE_LOCKED,
+                MODE_SPSC,
+                MODE_MPMC,
+                MODE_MAX_ENUM
+            };
+
             Channel();
 
+            /*
+            ** A lock-free channel holding up to @capacity values
+            ** Pushing to a full one waits for room
+            */
+            Channel(Mode mode, size_t capacity);
+
             virtual ~Channel();
 
             uint64_t Push(const Variant & variant);
 
+            /* Push @count values at once, returning the id of the last */
+            uint64_t Push(const Variant * variants, size_t count);
+
             // Blocking push
             bool Supply(const Variant & variant);
 
@@ -32,6 +59,9 @@ namespace love
 
             bool Pop(Variant * variant);
 
+            /* Pop up to @max values into @variants at once, returning how many */
+            size_t Pop(Variant * variants, size_t max);
+
             // Blocking pop
             bool Demand(Variant * variant);
 
@@ -45,6 +75,15 @@ namespace love
 
             void Clear();
 
+            Mode GetMode() const;
+
+            /* Peek and performAtomic need the lock, so they're not available */
+            bool IsLockFree() const;
+
+            static bool GetConstant(const char * in, Mode & out);
+            static bool GetConstant(Mode in, const char *& out);
+            static std::vector<std::string> GetConstants(Mode);
+
         private:
             void LockMutex();
             void UnlockMutex();
@@ -56,7 +95,50 @@ namespace love
             std::queue<Variant> queue;
 
             uint64_t sent;
-            uint64_t received;
+            std::atomic<uint64_t> received;
+
+            Mode mode;
+
+            /* Only for the lock-free modes, which use @mutex just to sleep */
+            std::unique_ptr<BoundedQueue<Variant>> ring;
+
+            /*
+            ** Threads sleeping in a lock-free mode, one set per thing they wait on,
+            ** so a push only wakes pops and a pop only wakes pushes and Supply
+            */
+            struct Waiters
+            {
+                thread::ConditionalRef condition;
+                std::atomic<int> count { 0 };
+            };
+
+            Waiters notFull;  //< pushes waiting for room
+            Waiters notEmpty; //< pops waiting for a value
+            Waiters read;     //< Supply waiting for its value to be popped
+
+            /* The threads on either side of an SPSC ring, set by their first call */
+            std::atomic<const void *> producer;
+            std::atomic<const void *> consumer;
+
+            void Claim(std::atomic<const void *> & side, const char * action);
+
+            /* Yields before a lock-free call sleeps */
+            static constexpr int PARK_SPINS = 16;
+
+            template <typename T>
+            bool Park(Waiters & waiters, T attempt, double timeout);
+
+            void Wake(Waiters & waiters, bool all);
+
+            /* After values went in, or came out */
+            void Pushed(bool many);
+            void Popped(bool many);
+
+            uint64_t RingPush(const Variant & variant, double timeout);
+            bool RingPop(Variant * variant);
+
+            static StringMap<Mode, MODE_MAX_ENUM>::Entry modeEntries[];
+            static StringMap<Mode, MODE_MAX_ENUM> modes;
     };
 
     int Wrap_Channel_PerformAtomic(lua_State *);
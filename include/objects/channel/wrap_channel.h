@@ -6,10 +6,14 @@ namespace Wrap_Channel
 {
     int Push(lua_State * L);
 
+    int PushMany(lua_State * L);
+
     int Supply(lua_State * L);
 
     int Pop(lua_State * L);
 
+    int PopMany(lua_State * L);
+
     int Demand(lua_State * L);
 
     int Peek(lua_State * L);
@@ -85,7 +85,7 @@ namespace love
         private:
             std::string filename;
 
-            PHYSFS_file * file;
+            PHYSFS_File * file;
             Mode mode;
 
             BufferMode bufferMode;
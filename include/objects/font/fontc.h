@@ -39,6 +39,8 @@ namespace love::common
                 static constexpr int MAX_SYSFONTS = 5;
             #elif defined (__SWITCH__)
                 static constexpr int MAX_SYSFONTS = 7;
+            #elif defined (__HEADLESS__)
+                static constexpr int MAX_SYSFONTS = 1;
             #endif
 
             enum class SystemFontType : uint8_t;
@@ -63,6 +65,20 @@ namespace love::common
 
             float GetLineHeight() const;
 
+            /*
+            ** Get @codepoints ready ahead of drawing them
+            ** Does nothing where glyphs come prerendered
+            */
+            virtual void Preload(const std::vector<uint32_t> & codepoints);
+
+            /*
+            ** Preload glyphs as text gets laid out, drawing it
+            ** without them until they're ready
+            */
+            virtual void SetAutoPreload(bool enable);
+
+            virtual bool GetAutoPreload() const;
+
             static Font * GetSystemFontByType(int size, SystemFontType type, const Texture::Filter & filter = Texture::defaultFilter);
 
             static bool GetConstant(const char * in, AlignMode & out);
@@ -79,6 +95,14 @@ namespace love::common
             float lineHeight;
             Texture::Filter filter;
 
+            /*
+            ** Fill @out with the raw bytes of everything that goes into
+            ** laying out @text, for keying layout caches; @wrap and @align
+            ** only count when @formatted
+            */
+            static void GetLayoutKey(std::string & out, const std::vector<ColoredString> & text, const Colorf & color,
+                                     bool formatted, float wrap, AlignMode align);
+
             static StringMap<AlignMode, ALIGN_MAX_ENUM>::Entry alignModeEntries[];
             static StringMap<AlignMode, ALIGN_MAX_ENUM> alignModes;
 
@@ -9,6 +9,12 @@ namespace Wrap_Font
 
     int GetHeight(lua_State * L);
 
+    int Preload(lua_State * L);
+
+    int SetAutoPreload(lua_State * L);
+
+    int GetAutoPreload(lua_State * L);
+
     love::Font * CheckFont(lua_State * L, int index);
 
     void CheckColoredString(lua_State * L, int index, std::vector<love::Font::ColoredString> & strings);
@@ -3,6 +3,8 @@
 #include "objects/object.h"
 #include "common/stringmap.h"
 
+#include <limits>
+
 namespace love::common
 {
     class Gamepad : public Object
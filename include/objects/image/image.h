@@ -21,6 +21,12 @@ namespace love
 
             #if defined(__SWITCH__)
                 void ReplacePixels(const void * data, size_t size, const Rect & rect);
+
+                /* Replace several rectangles at once, see deko3d::UploadRegions */
+                void ReplacePixels(const void * data, size_t size, const std::vector<CImage::Region> & regions);
+
+                /* Copy the top-left @width x @height pixels of @source into this Image */
+                void CopyPixels(Image * source, int width, int height);
             #endif
 
         private:
@@ -0,0 +1,324 @@
+#pragma once
+
+#include "objects/drawable/drawable.h"
+#include "objects/texture/texture.h"
+#include "objects/random/randomgenerator.h"
+
+#include "common/colors.h"
+#include "common/exception.h"
+#include "common/strongref.h"
+#include "common/vector.h"
+
+#include <limits>
+#include <vector>
+
+namespace love
+{
+    class Graphics;
+
+    namespace common
+    {
+        /*
+        ** Particles are stored one float array per attribute,
+        ** so the integrator is a straight loop over contiguous
+        ** memory that the compiler can vectorize.
+        */
+        class ParticleSystem : public Drawable
+        {
+            public:
+                static love::Type type;
+
+                static constexpr uint32_t MAX_PARTICLES = std::numeric_limits<int32_t>::max() / 4;
+
+                static constexpr size_t MAX_GRADIENT = 8;
+
+                ParticleSystem(love::Texture * texture, uint32_t size);
+
+                virtual ~ParticleSystem();
+
+                void SetTexture(love::Texture * texture);
+
+                love::Texture * GetTexture() const;
+
+                void SetBufferSize(uint32_t size);
+
+                uint32_t GetBufferSize() const;
+
+                void SetEmissionRate(float rate);
+
+                float GetEmissionRate() const;
+
+                void SetEmitterLifetime(float lifetime);
+
+                float GetEmitterLifetime() const;
+
+                void SetParticleLifetime(float min, float max);
+
+                void GetParticleLifetime(float & min, float & max) const;
+
+                void SetPosition(float x, float y);
+
+                const Vector2 & GetPosition() const;
+
+                /* Like SetPosition, but emits along the path moved */
+                void MoveTo(float x, float y);
+
+                void SetDirection(float direction);
+
+                float GetDirection() const;
+
+                void SetSpread(float spread);
+
+                float GetSpread() const;
+
+                void SetSpeed(float min, float max);
+
+                void GetSpeed(float & min, float & max) const;
+
+                void SetLinearAcceleration(float xmin, float ymin, float xmax, float ymax);
+
+                void GetLinearAcceleration(Vector2 & min, Vector2 & max) const;
+
+                void SetRadialAcceleration(float min, float max);
+
+                void GetRadialAcceleration(float & min, float & max) const;
+
+                void SetTangentialAcceleration(float min, float max);
+
+                void GetTangentialAcceleration(float & min, float & max) const;
+
+                void SetLinearDamping(float min, float max);
+
+                void GetLinearDamping(float & min, float & max) const;
+
+                void SetSizes(const std::vector<float> & sizes);
+
+                const std::vector<float> & GetSizes() const;
+
+                void SetSizeVariation(float variation);
+
+                float GetSizeVariation() const;
+
+                void SetRotation(float min, float max);
+
+                void GetRotation(float & min, float & max) const;
+
+                void SetSpin(float start, float end);
+
+                void GetSpin(float & start, float & end) const;
+
+                void SetSpinVariation(float variation);
+
+                float GetSpinVariation() const;
+
+                void SetRelativeRotation(bool enable);
+
+                bool HasRelativeRotation() const;
+
+                void SetOffset(float x, float y);
+
+                const Vector2 & GetOffset() const;
+
+                void SetColors(const std::vector<Colorf> & colors);
+
+                const std::vector<Colorf> & GetColors() const;
+
+                uint32_t GetCount() const;
+
+                void Start();
+
+                void Stop();
+
+                void Pause();
+
+                void Reset();
+
+                void Emit(uint32_t count);
+
+                bool IsActive() const;
+
+                bool IsPaused() const;
+
+                bool IsStopped() const;
+
+                bool IsEmpty() const;
+
+                bool IsFull() const;
+
+                void Update(float dt);
+
+                virtual void Draw(Graphics * gfx, const Matrix4 & localTransform) = 0;
+
+            protected:
+                enum Field
+                {
+                    FIELD_X,
+                    FIELD_Y,
+                    FIELD_ORIGIN_X,
+                    FIELD_ORIGIN_Y,
+                    FIELD_VELOCITY_X,
+                    FIELD_VELOCITY_Y,
+                    FIELD_LINEAR_ACCEL_X,
+                    FIELD_LINEAR_ACCEL_Y,
+                    FIELD_RADIAL_ACCEL,
+                    FIELD_TANGENTIAL_ACCEL,
+                    FIELD_DAMPING,
+                    FIELD_LIFE,
+                    FIELD_LIFETIME,
+                    FIELD_ROTATION,
+                    FIELD_SPIN_START,
+                    FIELD_SPIN_END,
+                    FIELD_SIZE_OFFSET,
+                    FIELD_SIZE_INTERVAL,
+                    FIELD_MAX_ENUM
+                };
+
+                inline float * GetField(Field field)
+                {
+                    return this->fields[field];
+                }
+
+                inline const float * GetField(Field field) const
+                {
+                    return this->fields[field];
+                }
+
+                float GetParticleAngle(uint32_t index) const;
+
+                float GetParticleSize(uint32_t index) const;
+
+                Colorf GetParticleColor(uint32_t index) const;
+
+                /*
+                ** Write four vertices per live particle into @out,
+                ** from the quad corners of the texture
+                */
+                template <typename V>
+                void GenerateVertices(V * out, const Vector2 * positions, const Vector2 * texcoords,
+                                      const Colorf & tint) const
+                {
+                    uint16_t coords[4][2];
+
+                    for (size_t corner = 0; corner < 4; corner++)
+                    {
+                        coords[corner][0] = uint16_t(texcoords[corner].x * 0xFFFF);
+                        coords[corner][1] = uint16_t(texcoords[corner].y * 0xFFFF);
+                    }
+
+                    const float * x = this->GetField(FIELD_X);
+                    const float * y = this->GetField(FIELD_Y);
+
+                    for (uint32_t index = 0; index < this->count; index++)
+                    {
+                        float angle = this->GetParticleAngle(index);
+                        float size = this->GetParticleSize(index);
+
+                        float c = cosf(angle) * size;
+                        float s = sinf(angle) * size;
+
+                        Colorf color = this->GetParticleColor(index);
+                        color *= tint;
+
+                        /* Vertex colors are RGBA8 */
+                        const uint8_t packed[4] =
+                        {
+                            uint8_t(std::clamp(color.r, 0.0f, 1.0f) * 0xFF + 0.5f),
+                            uint8_t(std::clamp(color.g, 0.0f, 1.0f) * 0xFF + 0.5f),
+                            uint8_t(std::clamp(color.b, 0.0f, 1.0f) * 0xFF + 0.5f),
+                            uint8_t(std::clamp(color.a, 0.0f, 1.0f) * 0xFF + 0.5f)
+                        };
+
+                        for (size_t corner = 0; corner < 4; corner++)
+                        {
+                            float px = positions[corner].x - this->offset.x;
+                            float py = positions[corner].y - this->offset.y;
+
+                            /* Build it locally, @out may be uncached GPU memory */
+                            V vertex =
+                            {
+                                .position = { x[index] + c * px - s * py, y[index] + s * px + c * py },
+                                .color    = { packed[0], packed[1], packed[2], packed[3] },
+                                .texcoord = { coords[corner][0], coords[corner][1] }
+                            };
+
+                            *out++ = vertex;
+                        }
+                    }
+                }
+
+                StrongReference<love::Texture> texture;
+
+                /* Particle data, FIELD_MAX_ENUM arrays of @stride floats */
+                std::vector<float> storage;
+                uint32_t stride;
+
+                /*
+                ** Start of each array in @storage
+                ** Loaded as separate bases, the compiler
+                ** can trust __restrict on them
+                */
+                float * fields[FIELD_MAX_ENUM];
+
+                uint32_t bufferSize;
+                uint32_t count;
+
+                Vector2 offset;
+
+            private:
+                void Integrate(float dt);
+
+                void RemoveDead();
+
+                void AddParticle(float t);
+
+                RandomGenerator rng;
+
+                bool active;
+                bool paused;
+
+                float emissionRate;
+                float emitCounter;
+
+                float emitterLifetime;
+                float life;
+
+                float particleLifeMin;
+                float particleLifeMax;
+
+                Vector2 position;
+                Vector2 prevPosition;
+
+                float direction;
+                float spread;
+
+                float speedMin;
+                float speedMax;
+
+                Vector2 linearAccelMin;
+                Vector2 linearAccelMax;
+
+                float radialAccelMin;
+                float radialAccelMax;
+
+                float tangentialAccelMin;
+                float tangentialAccelMax;
+
+                float dampingMin;
+                float dampingMax;
+
+                std::vector<float> sizes;
+                float sizeVariation;
+
+                float rotationMin;
+                float rotationMax;
+
+                float spinStart;
+                float spinEnd;
+                float spinVariation;
+
+                bool relativeRotation;
+
+                std::vector<Colorf> colors;
+        };
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "objects/particlesystem/particlesystem.h"
+#include "objects/texture/wrap_texture.h"
+
+namespace Wrap_ParticleSystem
+{
+    int SetTexture(lua_State * L);
+
+    int GetTexture(lua_State * L);
+
+    int SetBufferSize(lua_State * L);
+
+    int GetBufferSize(lua_State * L);
+
+    int SetEmissionRate(lua_State * L);
+
+    int GetEmissionRate(lua_State * L);
+
+    int SetEmitterLifetime(lua_State * L);
+
+    int GetEmitterLifetime(lua_State * L);
+
+    int SetParticleLifetime(lua_State * L);
+
+    int GetParticleLifetime(lua_State * L);
+
+    int SetPosition(lua_State * L);
+
+    int GetPosition(lua_State * L);
+
+    int MoveTo(lua_State * L);
+
+    int SetDirection(lua_State * L);
+
+    int GetDirection(lua_State * L);
+
+    int SetSpread(lua_State * L);
+
+    int GetSpread(lua_State * L);
+
+    int SetSpeed(lua_State * L);
+
+    int GetSpeed(lua_State * L);
+
+    int SetLinearAcceleration(lua_State * L);
+
+    int GetLinearAcceleration(lua_State * L);
+
+    int SetRadialAcceleration(lua_State * L);
+
+    int GetRadialAcceleration(lua_State * L);
+
+    int SetTangentialAcceleration(lua_State * L);
+
+    int GetTangentialAcceleration(lua_State * L);
+
+    int SetLinearDamping(lua_State * L);
+
+    int GetLinearDamping(lua_State * L);
+
+    int SetSizes(lua_State * L);
+
+    int GetSizes(lua_State * L);
+
+    int SetSizeVariation(lua_State * L);
+
+    int GetSizeVariation(lua_State * L);
+
+    int SetRotation(lua_State * L);
+
+    int GetRotation(lua_State * L);
+
+    int SetSpin(lua_State * L);
+
+    int GetSpin(lua_State * L);
+
+    int SetSpinVariation(lua_State * L);
+
+    int GetSpinVariation(lua_State * L);
+
+    int SetRelativeRotation(lua_State * L);
+
+    int HasRelativeRotation(lua_State * L);
+
+    int SetOffset(lua_State * L);
+
+    int GetOffset(lua_State * L);
+
+    int SetColors(lua_State * L);
+
+    int GetColors(lua_State * L);
+
+    int GetCount(lua_State * L);
+
+    int Start(lua_State * L);
+
+    int Stop(lua_State * L);
+
+    int Pause(lua_State * L);
+
+    int Reset(lua_State * L);
+
+    int Emit(lua_State * L);
+
+    int IsActive(lua_State * L);
+
+    int IsPaused(lua_State * L);
+
+    int IsStopped(lua_State * L);
+
+    int IsEmpty(lua_State * L);
+
+    int IsFull(lua_State * L);
+
+    int Update(lua_State * L);
+
+    love::ParticleSystem * CheckParticleSystem(lua_State * L, int index);
+
+    int Register(lua_State * L);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "objects/drawable/drawable.h"
+#include "objects/texture/texture.h"
+#include "objects/quad/quad.h"
+
+#include "common/colors.h"
+#include "common/exception.h"
+#include "common/strongref.h"
+
+namespace love
+{
+    class Graphics;
+
+    namespace common
+    {
+        /*
+        ** Sprites are written into backend storage as they are added
+        ** and stay there between frames. Drawing never rebuilds them.
+        */
+        class SpriteBatch : public Drawable
+        {
+            public:
+                static love::Type type;
+
+                SpriteBatch(love::Texture * texture, int size);
+
+                virtual ~SpriteBatch();
+
+                int Add(const Matrix4 & m, int index = -1);
+
+                int Add(love::Quad * quad, const Matrix4 & m, int index = -1);
+
+                void Clear();
+
+                void Flush();
+
+                void SetTexture(love::Texture * texture);
+
+                love::Texture * GetTexture() const;
+
+                void SetColor(const Colorf & color);
+
+                void SetColor();
+
+                Colorf GetColor(bool & active) const;
+
+                int GetCount() const;
+
+                int GetBufferSize() const;
+
+                void SetBufferSize(int size);
+
+                void SetDrawRange(int start, int count);
+
+                void SetDrawRange();
+
+                bool GetDrawRange(int & start, int & count) const;
+
+                virtual void Draw(Graphics * gfx, const Matrix4 & localTransform) = 0;
+
+            protected:
+                /* Write one sprite into the backend's storage */
+                virtual void SetSprite(int index, love::Quad * quad, const Matrix4 & m, const Colorf & color) = 0;
+
+                /* Resize the backend's storage, keeping existing sprites */
+                virtual void Resize(int size) = 0;
+
+                /* The sprites to draw, with the draw range applied */
+                bool GetDrawSprites(int & start, int & count) const;
+
+                StrongReference<love::Texture> texture;
+
+                int size;
+                int next;
+
+                Colorf color;
+                bool colorActive;
+
+                int rangeStart;
+                int rangeCount;
+        };
+    }
+}
@@ -39,6 +39,8 @@ namespace love::citro2d
 
             RendererInfo GetRendererInfo() const override;
 
+            Stats GetStats() const override;
+
             void Clear(std::optional<Colorf> color, std::optional<int> stencil, std::optional<double> depth) override;
 
             void Present() override;
@@ -51,7 +53,7 @@ namespace love::citro2d
 
             /* Primitives */
 
-            void Polygon(DrawMode mode, const Vector2 * points, size_t count) override;
+            void Polygon(DrawMode mode, const Vector2 * points, size_t count, bool skipLastFilledVertex = true) override;
 
             void Polyfill(const Vector2 * points, size_t count, u32 color, float depth);
 
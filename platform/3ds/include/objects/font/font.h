@@ -2,10 +2,13 @@
 
 #include "objects/font/fontc.h"
 #include "common/data.h"
+#include "common/lrucache.h"
 
 #include <c2d/font.h>
 #include <c2d/text.h>
 
+#include <array>
+
 enum class love::common::Font::SystemFontType : uint8_t
 {
     TYPE_STANDARD  = CFG_REGION_USA,
@@ -54,8 +57,54 @@ namespace love
             float GetScale() const;
 
         private:
+            /* A parsed string and the glyph buffer it owns */
+            struct CachedText
+            {
+                C2D_TextBuf buffer = nullptr;
+                C2D_Text text = {};
+
+                CachedText() = default;
+
+                CachedText(CachedText && other) : buffer(other.buffer),
+                                                  text(other.text)
+                {
+                    other.buffer = nullptr;
+                }
+
+                CachedText & operator=(CachedText && other)
+                {
+                    std::swap(this->buffer, other.buffer);
+                    std::swap(this->text, other.text);
+
+                    return *this;
+                }
+
+                ~CachedText()
+                {
+                    if (this->buffer != nullptr)
+                        C2D_TextBufDelete(this->buffer);
+                }
+            };
+
+            /*
+            ** Parse @text, or reuse it from an earlier call
+            ** Strings too long for the cache go through the shared buffer
+            */
+            const C2D_Text * ParseText(const std::vector<ColoredString> & text);
+
             Rasterizer rasterizer;
 
             std::unordered_map<uint32_t, float> glyphWidths;
+
+            /* Widths below this skip the hash map, NaN until looked up */
+            static constexpr uint32_t DENSE_GLYPHS = 256;
+            std::array<float, DENSE_GLYPHS> denseWidths;
+
+            /* Costs are glyph counts, bounded by FONT_BUFFER_SIZE in total */
+            LRUCache<std::string, CachedText> texts;
+
+            /* Reused to build keys, so a hit doesn't allocate */
+            std::string textKey;
+            C2D_Text scratchText;
     };
 }
\ No newline at end of file
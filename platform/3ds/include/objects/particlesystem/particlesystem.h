@@ -0,0 +1,18 @@
+#pragma once
+
+#include "objects/particlesystem/particlesystemc.h"
+
+#include <citro2d.h>
+
+namespace love
+{
+    class ParticleSystem : public common::ParticleSystem
+    {
+        public:
+            ParticleSystem(love::Texture * texture, uint32_t size);
+
+            virtual ~ParticleSystem();
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "objects/spritebatch/spritebatchc.h"
+
+#include <citro2d.h>
+
+namespace love
+{
+    class SpriteBatch : public common::SpriteBatch
+    {
+        public:
+            SpriteBatch(love::Texture * texture, int size);
+
+            virtual ~SpriteBatch();
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+
+        protected:
+            void SetSprite(int index, love::Quad * quad, const Matrix4 & m, const Colorf & color) override;
+
+            void Resize(int size) override;
+
+        private:
+            struct Sprite
+            {
+                Tex3DS_SubTexture subtex;
+
+                float width;
+                float height;
+
+                Matrix4 transform;
+                Colorf color;
+            };
+
+            std::vector<Sprite> sprites;
+    };
+}
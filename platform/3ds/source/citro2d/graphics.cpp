@@ -176,7 +176,7 @@ void love::citro2d::Graphics::Polyfill(const Vector2 * points, size_t count, u32
     }
 }
 
-void love::citro2d::Graphics::Polygon(DrawMode mode, const Vector2 * points, size_t count)
+void love::citro2d::Graphics::Polygon(DrawMode mode, const Vector2 * points, size_t count, bool)
 {
     Colorf color = this->GetColor();
     u32 foreground = C2D_Color32f(color.r, color.g, color.b, color.a);
@@ -381,6 +381,12 @@ Graphics::RendererInfo love::citro2d::Graphics::GetRendererInfo() const
     return info;
 }
 
+/* citro2d batches on its own and doesn't say how often it draws */
+Graphics::Stats love::citro2d::Graphics::GetStats() const
+{
+    return Stats {};
+}
+
 bool love::citro2d::Graphics::GetConstant(const char * in, Screen & out)
 {
     return plainScreens.Find(in, out);
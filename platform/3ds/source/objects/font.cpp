@@ -1,22 +1,27 @@
 #include "objects/font/font.h"
 #include "modules/graphics/graphics.h"
 
-#include <numeric>
+#include <algorithm>
+#include <cmath>
 
 using namespace love;
 
-Font::Font(const Rasterizer & rasterizer, const Texture::Filter & filter) : rasterizer(rasterizer)
+Font::Font(const Rasterizer & rasterizer, const Texture::Filter & filter) : rasterizer(rasterizer),
+                                                                           texts(FONT_BUFFER_SIZE)
 {
     if (rasterizer.data != nullptr)
         this->rasterizer.font = C2D_FontLoadFromMem(rasterizer.data->GetData(), rasterizer.data->GetSize());
 
     this->rasterizer.buffer = C2D_TextBufNew(Font::FONT_BUFFER_SIZE);
+    this->denseWidths.fill(NAN);
 
     this->lineHeight = 1.0f;
 }
 
 Font::~Font()
 {
+    this->texts.Clear();
+
     C2D_TextBufClear(this->rasterizer.buffer);
 
     C2D_TextBufDelete(this->rasterizer.buffer);
@@ -45,29 +50,18 @@ common::Font * common::Font::GetSystemFontByType(int size, Font::SystemFontType
 void Font::Print(Graphics * gfx, const std::vector<ColoredString> & text,
                  const Matrix4 & localTransform, const Colorf & color)
 {
-    C2D_Text citroText;
-
-    std::string result = std::accumulate(text.begin(), text.end(), std::string{},
-                         [](const std::string& s1, const ColoredString& piece)
-                         { return s1 + piece.string; });
-
-    C2D_TextFontParse(&citroText, this->rasterizer.font, this->rasterizer.buffer, result.c_str());
-    C2D_TextOptimize(&citroText);
+    const C2D_Text * citroText = this->ParseText(text);
 
     Matrix4 t(gfx->GetTransform(), localTransform);
     C2D_ViewRestore(&t.GetElements());
 
     u32 renderColorf = C2D_Color32f(color.r, color.g, color.b, color.a);
-    C2D_DrawText(&citroText, C2D_WithColor, 0, 0, Graphics::CURRENT_DEPTH, this->GetScale(), this->GetScale(), renderColorf);
-
-    C2D_TextBufClear(this->rasterizer.buffer);
+    C2D_DrawText(citroText, C2D_WithColor, 0, 0, Graphics::CURRENT_DEPTH, this->GetScale(), this->GetScale(), renderColorf);
 }
 
 void Font::Printf(Graphics * gfx, const std::vector<ColoredString> & text, float wrap, AlignMode align,
                   const Matrix4 & localTransform, const Colorf & color)
 {
-    C2D_Text citroText;
-
     u32 alignMode = C2D_WordWrap;
     float offset = 0.0f;
 
@@ -89,24 +83,57 @@ void Font::Printf(Graphics * gfx, const std::vector<ColoredString> & text, float
             break;
     }
 
-    std::string result = std::accumulate(text.begin(), text.end(), std::string {},
-                         [](const std::string & s1, const ColoredString & piece)
-                         { return s1 + piece.string; });
-
-    C2D_TextFontParse(&citroText, this->rasterizer.font, this->rasterizer.buffer, result.c_str());
-    C2D_TextOptimize(&citroText);
+    const C2D_Text * citroText = this->ParseText(text);
 
     Matrix4 t(gfx->GetTransform(), localTransform);
     C2D_ViewRestore(&t.GetElements());
 
     u32 renderColorf = C2D_Color32f(color.r, color.g, color.b, color.a);
-    C2D_DrawText(&citroText, C2D_WithColor | alignMode, offset, 0, Graphics::CURRENT_DEPTH, this->GetScale(), this->GetScale(), renderColorf, wrap);
+    C2D_DrawText(citroText, C2D_WithColor | alignMode, offset, 0, Graphics::CURRENT_DEPTH, this->GetScale(), this->GetScale(), renderColorf, wrap);
+}
 
-    C2D_TextBufClear(this->rasterizer.buffer);
+/*
+** Parsing doesn't depend on color, wrap or alignment,
+** so the string alone is the key
+** A UTF-8 string never has more glyphs than bytes, which
+** is what each cached glyph buffer gets sized to
+*/
+const C2D_Text * Font::ParseText(const std::vector<ColoredString> & text)
+{
+    this->textKey.clear();
+
+    for (const ColoredString & piece : text)
+        this->textKey.append(piece.string);
+
+    if (CachedText * cached = this->texts.Find(this->textKey))
+        return &cached->text;
+
+    size_t cost = std::max<size_t>(this->textKey.size(), 1);
+
+    if (!this->texts.Fits(cost))
+    {
+        C2D_TextBufClear(this->rasterizer.buffer);
+
+        C2D_TextFontParse(&this->scratchText, this->rasterizer.font, this->rasterizer.buffer, this->textKey.c_str());
+        C2D_TextOptimize(&this->scratchText);
+
+        return &this->scratchText;
+    }
+
+    CachedText cached;
+    cached.buffer = C2D_TextBufNew(cost);
+
+    C2D_TextFontParse(&cached.text, this->rasterizer.font, cached.buffer, this->textKey.c_str());
+    C2D_TextOptimize(&cached.text);
+
+    return &this->texts.Insert(this->textKey, std::move(cached), cost).text;
 }
 
 int Font::GetWidth(uint32_t /* prevGlyph */, uint32_t current)
 {
+    if (current < DENSE_GLYPHS && !std::isnan(this->denseWidths[current]))
+        return this->denseWidths[current];
+
     auto found = this->glyphWidths.find(current);
 
     if (found != this->glyphWidths.end())
@@ -117,7 +144,10 @@ int Font::GetWidth(uint32_t /* prevGlyph */, uint32_t current)
     int glyphIndex = C2D_FontGlyphIndexFromCodePoint(this->rasterizer.font, current);
     C2D_FontCalcGlyphPos(this->rasterizer.font, &out, glyphIndex, 0, this->GetScale(), this->GetScale());
 
-    this->glyphWidths.emplace(current, out.xAdvance);
+    if (current < DENSE_GLYPHS)
+        this->denseWidths[current] = out.xAdvance;
+    else
+        this->glyphWidths.emplace(current, out.xAdvance);
 
     return out.xAdvance;
 }
@@ -0,0 +1,59 @@
+#include "objects/particlesystem/particlesystem.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+ParticleSystem::ParticleSystem(love::Texture * texture, uint32_t size) : common::ParticleSystem(texture, size)
+{}
+
+ParticleSystem::~ParticleSystem()
+{}
+
+/*
+** citro2d has no way to submit our own vertices,
+** so each particle goes through C2D_DrawImage
+*/
+void ParticleSystem::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    if (this->count == 0)
+        return;
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+    C2D_ViewRestore(&t.GetElements());
+
+    Quad * quad = this->texture->GetQuad();
+    Quad::Viewport v = quad->GetViewport();
+
+    C2D_Image image = this->texture->GetHandle();
+    image.subtex = &quad->GetTex3DSViewport();
+
+    Colorf gfxColor = gfx->GetColor();
+    float blend = gfx->GetBlendFactor();
+
+    const float * x = this->GetField(FIELD_X);
+    const float * y = this->GetField(FIELD_Y);
+
+    C2D_DrawParams params;
+    params.depth = Graphics::CURRENT_DEPTH;
+
+    for (uint32_t index = 0; index < this->count; index++)
+    {
+        float size = this->GetParticleSize(index);
+
+        params.pos = { x[index], y[index], (float)v.w * size, (float)v.h * size };
+        params.center = { this->offset.x * size, this->offset.y * size };
+        params.angle = this->GetParticleAngle(index);
+
+        Colorf color = this->GetParticleColor(index);
+        color *= gfxColor;
+
+        C2D_ImageTint tint;
+
+        if (blend)
+            C2D_PlainImageTint(&tint, C2D_Color32f(color.r, color.g, color.b, color.a), blend);
+        else
+            C2D_AlphaImageTint(&tint, color.a);
+
+        C2D_DrawImage(image, &params, &tint);
+    }
+}
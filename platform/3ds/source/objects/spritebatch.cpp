@@ -0,0 +1,71 @@
+#include "objects/spritebatch/spritebatch.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+SpriteBatch::SpriteBatch(love::Texture * texture, int size) : common::SpriteBatch(texture, size)
+{
+    this->Resize(size);
+}
+
+SpriteBatch::~SpriteBatch()
+{}
+
+void SpriteBatch::Resize(int size)
+{
+    this->sprites.resize(size);
+}
+
+void SpriteBatch::SetSprite(int index, love::Quad * quad, const Matrix4 & m, const Colorf & color)
+{
+    Quad::Viewport v = quad->GetViewport();
+
+    this->sprites[index] = { quad->GetTex3DSViewport(), (float)v.w, (float)v.h, m, color };
+}
+
+/*
+** citro2d has no way to submit our own vertices,
+** so each sprite still goes through C2D_DrawImage.
+** Consecutive images on one texture share a draw call there.
+*/
+void SpriteBatch::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    int start = 0, count = 0;
+
+    if (!this->GetDrawSprites(start, count))
+        return;
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+
+    C2D_Image image = this->texture->GetHandle();
+    Colorf gfxColor = gfx->GetColor();
+
+    C2D_DrawParams params;
+
+    params.depth = Graphics::CURRENT_DEPTH;
+    params.angle = 0.0f;
+    params.center = {0.0f, 0.0f};
+
+    for (int index = start; index < start + count; index++)
+    {
+        Sprite & sprite = this->sprites[index];
+
+        Matrix4 spriteTransform(t, sprite.transform);
+        C2D_ViewRestore(&spriteTransform.GetElements());
+
+        image.subtex = &sprite.subtex;
+        params.pos = {0.0f, 0.0f, sprite.width, sprite.height};
+
+        Colorf color = sprite.color;
+        color *= gfxColor;
+
+        C2D_ImageTint tint;
+
+        if (float blend = gfx->GetBlendFactor())
+            C2D_PlainImageTint(&tint, C2D_Color32f(color.r, color.g, color.b, color.a), blend);
+        else
+            C2D_AlphaImageTint(&tint, color.a);
+
+        C2D_DrawImage(image, &params, &tint);
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "common/driver/hidrvc.h"
+
+/*
+** HID backend class for the headless host
+** Only the events sent through the base class are delivered
+*/
+
+namespace love::driver
+{
+    class Hidrv : public common::driver::Hidrv
+    {
+        public:
+            Hidrv();
+
+            bool Poll(LOVE_Event * event) override;
+
+            bool IsDown(size_t button) override;
+    };
+}
@@ -0,0 +1,63 @@
+/*
+** headless.h
+** @brief : Host stand-ins for the console SDK types
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+
+typedef int8_t  s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+typedef pthread_cond_t CondVar;
+
+/* pthreads may only be joined once, the consoles allow waiting again */
+struct Thread
+{
+    pthread_t handle;
+    bool joinable;
+};
+
+inline void threadWaitForExit(Thread * thread)
+{
+    if (!thread->joinable)
+        return;
+
+    pthread_join(thread->handle, nullptr);
+    thread->joinable = false;
+}
+
+inline void threadClose(Thread * thread)
+{
+    if (!thread->joinable)
+        return;
+
+    pthread_detach(thread->handle);
+    thread->joinable = false;
+}
+
+/* Like on console, sleeping for 0 gives up the rest of the timeslice */
+inline void svcSleepThread(s64 nanoseconds)
+{
+    if (nanoseconds <= 0)
+    {
+        sched_yield();
+        return;
+    }
+
+    timespec duration = { time_t(nanoseconds / 1000000000LL), long(nanoseconds % 1000000000LL) };
+    nanosleep(&duration, nullptr);
+}
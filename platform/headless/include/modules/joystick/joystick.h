@@ -0,0 +1,14 @@
+#pragma once
+
+#include "modules/joystick/joystickc.h"
+
+namespace love
+{
+    class Joystick : public common::Joystick
+    {
+        public:
+            Joystick();
+
+            virtual ~Joystick();
+    };
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "modules/system/systemc.h"
+
+namespace love
+{
+    class System : public common::System
+    {
+        public:
+            virtual ~System() {};
+
+            using common::System::GetPowerInfo;
+
+            using common::System::GetNetworkInfo;
+
+            int GetProcessorCount() override;
+
+            PowerInfo GetPowerInfo() const override;
+
+            const std::string & GetUsername() override;
+
+            NetworkInfo GetNetworkInfo() const override;
+
+            const std::string & GetLanguage() override;
+
+            const std::string & GetModel() override;
+
+            const std::string & GetRegion() override;
+
+            const std::string & GetVersion() override;
+
+            const std::string & GetFriendCode() override;
+    };
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "objects/canvas/canvasc.h"
+
+namespace love
+{
+    class Canvas : public common::Canvas
+    {
+        public:
+            Canvas(const Settings & settings);
+
+            virtual ~Canvas();
+
+            void Draw(Graphics * gfx, Quad * quad, const Matrix4 & localTransform) override;
+    };
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "objects/font/fontc.h"
+#include "common/data.h"
+
+#include "common/vertex.h"
+#include "common/lrucache.h"
+
+#include <unordered_set>
+
+enum class love::common::Font::SystemFontType : uint8_t
+{
+    TYPE_STANDARD,
+    TYPE_MAX_ENUM
+};
+
+struct Rasterizer
+{
+    int size;
+    love::Data * data;
+};
+
+namespace love
+{
+    /*
+    ** Fixed-metric stand-in for the console fonts
+    ** Glyphs are never rasterized, but every printed glyph still
+    ** produces a textured quad, and glyphs new to the atlas are
+    ** uploaded together before the draw, so the recorded stream
+    ** has the same shape as the real thing.
+    */
+    class Font : public love::common::Font
+    {
+        public:
+            Font(const Rasterizer & r, const Texture::Filter & filter);
+
+            virtual ~Font();
+
+            void Print(Graphics * gfx, const std::vector<ColoredString> & text,
+                       const Matrix4 & localTransform, const Colorf & color) override;
+
+            void Printf(Graphics * gfx, const std::vector<ColoredString> & text, float wrap, AlignMode align,
+                        const Matrix4 & localTransform, const Colorf & color) override;
+
+            int GetWidth(uint32_t prevGlyph, uint32_t codepoint) override;
+
+            using love::common::Font::GetWidth;
+
+            float GetHeight() const override;
+
+            size_t GetLayoutCacheHits() const;
+
+            size_t GetLayoutCacheMisses() const;
+
+        private:
+            struct Glyph
+            {
+                uint32_t codepoint;
+                Colorf color;
+            };
+
+            typedef std::vector<Glyph> Line;
+
+            static constexpr int GLYPHS_PER_ROW = 16;
+
+            Rasterizer rasterizer;
+            uint32_t handle;
+
+            /* Glyphs in the atlas, and those still waiting to be uploaded */
+            std::unordered_set<uint32_t> loaded;
+            std::vector<uint32_t> pendingGlyphs;
+
+            void FlushGlyphs();
+
+            /* Kept between prints, so steady text doesn't allocate */
+            Line glyphs;
+            std::vector<Line> lines;
+            std::vector<vertex::Vertex> vertices;
+
+            /* Start line @index of @lines empty, adding it if needed */
+            Line & NextLine(size_t index);
+
+            /* Laid out text, before the transform; cached like the Switch font's */
+            typedef std::vector<vertex::Vertex> Layout;
+
+            static constexpr size_t MAX_LAYOUTS = 64;
+
+            LRUCache<std::string, Layout> layouts;
+            std::string layoutKey;
+
+            const Layout & GetLayout(const std::vector<ColoredString> & text, const Colorf & color,
+                                     bool formatted, float wrap = 0.0f, AlignMode align = ALIGN_LEFT);
+
+            void LayoutLines();
+
+            void LayoutWrapped(float wrap, AlignMode align);
+
+            void GetGlyphs(const std::vector<ColoredString> & text, const Colorf & color, Line & glyphs);
+
+            int GetLineWidth(const Line & line);
+
+            void AddGlyphs(const Line & line, float x, float y, std::vector<vertex::Vertex> & vertices);
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform, std::vector<vertex::Vertex> & vertices);
+    };
+}
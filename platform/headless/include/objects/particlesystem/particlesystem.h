@@ -0,0 +1,22 @@
+#pragma once
+
+#include "objects/particlesystem/particlesystemc.h"
+#include "common/vertex.h"
+
+namespace love
+{
+    class ParticleSystem : public common::ParticleSystem
+    {
+        public:
+            static constexpr int VERTICES_PER_PARTICLE = 4;
+
+            ParticleSystem(love::Texture * texture, uint32_t size);
+
+            virtual ~ParticleSystem();
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+
+        private:
+            std::vector<vertex::Vertex> vertices;
+    };
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "objects/spritebatch/spritebatchc.h"
+#include "common/vertex.h"
+
+namespace love
+{
+    class SpriteBatch : public common::SpriteBatch
+    {
+        public:
+            static constexpr int VERTICES_PER_SPRITE = 4;
+
+            SpriteBatch(love::Texture * texture, int size);
+
+            virtual ~SpriteBatch();
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+
+        protected:
+            void SetSprite(int index, love::Quad * quad, const Matrix4 & m, const Colorf & color) override;
+
+            void Resize(int size) override;
+
+        private:
+            std::vector<vertex::Vertex> vertices;
+    };
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "objects/text/textc.h"
+
+namespace love
+{
+    class Text : public common::Text
+    {
+        public:
+            Text(love::Font * font, const std::vector<Font::ColoredString> & text = {});
+
+            virtual ~Text();
+
+            void SetFont(love::Font * font) override;
+
+            void Set(const std::vector<Font::ColoredString> & text) override;
+
+            void Set(const std::vector<Font::ColoredString> & text, float wrap, Font::AlignMode align) override;
+
+            int Add(const std::vector<Font::ColoredString> & text, const Matrix4 & localTransform) override;
+
+            int Addf(const std::vector<Font::ColoredString> & text, float wrap, Font::AlignMode align, const Matrix4 & localTransform) override;
+
+            int GetWidth(int index = 0) const override;
+
+            int GetHeight(int index = 0) const override;
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+
+            void Clear() override;
+
+        private:
+            struct TextEntry
+            {
+                std::vector<Font::ColoredString> text;
+
+                float wrap;
+                Font::AlignMode align;
+
+                Matrix4 localTransform;
+            };
+
+            std::vector<TextEntry> entries;
+    };
+}
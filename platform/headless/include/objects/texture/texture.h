@@ -0,0 +1,31 @@
+#pragma once
+
+#include "objects/texture/texturec.h"
+
+namespace love
+{
+    class Texture : public common::Texture
+    {
+        public:
+            Texture(TextureType type);
+
+            virtual ~Texture();
+
+            void SetHandle(uint32_t handle);
+
+            uint32_t GetHandle();
+
+            static constexpr int TEXTURE_QUAD_POINT_COUNT = 4;
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+
+            void Draw(Graphics * gfx, love::Quad * quad, const Matrix4 & localTransform) override;
+
+            bool SetWrap(const Wrap & wrap) override;
+
+            void SetFilter(const Filter & filter) override;
+
+        protected:
+            uint32_t handle;
+    };
+}
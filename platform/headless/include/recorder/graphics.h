@@ -0,0 +1,69 @@
+#pragma once
+
+#include "modules/graphics/graphics.h"
+
+#include "recorder/recorder.h"
+
+#define RENDERER_NAME    "recorder"
+#define RENDERER_VERSION "0.1.0"
+#define RENDERER_VENDOR  "LÖVE Potion"
+#define RENDERER_DEVICE  "Headless"
+
+enum class love::Graphics::Screen : uint8_t
+{
+    SCREEN_DEFAULT,
+    SCREEN_MAX_ENUM
+};
+
+namespace love::recorder
+{
+    class Graphics : public love::Graphics
+    {
+        public:
+            Graphics();
+
+            virtual ~Graphics();
+
+            Screen GetActiveScreen() const override;
+
+            std::vector<std::string> GetScreens() const override;
+
+            const int GetWidth(Screen screen) const override;
+
+            const int GetHeight() const override;
+
+            void SetActiveScreen(Screen screen) override;
+
+            void Clear(std::optional<Colorf> color, std::optional<int> stencil, std::optional<double> depth) override;
+
+            void Present() override;
+
+            void SetScissor(const Rect & scissor) override;
+
+            void SetScissor() override;
+
+            /* Primitives */
+
+            void Polygon(DrawMode mode, const Vector2 * points, size_t size, bool skipLastFilledVertex = true) override;
+
+            void Points(const Vector2 * points, size_t count, const Colorf * colors, size_t colorCount) override;
+
+            void SetPointSize(float size) override;
+
+            void SetLineWidth(float width) override;
+
+            /* End Primitives */
+
+            void SetBlendMode(BlendMode mode, BlendAlpha alpha) override;
+
+            void SetColorMask(ColorMask mask) override;
+
+            Font * NewDefaultFont(int size, const Texture::Filter & filter = Texture::defaultFilter) override;
+
+            Font * NewFont(const Rasterizer & rasterizer, const Texture::Filter & filter = Texture::defaultFilter) override;
+
+            RendererInfo GetRendererInfo() const override;
+
+            Stats GetStats() const override;
+    };
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "common/lmath.h"
+#include "common/colors.h"
+#include "common/matrix.h"
+#include "common/framearena.h"
+
+#include "objects/canvas/canvas.h"
+#include "common/vertex.h"
+
+#include <chrono>
+#include <vector>
+
+/*
+** Headless renderer
+** Instead of talking to a GPU, every draw is appended to an
+** in-memory vertex and command stream. Present closes the frame,
+** updates the statistics and starts recording the next one.
+*/
+class recorder
+{
+    private:
+        recorder();
+
+    public:
+        static constexpr uint32_t FRAMEBUFFER_WIDTH  = 1280;
+        static constexpr uint32_t FRAMEBUFFER_HEIGHT = 720;
+
+        enum CommandType
+        {
+            COMMAND_BIND_FRAMEBUFFER,
+            COMMAND_CLEAR,
+            COMMAND_SCISSOR,
+            COMMAND_DRAW,
+            COMMAND_UPLOAD,
+            COMMAND_MAX_ENUM
+        };
+
+        enum Primitive
+        {
+            PRIMITIVE_TRIANGLE_FAN,
+            PRIMITIVE_LINE_STRIP,
+            PRIMITIVE_POINTS,
+            PRIMITIVE_QUADS,
+            PRIMITIVE_MAX_ENUM
+        };
+
+        struct Command
+        {
+            CommandType type;
+            Primitive primitive;
+
+            uint32_t texture;
+
+            uint32_t firstVertex;
+            uint32_t vertexCount;
+        };
+
+        struct FrameStats
+        {
+            double cpuTime;
+
+            size_t vertices;
+            size_t commands;
+            size_t draws;
+            size_t uploads;
+        };
+
+        static recorder & Instance();
+
+        ~recorder();
+
+        void BindFramebuffer(love::Canvas * canvas = nullptr);
+
+        void ClearColor(const Colorf & color);
+
+        void SetScissor(const love::Rect & scissor);
+
+        void Present();
+
+        uint32_t RegisterTexture();
+
+        /* Copy @regions rectangles into texture @handle in one submission */
+        void UploadTexture(uint32_t handle, size_t regions);
+
+        bool RenderTexture(uint32_t handle, const vertex::Vertex * points, size_t count);
+
+        /*
+        ** Resident vertex data, @transform and @color are
+        ** applied to the recorded copy the way a shader would
+        */
+        bool RenderTexture(uint32_t handle, const vertex::Vertex * points, size_t count,
+                           const love::Matrix4 & transform, const Colorf & color);
+
+        /* Primitives Rendering */
+
+        bool RenderPolygon(const vertex::Vertex * points, size_t count);
+
+        bool RenderPolyline(const vertex::Vertex * points, size_t count);
+
+        bool RenderPoints(const vertex::Vertex * points, size_t count);
+
+        /* Recorded stream for the frame in progress */
+
+        const std::vector<vertex::Vertex> & GetVertices() const;
+
+        const std::vector<Command> & GetCommands() const;
+
+        /* Scratch memory for geometry built this frame, reset at Present */
+        love::FrameArena & GetFrameArena();
+
+        /* Statistics */
+
+        const FrameStats & GetLastFrame() const;
+
+        size_t GetFrameCount() const;
+
+        FrameStats GetAverageFrame() const;
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        bool Record(Primitive primitive, uint32_t texture, const vertex::Vertex * points, size_t count);
+
+        std::vector<vertex::Vertex> vertices;
+        std::vector<Command> commands;
+
+        love::FrameArena arena;
+
+        size_t draws;
+        size_t uploads;
+
+        uint32_t nextTexture;
+
+        Clock::time_point frameStart;
+
+        FrameStats lastFrame;
+        FrameStats totals;
+
+        size_t frameCount;
+};
@@ -0,0 +1,51 @@
+-- Draws a few frames through every recorded primitive, then quits
+-- Run with `make smoke`, a non-zero exit status means something failed
+
+local FRAMES = 60
+
+local frame = 0
+local batch, text
+
+function love.load()
+    local font = love.graphics.newFont(14)
+    text = love.graphics.newText(font, "headless")
+
+    local canvas = love.graphics.newCanvas(64, 64)
+    batch = love.graphics.newSpriteBatch(canvas, 16)
+
+    for index = 1, 16 do
+        batch:add(index * 8, index * 4)
+    end
+
+    local channel = love.thread.getChannel("smoke")
+    channel:push("ping")
+
+    assert(channel:pop() == "ping")
+end
+
+function love.update(dt)
+    frame = frame + 1
+
+    if frame >= FRAMES then
+        love.event.quit()
+    end
+end
+
+function love.draw()
+    love.graphics.setColor(1, 0.5, 0.25)
+
+    love.graphics.rectangle("fill", 10, 10, 100, 50)
+    love.graphics.rectangle("line", 10, 70, 100, 50, 8, 8)
+
+    love.graphics.circle("fill", 200, 200, 32)
+    love.graphics.ellipse("line", 300, 200, 40, 20)
+    love.graphics.arc("fill", "pie", 400, 200, 30, 0, math.pi)
+
+    love.graphics.line(0, 0, 100, 100, 200, 0)
+    love.graphics.points(5, 5, 10, 10)
+
+    love.graphics.draw(batch)
+    love.graphics.draw(text, 20, 300)
+
+    love.graphics.print("frame " .. frame, 20, 400)
+end
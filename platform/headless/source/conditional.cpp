@@ -0,0 +1,49 @@
+#include "modules/thread/types/conditional.h"
+
+#include <time.h>
+
+using namespace love::thread;
+
+Conditional::Conditional()
+{
+    pthread_cond_init(&this->condVar, nullptr);
+}
+
+Conditional::~Conditional()
+{
+    pthread_cond_destroy(&this->condVar);
+}
+
+void Conditional::Signal()
+{
+    pthread_cond_signal(&this->condVar);
+}
+
+void Conditional::Broadcast()
+{
+    pthread_cond_broadcast(&this->condVar);
+}
+
+/* @timeout is in nanoseconds, like on console */
+bool Conditional::Wait(thread::Mutex * _mutex, s64 timeout)
+{
+    if (timeout < 0)
+    {
+        pthread_cond_wait(&this->condVar, &_mutex->mutex);
+        return true;
+    }
+
+    timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+
+    deadline.tv_sec  += timeout / 1000000000LL;
+    deadline.tv_nsec += timeout % 1000000000LL;
+
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec  += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    return pthread_cond_timedwait(&this->condVar, &_mutex->mutex, &deadline) == 0;
+}
@@ -0,0 +1,22 @@
+#include "driver/hidrv.h"
+
+using namespace love::driver;
+
+Hidrv::Hidrv()
+{}
+
+bool Hidrv::IsDown(size_t button)
+{
+    return false;
+}
+
+bool Hidrv::Poll(LOVE_Event * event)
+{
+    if (this->events.empty())
+        return false;
+
+    *event = this->events.front();
+    this->events.pop_front();
+
+    return true;
+}
@@ -0,0 +1,7 @@
+#include "modules/event/event.h"
+
+love::Event::Event()
+{}
+
+love::Event::~Event()
+{}
@@ -0,0 +1,9 @@
+#include "modules/joystick/joystick.h"
+
+using namespace love;
+
+Joystick::Joystick()
+{}
+
+Joystick::~Joystick()
+{}
@@ -0,0 +1,37 @@
+#include "modules/keyboard/keyboard.h"
+
+using namespace love;
+
+Keyboard::Keyboard() : common::Keyboard((MAX_INPUT_LENGTH * 4) + 1)
+{}
+
+std::string Keyboard::SetTextInput(const Keyboard::SwkbdOpt & options)
+{
+    uint32_t maxLength = this->CalculateEncodingMaxLength(options.maxLength);
+
+    return options.hint.substr(0, maxLength);
+}
+
+bool Keyboard::GetConstant(const char * in, KeyboardType & out)
+{
+    return keyboardTypes.Find(in, out);
+}
+
+bool Keyboard::GetConstant(KeyboardType in, const char *& out)
+{
+    return keyboardTypes.Find(in, out);
+}
+
+std::vector<std::string> Keyboard::GetConstants(KeyboardType)
+{
+    return keyboardTypes.GetNames();
+}
+
+StringMap<Keyboard::KeyboardType, uint8_t(Keyboard::KeyboardType::TYPE_MAX_ENUM)>::Entry Keyboard::keyboardTypeEntries[] =
+{
+    { "normal", KeyboardType::TYPE_NORMAL },
+    { "qwerty", KeyboardType::TYPE_QWERTY },
+    { "numpad", KeyboardType::TYPE_NUMPAD }
+};
+
+StringMap<Keyboard::KeyboardType, uint8_t(Keyboard::KeyboardType::TYPE_MAX_ENUM)> Keyboard::keyboardTypes(Keyboard::keyboardTypeEntries, sizeof(Keyboard::keyboardTypeEntries));
@@ -0,0 +1,80 @@
+#include "modules/system/system.h"
+
+#include "common/results.h"
+
+#include <thread>
+
+using namespace love;
+
+int System::GetProcessorCount()
+{
+    if (this->systemInfo.processors == 0)
+        this->systemInfo.processors = std::max(1u, std::thread::hardware_concurrency());
+
+    return this->systemInfo.processors;
+}
+
+love::System::PowerInfo System::GetPowerInfo() const
+{
+    PowerInfo info;
+    info.percentage = 100;
+    info.state = "charged";
+
+    return info;
+}
+
+love::System::NetworkInfo System::GetNetworkInfo() const
+{
+    NetworkInfo info;
+    info.signal = 0;
+    info.status = "disconnected";
+
+    return info;
+}
+
+/* The remaining values are fixed so recorded runs compare equal across hosts */
+
+const std::string & System::GetUsername()
+{
+    if (this->systemInfo.username.empty())
+        this->systemInfo.username = "LÖVE Potion";
+
+    return this->systemInfo.username;
+}
+
+const std::string & System::GetLanguage()
+{
+    if (this->systemInfo.language.empty())
+        this->systemInfo.language = "en-US";
+
+    return this->systemInfo.language;
+}
+
+const std::string & System::GetModel()
+{
+    if (this->systemInfo.model.empty())
+        this->systemInfo.model = "Headless";
+
+    return this->systemInfo.model;
+}
+
+const std::string & System::GetRegion()
+{
+    if (this->systemInfo.region.empty())
+        this->systemInfo.region = "USA";
+
+    return this->systemInfo.region;
+}
+
+const std::string & System::GetVersion()
+{
+    if (this->systemInfo.version.empty())
+        this->systemInfo.version = "0.0.0";
+
+    return this->systemInfo.version;
+}
+
+const std::string & System::GetFriendCode()
+{
+    return LOVE_STRING_EMPTY;
+}
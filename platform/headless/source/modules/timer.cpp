@@ -0,0 +1,24 @@
+#include "modules/timer/timer.h"
+
+#include <chrono>
+
+using namespace love;
+
+static uint64_t GetTicks()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+static constexpr auto NS_TO_SEC = 1000000000.0;
+
+Timer::Timer()
+{
+    Timer::reference = GetTicks();
+    this->prevFPSUpdate = currentTime = this->GetTime();
+}
+
+double common::Timer::GetTime()
+{
+    return (GetTicks() - Timer::reference) / NS_TO_SEC;
+}
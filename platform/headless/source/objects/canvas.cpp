@@ -0,0 +1,26 @@
+#include "objects/canvas/canvas.h"
+
+#include "recorder/recorder.h"
+
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+Canvas::Canvas(const Canvas::Settings & settings) : common::Canvas(settings)
+{
+    // Clear to transparent black
+    ::recorder::Instance().BindFramebuffer(this);
+    ::recorder::Instance().ClearColor({0, 0, 0, 0});
+    ::recorder::Instance().BindFramebuffer();
+}
+
+Canvas::~Canvas()
+{}
+
+void Canvas::Draw(Graphics * gfx, Quad * quad, const Matrix4 & localTransform)
+{
+    if (gfx->IsCanvasActive(this))
+        throw love::Exception("Cannot render a Canvas to itself!");
+
+    Texture::Draw(gfx, quad, localTransform);
+}
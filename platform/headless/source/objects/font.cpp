@@ -0,0 +1,303 @@
+#include "objects/font/font.h"
+#include "modules/graphics/graphics.h"
+
+#include "recorder/recorder.h"
+#include "common/utf8decode.h"
+
+using namespace love;
+
+Font::Font(const Rasterizer & rasterizer, const Texture::Filter & filter) : rasterizer(rasterizer),
+                                                                            handle(::recorder::Instance().RegisterTexture()),
+                                                                            layouts(MAX_LAYOUTS)
+{
+    this->lineHeight = 1.0f;
+    this->filter = filter;
+}
+
+Font::~Font()
+{
+    if (this->rasterizer.data != nullptr)
+        this->rasterizer.data->Release();
+}
+
+common::Font * common::Font::GetSystemFontByType(int size, Font::SystemFontType type, const Texture::Filter & filter)
+{
+    const Rasterizer rasterizer =
+    {
+        .size = size,
+        .data = nullptr
+    };
+
+    return new love::Font(rasterizer, filter);
+}
+
+int Font::GetWidth(uint32_t /* prevGlyph */, uint32_t current)
+{
+    return (this->rasterizer.size + 1) / 2;
+}
+
+float Font::GetHeight() const
+{
+    return this->rasterizer.size;
+}
+
+void Font::GetGlyphs(const std::vector<ColoredString> & text, const Colorf & color, Line & glyphs)
+{
+    for (const ColoredString & piece : text)
+    {
+        Colorf pieceColor = piece.color;
+        pieceColor *= color;
+
+        UTF8::ForEach(piece.string.data(), piece.string.size(), [&](uint32_t codepoint)
+        {
+            glyphs.push_back({ codepoint, pieceColor });
+        });
+    }
+}
+
+int Font::GetLineWidth(const Line & line)
+{
+    int width = 0;
+    uint32_t prevGlyph = 0;
+
+    for (const Glyph & glyph : line)
+    {
+        width += this->GetWidth(prevGlyph, glyph.codepoint);
+        prevGlyph = glyph.codepoint;
+    }
+
+    return width;
+}
+
+/*
+** Every visible glyph becomes one quad, with texture coordinates
+** picked from a 16x16 cell grid like a real atlas would have
+*/
+void Font::AddGlyphs(const Line & line, float x, float y, std::vector<vertex::Vertex> & vertices)
+{
+    float height = this->GetHeight();
+    float cell = 1.0f / GLYPHS_PER_ROW;
+
+    for (const Glyph & glyph : line)
+    {
+        float advance = this->GetWidth(0, glyph.codepoint);
+
+        if (glyph.codepoint != ' ' && glyph.codepoint != '\t' && glyph.codepoint != '\r')
+        {
+            uint32_t index = glyph.codepoint % (GLYPHS_PER_ROW * GLYPHS_PER_ROW);
+
+            if (this->loaded.insert(glyph.codepoint).second)
+                this->pendingGlyphs.push_back(glyph.codepoint);
+
+            float s = (index % GLYPHS_PER_ROW) * cell;
+            float t = (index / GLYPHS_PER_ROW) * cell;
+
+            const Vector2 positions[4] =
+            {
+                { x, y }, { x, y + height }, { x + advance, y + height }, { x + advance, y }
+            };
+
+            const Vector2 texcoords[4] =
+            {
+                { s, t }, { s, t + cell }, { s + cell, t + cell }, { s + cell, t }
+            };
+
+            size_t first = vertices.size();
+            vertices.resize(first + 4);
+
+            vertex::GenerateTextureFromVectors(vertices.data() + first, positions, texcoords, 4, glyph.color);
+        }
+
+        x += advance;
+    }
+}
+
+/* Everything added since the last draw goes up as one upload */
+void Font::FlushGlyphs()
+{
+    if (this->pendingGlyphs.empty())
+        return;
+
+    ::recorder::Instance().UploadTexture(this->handle, this->pendingGlyphs.size());
+    this->pendingGlyphs.clear();
+}
+
+void Font::Draw(Graphics * gfx, const Matrix4 & localTransform, std::vector<vertex::Vertex> & vertices)
+{
+    if (vertices.empty())
+        return;
+
+    this->FlushGlyphs();
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+
+    for (vertex::Vertex & vertex : vertices)
+    {
+        Vector2 point(vertex.position[0], vertex.position[1]);
+        t.TransformXY(&point, &point, 1);
+
+        vertex.position[0] = point.x;
+        vertex.position[1] = point.y;
+    }
+
+    ::recorder::Instance().RenderTexture(this->handle, vertices.data(), vertices.size());
+}
+
+Font::Line & Font::NextLine(size_t index)
+{
+    if (index == this->lines.size())
+        this->lines.emplace_back();
+
+    this->lines[index].clear();
+
+    return this->lines[index];
+}
+
+void Font::Print(Graphics * gfx, const std::vector<ColoredString> & text,
+                 const Matrix4 & localTransform, const Colorf & color)
+{
+    const Layout & layout = this->GetLayout(text, color, false);
+
+    this->vertices.assign(layout.begin(), layout.end());
+    this->Draw(gfx, localTransform, this->vertices);
+}
+
+void Font::Printf(Graphics * gfx, const std::vector<ColoredString> & text, float wrap, AlignMode align,
+                  const Matrix4 & localTransform, const Colorf & color)
+{
+    const Layout & layout = this->GetLayout(text, color, true, wrap, align);
+
+    this->vertices.assign(layout.begin(), layout.end());
+    this->Draw(gfx, localTransform, this->vertices);
+}
+
+const Font::Layout & Font::GetLayout(const std::vector<ColoredString> & text, const Colorf & color,
+                                     bool formatted, float wrap, AlignMode align)
+{
+    Font::GetLayoutKey(this->layoutKey, text, color, formatted, wrap, align);
+
+    if (Layout * cached = this->layouts.Find(this->layoutKey))
+        return *cached;
+
+    this->glyphs.clear();
+    this->GetGlyphs(text, color, this->glyphs);
+
+    this->vertices.clear();
+
+    if (formatted)
+        this->LayoutWrapped(wrap, align);
+    else
+        this->LayoutLines();
+
+    return this->layouts.Insert(this->layoutKey, Layout(this->vertices));
+}
+
+size_t Font::GetLayoutCacheHits() const
+{
+    return this->layouts.GetHits();
+}
+
+size_t Font::GetLayoutCacheMisses() const
+{
+    return this->layouts.GetMisses();
+}
+
+/* Lay out @glyphs into @vertices, breaking only at newlines */
+void Font::LayoutLines()
+{
+    Line & line = this->NextLine(0);
+    float y = 0.0f;
+
+    for (const Glyph & glyph : this->glyphs)
+    {
+        if (glyph.codepoint == '\n')
+        {
+            this->AddGlyphs(line, 0.0f, y, this->vertices);
+            y += floorf(this->GetHeight() * this->GetLineHeight() + 0.5f);
+
+            line.clear();
+            continue;
+        }
+
+        line.push_back(glyph);
+    }
+
+    this->AddGlyphs(line, 0.0f, y, this->vertices);
+}
+
+/* Lay out @glyphs into @vertices, wrapped at @wrap and aligned */
+void Font::LayoutWrapped(float wrap, AlignMode align)
+{
+    /* Greedy word wrap: break at the last space that still fits */
+    this->NextLine(0);
+    size_t count = 1;
+
+    for (const Glyph & glyph : this->glyphs)
+    {
+        if (glyph.codepoint == '\n')
+        {
+            this->NextLine(count++);
+            continue;
+        }
+
+        Line & current = this->lines[count - 1];
+        current.push_back(glyph);
+
+        if (this->GetLineWidth(current) <= wrap || current.size() == 1)
+            continue;
+
+        /* Adding a line may move the others */
+        Line & next = this->NextLine(count++);
+        Line & previous = this->lines[count - 2];
+
+        auto space = std::find_if(previous.rbegin(), previous.rend(), [](const Glyph & g) {
+            return g.codepoint == ' ';
+        });
+
+        if (space != previous.rend())
+        {
+            auto split = space.base();
+            next.assign(split, previous.end());
+            previous.erase(split - 1, previous.end());
+        }
+        else
+        {
+            next.push_back(previous.back());
+            previous.pop_back();
+        }
+    }
+
+    float y = 0.0f;
+
+    for (size_t index = 0; index < count; index++)
+    {
+        const Line & line = this->lines[index];
+
+        float width = this->GetLineWidth(line);
+        float x = 0.0f;
+
+        switch (align)
+        {
+            case ALIGN_RIGHT:
+                x = floorf(wrap - width);
+                break;
+            case ALIGN_CENTER:
+                x = floorf((wrap - width) / 2.0f);
+                break;
+            case ALIGN_LEFT:
+            case ALIGN_JUSTIFY:
+            default:
+                break;
+        }
+
+        this->AddGlyphs(line, x, y, this->vertices);
+        y += floorf(this->GetHeight() * this->GetLineHeight() + 0.5f);
+    }
+}
+
+StringMap<Font::SystemFontType, Font::MAX_SYSFONTS>::Entry common::Font::sharedFontEntries[] =
+{
+    { "standard", SystemFontType::TYPE_STANDARD }
+};
+
+StringMap<Font::SystemFontType, Font::MAX_SYSFONTS> common::Font::sharedFonts(Font::sharedFontEntries, sizeof(Font::sharedFontEntries));
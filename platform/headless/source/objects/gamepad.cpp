@@ -0,0 +1,101 @@
+#include "objects/gamepad/gamepad.h"
+
+using namespace love;
+
+Gamepad::Gamepad(size_t id) : common::Gamepad(id)
+{}
+
+Gamepad::Gamepad(size_t id, size_t index) : common::Gamepad(id)
+{
+    this->Open(index);
+}
+
+Gamepad::~Gamepad()
+{
+    this->Close();
+}
+
+/*
+** None are opened at startup; one only connects when a
+** gamepadadded event asks for it, and it never moves
+*/
+bool Gamepad::Open(size_t index)
+{
+    this->Close();
+
+    this->instanceID = (int8_t)index;
+    this->name       = "Headless Gamepad";
+
+    return true;
+}
+
+void Gamepad::Close()
+{
+    this->instanceID = -1;
+    this->vibration = Vibration();
+}
+
+bool Gamepad::IsConnected() const
+{
+    return this->instanceID != -1;
+}
+
+const char * Gamepad::GetName() const
+{
+    return this->name.c_str();
+}
+
+size_t Gamepad::GetAxisCount() const
+{
+    return 0;
+}
+
+size_t Gamepad::GetButtonCount() const
+{
+    return 0;
+}
+
+float Gamepad::GetAxis(size_t axis) const
+{
+    return 0.0f;
+}
+
+std::vector<float> Gamepad::GetAxes() const
+{
+    return {};
+}
+
+bool Gamepad::IsDown(const std::vector<size_t> & buttons) const
+{
+    return false;
+}
+
+float Gamepad::GetGamepadAxis(GamepadAxis axis) const
+{
+    return 0.0f;
+}
+
+bool Gamepad::IsGamepadDown(const std::vector<GamepadButton> & buttons) const
+{
+    return false;
+}
+
+bool Gamepad::IsVibrationSupported()
+{
+    return false;
+}
+
+bool Gamepad::SetVibration(float left, float right, float duration)
+{
+    return false;
+}
+
+bool Gamepad::SetVibration()
+{
+    return false;
+}
+
+void Gamepad::GetVibration(float & left, float & right)
+{
+    left = right = 0.0f;
+}
@@ -0,0 +1,91 @@
+#include "objects/image/image.h"
+
+using namespace love;
+
+/*
+** Nothing is uploaded anywhere, but draws still need the real
+** dimensions. Pull them out of the PNG or JPEG headers.
+*/
+static bool GetImageDimensions(const uint8_t * data, size_t size, int & width, int & height)
+{
+    static constexpr uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+
+    const auto readBigEndian = [](const uint8_t * in, size_t bytes) -> uint32_t
+    {
+        uint32_t value = 0;
+        for (size_t index = 0; index < bytes; index++)
+            value = (value << 8) | in[index];
+
+        return value;
+    };
+
+    /* The IHDR chunk always comes first */
+    if (size >= 24 && memcmp(data, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) == 0)
+    {
+        width  = (int)readBigEndian(data + 16, 4);
+        height = (int)readBigEndian(data + 20, 4);
+
+        return true;
+    }
+
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8)
+        return false;
+
+    /* Walk the JPEG segments until a start-of-frame marker */
+    size_t offset = 2;
+
+    while (offset + 9 < size)
+    {
+        if (data[offset] != 0xFF)
+            return false;
+
+        uint8_t marker = data[offset + 1];
+        uint32_t length = readBigEndian(data + offset + 2, 2);
+
+        bool isFrame = (marker >= 0xC0 && marker <= 0xCF) && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+
+        if (isFrame)
+        {
+            height = (int)readBigEndian(data + offset + 5, 2);
+            width  = (int)readBigEndian(data + offset + 7, 2);
+
+            return true;
+        }
+
+        offset += length + 2;
+    }
+
+    return false;
+}
+
+Image::Image(Data * data) : Texture(Texture::TEXTURE_2D)
+{
+    int width = 0, height = 0;
+
+    if (!GetImageDimensions((const uint8_t *)data->GetData(), data->GetSize(), width, height))
+        throw love::Exception("Failed to upload Image data.");
+
+    this->Init(width, height);
+
+    this->SetFilter(this->filter);
+    this->SetWrap(this->wrap);
+}
+
+Image::~Image()
+{}
+
+Image::Image(TextureType type, int width, int height) : Texture(type)
+{
+    this->Init(width, height);
+
+    this->SetFilter(this->filter);
+    this->SetWrap(this->wrap);
+}
+
+void Image::Init(int width, int height)
+{
+    this->width = width;
+    this->height = height;
+
+    this->InitQuad();
+}
@@ -0,0 +1,30 @@
+#include "objects/particlesystem/particlesystem.h"
+#include "modules/graphics/graphics.h"
+
+#include "recorder/recorder.h"
+
+using namespace love;
+
+ParticleSystem::ParticleSystem(love::Texture * texture, uint32_t size) : common::ParticleSystem(texture, size)
+{}
+
+ParticleSystem::~ParticleSystem()
+{}
+
+void ParticleSystem::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    if (this->count == 0)
+        return;
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+
+    this->vertices.resize(this->count * VERTICES_PER_PARTICLE);
+
+    Quad * quad = this->texture->GetQuad();
+
+    this->GenerateVertices(this->vertices.data(), quad->GetVertexPositions(), quad->GetVertexTexCoords(),
+                           Colorf(1.0f, 1.0f, 1.0f, 1.0f));
+
+    ::recorder::Instance().RenderTexture(this->texture->GetHandle(), this->vertices.data(), this->vertices.size(),
+                                         t, gfx->GetColor());
+}
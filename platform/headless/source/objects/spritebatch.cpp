@@ -0,0 +1,43 @@
+#include "objects/spritebatch/spritebatch.h"
+#include "modules/graphics/graphics.h"
+
+#include "recorder/recorder.h"
+
+using namespace love;
+
+SpriteBatch::SpriteBatch(love::Texture * texture, int size) : common::SpriteBatch(texture, size)
+{
+    this->Resize(size);
+}
+
+SpriteBatch::~SpriteBatch()
+{}
+
+void SpriteBatch::Resize(int size)
+{
+    this->vertices.resize(size * VERTICES_PER_SPRITE);
+}
+
+void SpriteBatch::SetSprite(int index, love::Quad * quad, const Matrix4 & m, const Colorf & color)
+{
+    Vector2 transformed[VERTICES_PER_SPRITE];
+    m.TransformXY(transformed, quad->GetVertexPositions(), VERTICES_PER_SPRITE);
+
+    vertex::GenerateTextureFromVectors(this->vertices.data() + index * VERTICES_PER_SPRITE, transformed,
+                                       quad->GetVertexTexCoords(), VERTICES_PER_SPRITE, color);
+}
+
+void SpriteBatch::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    int start = 0, count = 0;
+
+    if (!this->GetDrawSprites(start, count))
+        return;
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+
+    const vertex::Vertex * points = this->vertices.data() + start * VERTICES_PER_SPRITE;
+
+    ::recorder::Instance().RenderTexture(this->texture->GetHandle(), points, count * VERTICES_PER_SPRITE,
+                                         t, gfx->GetColor());
+}
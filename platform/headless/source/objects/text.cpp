@@ -0,0 +1,89 @@
+#include "objects/text/text.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+Text::Text(love::Font * font, const std::vector<Font::ColoredString> & text) : common::Text(font, text)
+{
+    this->Set(text);
+}
+
+Text::~Text()
+{}
+
+void Text::SetFont(love::Font * font)
+{
+    this->font.Set(font);
+}
+
+void Text::Set(const std::vector<Font::ColoredString> & text)
+{
+    return this->Set(text, -1.0f, Font::ALIGN_MAX_ENUM);
+}
+
+void Text::Set(const std::vector<Font::ColoredString> & text, float wrap, Font::AlignMode align)
+{
+    this->Clear();
+
+    if (text.empty() || (text.size() == 1 && text[0].string.empty()))
+        return;
+
+    this->Addf(text, wrap, align, Matrix4());
+}
+
+int Text::Add(const std::vector<Font::ColoredString> & text, const Matrix4 & localTransform)
+{
+    return this->Addf(text, -1.0f, Font::ALIGN_MAX_ENUM, localTransform);
+}
+
+int Text::Addf(const std::vector<Font::ColoredString> & text, float wrap, Font::AlignMode align, const Matrix4 & localTransform)
+{
+    this->entries.push_back({ text, wrap, align, localTransform });
+
+    return (int)this->entries.size() - 1;
+}
+
+int Text::GetWidth(int index) const
+{
+    if (index < 0 || index >= (int)this->entries.size())
+        return 0;
+
+    const TextEntry & entry = this->entries[index];
+
+    if (entry.align != Font::ALIGN_MAX_ENUM)
+        return (int)entry.wrap;
+
+    std::string string;
+    for (const Font::ColoredString & piece : entry.text)
+        string += piece.string;
+
+    return this->font->GetWidth(string);
+}
+
+int Text::GetHeight(int index) const
+{
+    if (index < 0 || index >= (int)this->entries.size())
+        return 0;
+
+    return this->font->GetHeight();
+}
+
+void Text::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    Colorf color = gfx->GetColor();
+
+    for (const TextEntry & entry : this->entries)
+    {
+        Matrix4 t(localTransform, entry.localTransform);
+
+        if (entry.align == Font::ALIGN_MAX_ENUM)
+            this->font->Print(gfx, entry.text, t, color);
+        else
+            this->font->Printf(gfx, entry.text, entry.wrap, entry.align, t, color);
+    }
+}
+
+void Text::Clear()
+{
+    this->entries.clear();
+}
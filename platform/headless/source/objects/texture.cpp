@@ -0,0 +1,57 @@
+#include "objects/texture/texture.h"
+#include "modules/graphics/graphics.h"
+
+#include "common/vector.h"
+#include "common/matrix.h"
+
+#include "recorder/recorder.h"
+
+using namespace love;
+
+Texture::Texture(TextureType type) : common::Texture(type),
+                                     handle(::recorder::Instance().RegisterTexture())
+{}
+
+Texture::~Texture()
+{}
+
+void Texture::SetHandle(uint32_t handle)
+{
+    this->handle = handle;
+}
+
+uint32_t Texture::GetHandle()
+{
+    return this->handle;
+}
+
+bool Texture::SetWrap(const Wrap & wrap)
+{
+    this->wrap = wrap;
+    return true;
+}
+
+void Texture::SetFilter(const Filter & filter)
+{
+    this->filter = filter;
+}
+
+void Texture::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    this->Draw(gfx, this->quad, localTransform);
+}
+
+void Texture::Draw(Graphics * gfx, love::Quad * quad, const Matrix4 & localTransform)
+{
+    const Matrix4 & tm = gfx->GetTransform();
+    Matrix4 t(tm, localTransform);
+
+    Vector2 transformed[TEXTURE_QUAD_POINT_COUNT];
+    t.TransformXY(transformed, quad->GetVertexPositions(), TEXTURE_QUAD_POINT_COUNT);
+
+    vertex::Vertex points[TEXTURE_QUAD_POINT_COUNT];
+    vertex::GenerateTextureFromVectors(points, transformed, quad->GetVertexTexCoords(),
+                                       TEXTURE_QUAD_POINT_COUNT, gfx->GetColor());
+
+    ::recorder::Instance().RenderTexture(this->handle, points, TEXTURE_QUAD_POINT_COUNT);
+}
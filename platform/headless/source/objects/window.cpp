@@ -0,0 +1,54 @@
+#include "modules/window/window.h"
+
+using namespace love;
+
+#include "recorder/recorder.h"
+
+static constexpr std::array<Window::DisplaySize, 2> displaySizes =
+{
+    {
+        { ::recorder::FRAMEBUFFER_WIDTH, ::recorder::FRAMEBUFFER_HEIGHT },
+        { ::recorder::FRAMEBUFFER_WIDTH, ::recorder::FRAMEBUFFER_HEIGHT }
+    }
+};
+
+Window::Window() : open(false)
+{}
+
+Window::~Window()
+{
+    this->graphics.Set(nullptr);
+
+    this->open = false;
+}
+
+bool Window::SetMode()
+{
+    return this->open = true;
+}
+
+void Window::SetGraphics(Graphics * g)
+{
+    this->graphics.Set(g);
+}
+
+void Window::OnSizeChanged(int width, int height)
+{
+    if (this->graphics.Get())
+        this->graphics->Resize(width, height);
+}
+
+const std::array<Window::DisplaySize, 2> & Window::GetFullscreenModes()
+{
+    return displaySizes;
+}
+
+int Window::GetDisplayCount()
+{
+    return 1;
+}
+
+bool Window::IsOpen()
+{
+    return this->open;
+}
@@ -0,0 +1,208 @@
+#include "recorder/graphics.h"
+
+using namespace love;
+using Screen = love::Graphics::Screen;
+
+love::recorder::Graphics::Graphics()
+{
+    this->width  = ::recorder::FRAMEBUFFER_WIDTH;
+    this->height = ::recorder::FRAMEBUFFER_HEIGHT;
+
+    this->RestoreState(this->states.back());
+}
+
+love::recorder::Graphics::~Graphics()
+{}
+
+const int love::recorder::Graphics::GetWidth(Screen screen) const
+{
+    return this->width;
+}
+
+const int love::recorder::Graphics::GetHeight() const
+{
+    return this->height;
+}
+
+void love::recorder::Graphics::SetActiveScreen(Screen screen)
+{
+    if (screen == Screen::SCREEN_MAX_ENUM)
+        throw love::Exception("invalid screen, expected 'default'.");
+}
+
+Graphics::Screen love::recorder::Graphics::GetActiveScreen() const
+{
+    return Screen::SCREEN_DEFAULT;
+}
+
+std::vector<std::string> love::recorder::Graphics::GetScreens() const
+{
+    return Graphics::GetConstants(Screen::SCREEN_MAX_ENUM);
+}
+
+void Graphics::SetCanvas(Canvas * canvas)
+{
+    DisplayState & state = this->states.back();
+    state.canvas.Set(canvas, Acquire::NORETAIN);
+
+    ::recorder::Instance().BindFramebuffer(canvas);
+
+    if (this->states.back().scissor)
+        this->SetScissor(this->states.back().scissorRect);
+}
+
+void love::recorder::Graphics::Clear(std::optional<Colorf> color, std::optional<int> stencil, std::optional<double> depth)
+{
+    if (this->IsCanvasActive() == false)
+        ::recorder::Instance().BindFramebuffer();
+
+    if (color.has_value())
+    {
+        Graphics::GammaCorrectColor(color.value());
+        ::recorder::Instance().ClearColor(color.value());
+    }
+}
+
+void love::recorder::Graphics::Present()
+{
+    if (this->IsCanvasActive())
+        throw love::Exception("present cannot be called while a Canvas is active.");
+
+    ::recorder::Instance().Present();
+}
+
+Graphics::RendererInfo love::recorder::Graphics::GetRendererInfo() const
+{
+    RendererInfo info {};
+
+    info.name    = RENDERER_NAME;
+    info.device  = RENDERER_DEVICE;
+    info.vendor  = RENDERER_VENDOR;
+    info.version = RENDERER_VERSION;
+
+    return info;
+}
+
+/* Every recorded draw is its own command, nothing is merged */
+Graphics::Stats love::recorder::Graphics::GetStats() const
+{
+    const ::recorder::FrameStats & frame = ::recorder::Instance().GetLastFrame();
+
+    Stats stats {};
+    stats.drawCalls = (int)frame.draws;
+
+    return stats;
+}
+
+/* Blending has no effect on what gets recorded */
+void love::recorder::Graphics::SetBlendMode(BlendMode mode, BlendAlpha alphamode)
+{
+    if (alphamode != BLENDALPHA_PREMULTIPLIED)
+    {
+        const char * modestr = "unknown";
+        switch (mode)
+        {
+            case BLEND_LIGHTEN:
+            case BLEND_DARKEN:
+            case BLEND_MULTIPLY:
+                Graphics::GetConstant(mode, modestr);
+                throw love::Exception("The '%s' blend mode must be used with premultiplied alpha.", modestr);
+                break;
+            default:
+                break;
+        }
+    }
+
+    this->states.back().blendMode = mode;
+    this->states.back().blendAlphaMode = alphamode;
+}
+
+void love::recorder::Graphics::SetColorMask(ColorMask mask)
+{
+    this->states.back().colorMask = mask;
+}
+
+Font * love::recorder::Graphics::NewDefaultFont(int size, const Texture::Filter & filter)
+{
+    return (love::Font *)Font::GetSystemFontByType(size, Font::SystemFontType::TYPE_STANDARD, filter);
+}
+
+Font * love::recorder::Graphics::NewFont(const Rasterizer & rasterizer, const Texture::Filter & filter)
+{
+    return new Font(rasterizer, filter);
+}
+
+/* Primitives */
+
+void love::recorder::Graphics::Polygon(DrawMode mode, const Vector2 * points,
+                                     size_t count, bool skipLastVertex)
+{
+    Colorf color[1] = { this->GetColor() };
+
+    const Matrix4 & t = this->GetTransform();
+    bool is2D = t.IsAffine2DTransform();
+
+    int vertexCount = (int)count - (mode == DRAW_FILL && skipLastVertex ? 1 : 0);
+
+    if (!is2D)
+        return;
+
+    FrameArena & arena = ::recorder::Instance().GetFrameArena();
+
+    Vector2 * transformed = arena.Allocate<Vector2>(vertexCount);
+    t.TransformXY(transformed, points, vertexCount);
+
+    vertex::Vertex * verts = arena.Allocate<vertex::Vertex>(vertexCount);
+    vertex::GeneratePrimitiveFromVectors(verts, transformed, vertexCount, color, 1);
+
+    if (mode == DRAW_FILL)
+        ::recorder::Instance().RenderPolygon(verts, vertexCount);
+    else
+        ::recorder::Instance().RenderPolyline(verts, vertexCount);
+}
+
+void love::recorder::Graphics::SetLineWidth(float width)
+{
+    love::Graphics::SetLineWidth(width);
+}
+
+void love::recorder::Graphics::Points(const Vector2 * points, size_t count, const Colorf * colors, size_t colorCount)
+{
+    vertex::Vertex * verts = ::recorder::Instance().GetFrameArena().Allocate<vertex::Vertex>(count);
+    vertex::GeneratePrimitiveFromVectors(verts, points, count, colors, colorCount);
+
+    ::recorder::Instance().RenderPoints(verts, count);
+}
+
+void love::recorder::Graphics::SetPointSize(float size)
+{
+    this->states.back().pointSize = size;
+}
+
+/* Primitives */
+
+void love::recorder::Graphics::SetScissor(const Rect & scissor)
+{
+    DisplayState & state = this->states.back();
+
+    ::recorder::Instance().SetScissor(scissor);
+
+    state.scissor = true;
+    state.scissorRect = scissor;
+}
+
+void love::recorder::Graphics::SetScissor()
+{
+    int width  = this->GetWidth(this->GetActiveScreen());
+    int height = this->GetHeight();
+
+    ::recorder::Instance().SetScissor({0, 0, width, height});
+    states.back().scissor = false;
+}
+
+StringMap<Graphics::Screen, Graphics::MAX_SCREENS>::Entry Graphics::screenEntries[] =
+{
+    { "default", Screen::SCREEN_DEFAULT },
+};
+
+StringMap<Graphics::Screen, Graphics::MAX_SCREENS> Graphics::screens(Graphics::screenEntries, sizeof(Graphics::screenEntries));
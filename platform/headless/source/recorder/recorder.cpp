@@ -0,0 +1,201 @@
+#include "recorder/recorder.h"
+
+#include <cstdio>
+
+recorder::recorder() : draws(0),
+                       uploads(0),
+                       nextTexture(1),
+                       frameStart(Clock::now()),
+                       lastFrame{},
+                       totals{},
+                       frameCount(0)
+{
+    this->vertices.reserve(0x10000);
+    this->commands.reserve(0x1000);
+}
+
+/*
+** Report the averages on the way out
+** so a CI run only has to read stdout
+*/
+recorder::~recorder()
+{
+    if (this->frameCount == 0)
+        return;
+
+    FrameStats average = this->GetAverageFrame();
+
+    printf("frames: %zu\n", this->frameCount);
+    printf("cpu time per frame: %.3f ms\n", average.cpuTime * 1000.0);
+    printf("vertices per frame: %zu\n", average.vertices);
+    printf("commands per frame: %zu\n", average.commands);
+    printf("draws per frame: %zu\n", average.draws);
+    printf("uploads per frame: %zu\n", average.uploads);
+}
+
+recorder & recorder::Instance()
+{
+    static recorder instance;
+    return instance;
+}
+
+void recorder::BindFramebuffer(love::Canvas * canvas)
+{
+    uint32_t target = (canvas != nullptr) ? canvas->GetHandle() : 0;
+
+    this->commands.push_back({ COMMAND_BIND_FRAMEBUFFER, PRIMITIVE_MAX_ENUM, target, 0, 0 });
+}
+
+void recorder::ClearColor(const Colorf & color)
+{
+    this->commands.push_back({ COMMAND_CLEAR, PRIMITIVE_MAX_ENUM, 0, 0, 0 });
+}
+
+void recorder::SetScissor(const love::Rect & scissor)
+{
+    this->commands.push_back({ COMMAND_SCISSOR, PRIMITIVE_MAX_ENUM, 0, 0, 0 });
+}
+
+uint32_t recorder::RegisterTexture()
+{
+    return this->nextTexture++;
+}
+
+void recorder::UploadTexture(uint32_t handle, size_t regions)
+{
+    this->commands.push_back({ COMMAND_UPLOAD, PRIMITIVE_MAX_ENUM, handle, 0, (uint32_t)regions });
+    this->uploads++;
+}
+
+bool recorder::Record(Primitive primitive, uint32_t texture, const vertex::Vertex * points, size_t count)
+{
+    if (points == nullptr || count == 0)
+        return false;
+
+    uint32_t first = (uint32_t)this->vertices.size();
+
+    this->vertices.insert(this->vertices.end(), points, points + count);
+    this->commands.push_back({ COMMAND_DRAW, primitive, texture, first, (uint32_t)count });
+
+    this->draws++;
+
+    return true;
+}
+
+bool recorder::RenderTexture(uint32_t handle, const vertex::Vertex * points, size_t count)
+{
+    return this->Record(PRIMITIVE_QUADS, handle, points, count);
+}
+
+bool recorder::RenderTexture(uint32_t handle, const vertex::Vertex * points, size_t count,
+                             const love::Matrix4 & transform, const Colorf & color)
+{
+    size_t first = this->vertices.size();
+
+    if (!this->Record(PRIMITIVE_QUADS, handle, points, count))
+        return false;
+
+    for (size_t index = first; index < this->vertices.size(); index++)
+    {
+        vertex::Vertex & current = this->vertices[index];
+
+        love::Vector2 point(current.position[0], current.position[1]);
+        transform.TransformXY(&point, &point, 1);
+
+        current.position[0] = point.x;
+        current.position[1] = point.y;
+
+        vertex::Tint(current, color);
+    }
+
+    return true;
+}
+
+bool recorder::RenderPolygon(const vertex::Vertex * points, size_t count)
+{
+    return this->Record(PRIMITIVE_TRIANGLE_FAN, 0, points, count);
+}
+
+bool recorder::RenderPolyline(const vertex::Vertex * points, size_t count)
+{
+    return this->Record(PRIMITIVE_LINE_STRIP, 0, points, count);
+}
+
+bool recorder::RenderPoints(const vertex::Vertex * points, size_t count)
+{
+    return this->Record(PRIMITIVE_POINTS, 0, points, count);
+}
+
+/*
+** Close off the current frame
+** CPU time covers everything since the last Present,
+** which includes the Lua side of the frame loop
+*/
+void recorder::Present()
+{
+    Clock::time_point now = Clock::now();
+
+    this->lastFrame.cpuTime  = std::chrono::duration<double>(now - this->frameStart).count();
+    this->lastFrame.vertices = this->vertices.size();
+    this->lastFrame.commands = this->commands.size();
+    this->lastFrame.draws    = this->draws;
+    this->lastFrame.uploads  = this->uploads;
+
+    this->totals.cpuTime  += this->lastFrame.cpuTime;
+    this->totals.vertices += this->lastFrame.vertices;
+    this->totals.commands += this->lastFrame.commands;
+    this->totals.draws    += this->lastFrame.draws;
+    this->totals.uploads  += this->lastFrame.uploads;
+
+    this->frameCount++;
+
+    this->vertices.clear();
+    this->commands.clear();
+    this->draws   = 0;
+    this->uploads = 0;
+
+    this->arena.Reset();
+
+    this->frameStart = Clock::now();
+}
+
+const std::vector<vertex::Vertex> & recorder::GetVertices() const
+{
+    return this->vertices;
+}
+
+const std::vector<recorder::Command> & recorder::GetCommands() const
+{
+    return this->commands;
+}
+
+love::FrameArena & recorder::GetFrameArena()
+{
+    return this->arena;
+}
+
+const recorder::FrameStats & recorder::GetLastFrame() const
+{
+    return this->lastFrame;
+}
+
+size_t recorder::GetFrameCount() const
+{
+    return this->frameCount;
+}
+
+recorder::FrameStats recorder::GetAverageFrame() const
+{
+    if (this->frameCount == 0)
+        return FrameStats{};
+
+    FrameStats average;
+
+    average.cpuTime  = this->totals.cpuTime  / this->frameCount;
+    average.vertices = this->totals.vertices / this->frameCount;
+    average.commands = this->totals.commands / this->frameCount;
+    average.draws    = this->totals.draws    / this->frameCount;
+    average.uploads  = this->totals.uploads  / this->frameCount;
+
+    return average;
+}
@@ -35,6 +35,20 @@ class CCmdVtxRing
             return m_mem;
         }
 
+        /*
+        ** Give up ownership of the memory so it can be
+        ** destroyed once the GPU is done with it
+        */
+        CMemPool::Handle release()
+        {
+            CMemPool::Handle mem = m_mem;
+
+            m_mem      = {};
+            m_curSlice = 0;
+
+            return mem;
+        }
+
         /* Return current buffer's size */
         const uint32_t getSize()
         {
@@ -17,6 +17,13 @@ class CImage
     CMemPool::Handle m_mem;
 
     public:
+        /* A @rect of pixels stored @offset bytes into an upload buffer */
+        struct Region
+        {
+            love::Rect rect;
+            size_t offset;
+        };
+
         CImage() : m_image{},
                    m_descriptor{},
                    m_mem{}
@@ -60,8 +67,11 @@ class CImage
 
         size_t getFormatSize(DkImageFormat format);
 
+        /* decode a PNG or JPG @buffer to RGBA8 pixels, without uploading anything */
+        static std::unique_ptr<u8[]> decode(const void * buffer, size_t size, int & width, int & height);
+
         private:
-            std::unique_ptr<u32[]> loadPNG(const void * buffer, const size_t size, int & width, int & height);
+            static std::unique_ptr<u8[]> loadPNG(const void * buffer, const size_t size, int & width, int & height);
 
-            std::unique_ptr<u8[]> loadJPG(const void * buffer, const size_t size, int & width, int & height);
+            static std::unique_ptr<u8[]> loadJPG(const void * buffer, const size_t size, int & width, int & height);
 };
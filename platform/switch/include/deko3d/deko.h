@@ -9,15 +9,18 @@
 #include "deko3d/shader.h"
 #include "deko3d/CImage.h"
 #include "common/bitalloc.h"
+#include "common/framearena.h"
 
 #include "objects/texture/texture.h"
 #include "objects/font/font.h"
 #include "objects/canvas/canvas.h"
 
 #include "common/lmath.h"
+#include "common/matrix.h"
 #include "deko3d/vertex.h"
 
 #include "deko3d/CDescriptorSet.h"
+#include "common/streambatch.h"
 
 #define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES // Enforces GLSL std140/std430 alignment rules for glm types
 #define GLM_FORCE_INTRINSICS               // Enables usage of SIMD CPU instructions (requiring the above as well)
@@ -47,6 +50,12 @@ class deko3d
         static constexpr unsigned COMMAND_SIZE      = 0x100000;
         static constexpr size_t VERTEX_COMMAND_SIZE = 0x100000;
 
+        /* Upper bound for one slice of the vertex ring */
+        static constexpr size_t MAX_VERTEX_SLICE_SIZE = 0x800000;
+
+        /* Frames the vertex high-water mark is taken over */
+        static constexpr uint32_t VERTEX_PEAK_FRAMES = 120;
+
         static constexpr size_t MAX_OBJECTS = 0x250;
 
         static deko3d & Instance();
@@ -122,7 +131,45 @@ class deko3d
 
         void UnRegisterResHandle(DkResHandle handle);
 
-        bool RenderTexture(const DkResHandle handle, const vertex::Vertex * points, size_t count);
+        /* @distanceField draws with the distance field shader, for text */
+        bool RenderTexture(const DkResHandle handle, const vertex::Vertex * points, size_t count,
+                           bool distanceField = false);
+
+        /*
+        ** Draw @count vertices with @transform applied on the GPU
+        ** Used for vertex data kept resident between frames; the
+        ** transform is part of the batch state, so consecutive
+        ** draws with the same one still merge
+        */
+        bool RenderTexture(const DkResHandle handle, const vertex::Vertex * points, size_t count,
+                           const love::Matrix4 & transform);
+
+        /*
+        ** Reserve @count vertices in this frame's ring
+        ** @gpuAddr is set to where they start on the GPU
+        ** returns nullptr when the ring is full
+        */
+        vertex::Vertex * ReserveVertices(size_t count, DkGpuAddr & gpuAddr);
+
+        /*
+        ** Draw from vertex memory that lives outside the ring
+        ** @texture may be nullptr for untextured geometry
+        ** @indices may be DK_GPU_ADDR_INVALID for non-indexed draws
+        ** @distanceField draws with the distance field shader, for text
+        */
+        void RenderMesh(love::Texture * texture, DkPrimitive primitive, const love::Matrix4 & transform,
+                        DkGpuAddr vertices, uint32_t size, uint32_t first, uint32_t count,
+                        DkGpuAddr indices = DK_GPU_ADDR_INVALID, DkIdxFormat format = DkIdxFormat_Uint16,
+                        bool distanceField = false);
+
+        /* Number of frames presented so far */
+        uint64_t GetFrameIndex() const;
+
+        /* Whether memory last used in @frame can be safely overwritten */
+        bool IsFrameComplete(uint64_t frame);
+
+        /* Destroy @handle once no frame that may use it is still in flight */
+        void ReleaseDeferred(CMemPool::Handle handle);
 
         /* Primitives Rendering */
 
@@ -132,23 +179,115 @@ class deko3d
 
         bool RenderPoints(const vertex::Vertex * points, size_t count);
 
+        /*
+        ** Emit the pending batched draw, if any
+        ** Called before anything that changes GPU state
+        */
+        void FlushBatch();
+
+        /* Counted over a frame, from one Present to the next */
+        struct FrameStats
+        {
+            size_t drawCalls;
+            size_t drawCallsBatched; //< draws merged into the pending one
+            size_t vertexOverflows;  //< blocks taken past the end of the vertex ring
+        };
+
+        const FrameStats & GetLastFrame() const;
+
+        /* Scratch memory for geometry built this frame, reset at Present */
+        love::FrameArena & GetFrameArena();
+
+        /*
+        ** Copy @count @regions of @data into @image with a single submission
+        ** Draws recorded after this wait for the copy on the GPU,
+        ** so it never blocks the CPU
+        */
+        bool UploadRegions(dk::Image & image, const void * data, size_t size,
+                           const CImage::Region * regions, size_t count);
+
+        /* Copy the top-left @width x @height pixels of @source into @destination, fenced the same way */
+        bool CopyImage(dk::Image & source, dk::Image & destination, uint32_t width, uint32_t height);
+
+        /* Number of texture queue submissions so far */
+        size_t GetUploadCount() const;
+
         static DkWrapMode GetDekoWrapMode(love::Texture::WrapMode wrap);
 
         void SetDekoBarrier(DkBarrier barrier, uint32_t flags);
 
     private:
+        /* Vertex memory being filled, a ring slice or an overflow block */
         vertex::Vertex * vertexData;
+        DkGpuAddr vertexAddr;
+        uint32_t vertexCapacity;
 
         uint32_t firstVertex = 0;
+
+        /* Vertices written this frame and the most seen recently */
+        size_t frameVertices;
+        size_t peakVertices;
+        uint32_t peakFrames;
+
+        /* Blocks this frame took past the end of the vertex ring */
+        size_t frameOverflows;
+
+        love::FrameArena arena;
+
+        dk::Fence uploadFence;
+        size_t uploadCount;
+
         BitwiseAlloc<MAX_OBJECTS> allocator;
 
         enum State
         {
             STATE_PRIMITIVE,
             STATE_TEXTURE,
+            STATE_DISTANCE_FIELD,
             STATE_MAX_ENUM
         };
 
+        /* Everything that has to match for two draws to be merged */
+        struct BatchState
+        {
+            State renderState;
+            DkResHandle handle;
+            DkPrimitive primitive;
+            uint32_t transform = 0; //< index into transforms
+
+            bool operator==(const BatchState & other) const = default;
+        };
+
+        /* Model-view matrices for this frame's draws, the first is identity */
+        std::vector<glm::mat4> transforms;
+        uint32_t boundTransform;
+
+        StreamBatch<BatchState> batch;
+        DkResHandle boundTexture;
+
+        size_t batchedDraws;
+        FrameStats lastFrame;
+
+        bool EnsureVertexSpace(size_t count);
+
+        void BindVertexMemory(void * data, DkGpuAddr addr, uint32_t size);
+
+        void ResizeVertexRing();
+
+        void AddToBatch(const BatchState & state, size_t count);
+
+        void FlushDraw(const StreamBatch<BatchState>::Draw & draw);
+
+        void SetModelView(const glm::mat4 & matrix);
+
+        /* Send @commands to the texture queue, fenced before the next draw */
+        void SubmitUpload(dk::UniqueCmdBuf & commandBuffer, CMemPool::Handle commands);
+
+        uint64_t frameIndex;
+        std::vector<std::pair<uint64_t, CMemPool::Handle>> retired;
+
+        void DestroyRetired();
+
         static constexpr float Z_NEAR = -10.0f;
         static constexpr float Z_FAR  = 10.0f;
 
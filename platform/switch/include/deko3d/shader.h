@@ -24,6 +24,7 @@ namespace love
             {
                 STANDARD_DEFAULT,
                 STANDARD_TEXTURE,
+                STANDARD_DISTANCE_FIELD,
                 STANDARD_MAX_ENUM
             };
 
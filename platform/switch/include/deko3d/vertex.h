@@ -3,29 +3,13 @@
 #include "deko3d/CMemPool.h"
 #include "deko3d/common.h"
 
-#include "common/vector.h"
-#include "common/colors.h"
+#include "common/vertex.h"
 
 #include <array>
 #include <memory>
 
 namespace vertex
 {
-    struct Vertex
-    {
-        float position[3];
-        float color[4];
-        uint16_t texcoord[2];
-    };
-
-    struct GlyphVertex
-    {
-        float    x, y;
-        uint16_t s, t;
-
-        Colorf color;
-    };
-
     enum CullMode
     {
         CULL_NONE,
@@ -52,8 +36,8 @@ namespace vertex
 
         constexpr std::array<DkVtxAttribState, 2> PrimitiveAttribState =
         {
-            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
-            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, color),    DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 }
+            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_2x32, DkVtxAttribType_Float, 0 },
+            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, color),    DkVtxAttribSize_4x8,  DkVtxAttribType_Unorm, 0 }
         };
 
         /*  Textures */
@@ -65,20 +49,12 @@ namespace vertex
 
         constexpr std::array<DkVtxAttribState, 3> TextureAttribState =
         {
-            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
-            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, color),    DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, position), DkVtxAttribSize_2x32, DkVtxAttribType_Float, 0 },
+            DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, color),    DkVtxAttribSize_4x8,  DkVtxAttribType_Unorm, 0 },
             DkVtxAttribState{ 0, 0, offsetof(vertex::Vertex, texcoord), DkVtxAttribSize_2x16, DkVtxAttribType_Unorm, 0 }
         };
     }
 
-    std::vector<Vertex> GeneratePrimitiveFromVectors(const love::Vector2 * points, size_t count,
-                                                     const Colorf * colors, size_t colorCount);
-
-    std::vector<Vertex> GenerateTextureFromVectors(const love::Vector2 * points, const love::Vector2 * texcoord,
-                                                   size_t count, Colorf color);
-
-    std::vector<vertex::Vertex> GenerateTextureFromGlyphs(const vertex::GlyphVertex * verts, size_t count);
-
     bool GetConstant(const char * in, CullMode & out);
     bool GetConstant(CullMode in, const char *& out);
     std::vector<std::string> GetConstants(CullMode);
@@ -39,6 +39,9 @@ namespace love
 
             virtual GlyphData * GetGlyphData(const std::string & text) const;
 
+            /* Advance of @glyph, without rendering it where possible */
+            virtual int GetGlyphAdvance(uint32_t glyph) const;
+
             virtual int GetGlyphCount() const = 0;
 
             virtual bool HasGlyph(uint32_t glyph) const = 0;
@@ -49,10 +52,20 @@ namespace love
 
             virtual DataType GetDataType() const = 0;
 
+            /* A separate instance of the same font, for use on another thread */
+            virtual Rasterizer * Clone() const = 0;
+
             float GetDPIScale() const;
 
+            /* Glyphs come out as distance fields, see common/distancefield.h */
+            bool IsDistanceField() const;
+
+            void SetDistanceField(bool enable);
+
         protected:
             FontMetrics metrics;
             float dpiScale = 1.0f;
+
+            bool distanceField = false;
     };
 }
\ No newline at end of file
@@ -38,6 +38,8 @@ namespace love
 
             GlyphData * GetGlyphData(uint32_t glyph) const override;
 
+            int GetGlyphAdvance(uint32_t glyph) const override;
+
             int GetGlyphCount() const override;
 
             bool HasGlyph(uint32_t glyph) const override;
@@ -46,6 +48,11 @@ namespace love
 
             DataType GetDataType() const override;
 
+            Rasterizer * Clone() const override;
+
+            /* Pixels of distance field around each glyph, in either direction */
+            static constexpr int DISTANCE_FIELD_SPREAD = 4;
+
             static bool Accepts(FT_Library library, love::Data * data);
 
             static bool GetConstant(const char * in, Hinting & out);
@@ -53,8 +60,11 @@ namespace love
             static std::vector<std::string> GetConstants(Hinting);
 
         private:
+            FT_Library library;
             FT_Face face;
 
+            int size;
+
             StrongReference<love::Data> data;
 
             Hinting hinting;
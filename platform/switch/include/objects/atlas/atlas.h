@@ -0,0 +1,51 @@
+#pragma once
+
+#include "common/atlaspacker.h"
+#include "common/strongref.h"
+
+#include "objects/image/image.h"
+#include "objects/quad/quad.h"
+
+namespace love
+{
+    /*
+    ** Packs many small images into shared pages, so
+    ** sprites drawn from one page batch into one draw
+    */
+    class Atlas : public Object
+    {
+        public:
+            static love::Type type;
+
+            /* Edge pixels are repeated this far around each image to stop filtering bleed */
+            static constexpr int PADDING = 1;
+
+            Atlas(int pageSize);
+
+            virtual ~Atlas();
+
+            /*
+            ** Decode @data into the first page with room for it
+            ** Returns that page and sets @quad to where it landed
+            */
+            Image * Add(Data * data, Quad *& quad);
+
+            size_t GetPageCount() const;
+
+            Image * GetPage(size_t index) const;
+
+            int GetPageSize() const;
+
+            float GetOccupancy(size_t index) const;
+
+        private:
+            struct Page
+            {
+                StrongReference<Image> image;
+                AtlasPacker packer;
+            };
+
+            std::vector<Page> pages;
+            int pageSize;
+    };
+}
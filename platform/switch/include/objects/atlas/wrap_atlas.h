@@ -0,0 +1,21 @@
+#pragma once
+
+#include "objects/atlas/atlas.h"
+#include "common/luax.h"
+
+namespace Wrap_Atlas
+{
+    int Add(lua_State * L);
+
+    int GetPage(lua_State * L);
+
+    int GetPageCount(lua_State * L);
+
+    int GetPageSize(lua_State * L);
+
+    int GetOccupancy(lua_State * L);
+
+    love::Atlas * CheckAtlas(lua_State * L, int index);
+
+    int Register(lua_State * L);
+}
@@ -6,8 +6,12 @@
 #include "objects/image/image.h"
 #include "objects/texture/texture.h"
 
+#include "objects/font/glyphatlas.h"
+
+#include "common/kerningtable.h"
+#include "common/lrucache.h"
+
 #include "freetype/truetyperasterizer.h"
-#include "freetype/glyphdata.h"
 
 enum class love::common::Font::SystemFontType : uint8_t
 {
@@ -49,13 +53,7 @@ namespace love
 
             static void GetCodepointsFromString(const std::vector<ColoredString> & strings, ColoredCodepoints & codepoints);
 
-            struct DrawCommand
-            {
-                int startVertex;
-                int vertexCount;
-
-                love::Texture * texture;
-            };
+            typedef GlyphAtlas::DrawCommand DrawCommand;
 
             std::vector<DrawCommand> GenerateVertices(const ColoredCodepoints & codepoints, const Colorf & constantcolor,
                                                       std::vector<vertex::GlyphVertex> & glyphVertices, float extra_spacing = 0.0f,
@@ -83,12 +81,7 @@ namespace love
 
             float GetHeight() const override;
 
-            struct Glyph
-            {
-                love::Texture * texture;
-                int spacing;
-                vertex::GlyphVertex vertices[4];
-            };
+            typedef GlyphAtlas::Glyph Glyph;
 
             uint32_t GetTextureCacheID();
 
@@ -98,11 +91,16 @@ namespace love
 
             const Font::Glyph & FindGlyph(uint32_t glyph);
 
-            const Font::Glyph & AddGlyph(uint32_t glyph);
+            float GetKerning(uint32_t leftGlyph, uint32_t rightGlyph);
 
-            love::GlyphData * GetRasterizerGlyphData(uint32_t glyph);
+            /*
+            ** Spacing of @glyph, for measuring text
+            ** Glyphs that aren't in the atlas yet don't get added to it
+            */
+            int GetGlyphSpacing(uint32_t glyph);
 
-            float GetKerning(uint32_t leftGlyph, uint32_t rightGlyph);
+            /* Glyphs are distance fields, drawn with their own shader */
+            bool IsDistanceField() const;
 
             float GetAscent() const;
 
@@ -110,42 +108,78 @@ namespace love
 
             float GetDescent() const;
 
+            /* Upload the glyphs added since the last flush, before they get drawn */
+            void FlushGlyphs();
+
+            /*
+            ** Rasterize @codepoints on a worker thread
+            ** They go into the atlas the next time a glyph is looked up
+            */
+            void Preload(const std::vector<uint32_t> & codepoints) override;
+
+            void SetAutoPreload(bool enable) override;
+
+            bool GetAutoPreload() const override;
+
+            size_t GetLayoutCacheHits() const;
+
+            size_t GetLayoutCacheMisses() const;
+
         private:
-            struct TextureSize
+            /* deko3d images for the atlas */
+            class AtlasTextures : public GlyphAtlas::Textures
             {
-                int width;
-                int height;
-            };
+                public:
+                    AtlasTextures(const Texture::Filter & filter);
 
-            TextureSize GetNextTextureSize() const;
+                    love::Texture * Create(int width, int height, love::Texture * previous) override;
 
-            std::vector<love::StrongReference<love::Rasterizer>> rasterizers;
+                    void Upload(love::Texture * texture, const std::vector<uint8_t> & pixels,
+                                const std::vector<GlyphAtlas::Region> & regions) override;
 
-            int height;
+                    /* Drop the replaced textures no frame uses any more */
+                    void ReleaseRetired();
 
-            int textureWidth;
-            int textureHeight;
+                private:
+                    const Texture::Filter & filter;
 
-            bool useSpacesAsTab;
+                    /* Replaced textures, kept until the frames drawing with them are done */
+                    std::vector<std::pair<uint64_t, love::StrongReference<love::Image>>> retired;
 
-            uint32_t textureCacheID;
+                    std::vector<CImage::Region> regions;
+            };
+
+            int height;
 
             float dpiScale;
 
-            int textureX;
-            int textureY;
-            int rowHeight;
+            AtlasTextures textures;
+            GlyphAtlas atlas;
 
-            static const int TEXTURE_PADDING = 2;
+            KerningTable kerning;
 
-            static const int SPACES_PER_TAB = 4;
+            float FindKerning(uint32_t leftGlyph, uint32_t rightGlyph);
+
+            /* Laid out text, ready for PrintV */
+            struct Layout
+            {
+                std::vector<DrawCommand> commands;
+                std::vector<vertex::GlyphVertex> vertices;
+            };
 
-            std::unordered_map<uint32_t, Font::Glyph> glyphs;
+            static constexpr size_t MAX_LAYOUTS = 64;
 
-            std::vector<love::StrongReference<love::Image>> images;
+            const Layout & GetLayout(const std::vector<ColoredString> & text, const Colorf & color,
+                                     bool formatted, float wrap = 0.0f, AlignMode align = ALIGN_LEFT);
 
-            std::unordered_map<uint64_t, float> kerning;
+            /*
+            ** Keyed by the raw bytes of everything that goes into a layout
+            ** Emptied whenever the textures change
+            */
+            LRUCache<std::string, Layout> layouts;
+            uint32_t layoutCacheID;
 
-            void CreateTexture();
+            /* Reused to build keys, so a hit doesn't allocate */
+            std::string layoutKey;
     };
 }
\ No newline at end of file
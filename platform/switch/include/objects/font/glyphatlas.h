@@ -0,0 +1,240 @@
+#pragma once
+
+#include "objects/texture/texture.h"
+
+#include "common/atlaspacker.h"
+#include "common/kerningtable.h"
+#include "common/vertex.h"
+
+#include "modules/thread/types/threadable.h"
+#include "modules/thread/types/conditional.h"
+#include "modules/thread/types/lock.h"
+
+#include "freetype/rasterizer.h"
+#include "freetype/glyphdata.h"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace love
+{
+    /*
+    ** The glyph cache behind a Font
+    ** Rasterizes each glyph once and packs it into the last texture,
+    ** which grows before a new one is started
+    ** Textures come from a Textures implementation, so none of
+    ** this depends on the GPU
+    */
+    class GlyphAtlas
+    {
+        public:
+            struct Glyph
+            {
+                love::Texture * texture;
+                int spacing;
+                vertex::GlyphVertex vertices[4];
+
+                /* Where the pixels are in @texture */
+                Rect rect;
+            };
+
+            /* A run of glyph quads drawn from one texture */
+            struct DrawCommand
+            {
+                int startVertex;
+                int vertexCount;
+
+                love::Texture * texture;
+            };
+
+            /* Where a glyph goes, and where its pixels start in the upload */
+            struct Region
+            {
+                Rect rect;
+                size_t offset;
+            };
+
+            class Textures
+            {
+                public:
+                    virtual ~Textures()
+                    {}
+
+                    /*
+                    ** A new @width x @height texture
+                    ** When growing, @previous is copied into its top left;
+                    ** the atlas lets go of @previous afterwards
+                    */
+                    virtual love::Texture * Create(int width, int height, love::Texture * previous) = 0;
+
+                    /* Copy @regions of @pixels into @texture */
+                    virtual void Upload(love::Texture * texture, const std::vector<uint8_t> & pixels,
+                                        const std::vector<Region> & regions) = 0;
+            };
+
+            /* Upload offsets are aligned to @uploadAlignment, a power of two */
+            GlyphAtlas(Rasterizer * rasterizer, Textures & textures, size_t uploadAlignment);
+
+            ~GlyphAtlas();
+
+            /*
+            ** With automatic preloading, a glyph that isn't ready is
+            ** queued on the loader instead, and an empty glyph with its
+            ** spacing comes back; valid until the next call
+            */
+            const Glyph & FindGlyph(uint32_t glyph);
+
+            /*
+            ** Spacing of @glyph, for measuring text
+            ** Glyphs that aren't in the atlas yet don't get added to it
+            */
+            int GetGlyphSpacing(uint32_t glyph);
+
+            /* Upload the glyphs added since the last flush, before they get drawn */
+            void Flush();
+
+            /*
+            ** Rasterize @codepoints on a worker thread
+            ** They go into the atlas the next time a glyph is looked up
+            */
+            void Preload(const std::vector<uint32_t> & codepoints);
+
+            /* Add what the loader has finished, true if there was anything */
+            bool PublishPreloaded();
+
+            void SetAutoPreload(bool enable);
+
+            bool GetAutoPreload() const;
+
+            /*
+            ** Changes whenever laid out text is out of date: existing glyphs
+            ** got new texture coordinates, or glyphs left out of it arrived
+            */
+            uint32_t GetCacheID() const;
+
+            const std::vector<StrongReference<Rasterizer>> & GetRasterizers() const;
+
+            size_t GetGlyphCount() const;
+
+            static constexpr int SPACES_PER_TAB = 4;
+
+        private:
+            struct TextureSize
+            {
+                int width;
+                int height;
+            };
+
+            TextureSize GetNextTextureSize() const;
+
+            void CreateTexture();
+
+            void SetTexCoords(Glyph & glyph) const;
+
+            static GlyphData * RasterizeGlyph(const std::vector<StrongReference<Rasterizer>> & rasterizers,
+                                              bool useSpacesAsTab, uint32_t glyph);
+
+            const Glyph & AddGlyph(uint32_t glyph);
+
+            const Glyph & AddGlyph(uint32_t glyph, GlyphData * data);
+
+            int FindAdvance(uint32_t glyph) const;
+
+            std::vector<StrongReference<Rasterizer>> rasterizers;
+
+            Textures & textures;
+            size_t uploadAlignment;
+
+            float dpiScale;
+            bool useSpacesAsTab;
+
+            int textureWidth;
+            int textureHeight;
+
+            uint32_t cacheID;
+
+            /* Packs the last texture, offset by TEXTURE_PADDING */
+            AtlasPacker packer;
+
+            static const int TEXTURE_PADDING = 2;
+
+            std::vector<StrongReference<love::Texture>> pages;
+
+            std::unordered_map<uint32_t, Glyph> glyphs;
+
+            /*
+            ** Codepoints below this skip the hash maps: glyphs
+            ** go in flat tables, filled as they're used
+            */
+            static constexpr uint32_t DENSE_GLYPHS = KerningTable::DENSE_GLYPHS;
+
+            /* Points into @glyphs, whose elements never move */
+            std::array<const Glyph *, DENSE_GLYPHS> denseGlyphs;
+
+            /* Spacing of glyphs measured but never drawn, apart from the atlas */
+            std::unordered_map<uint32_t, int> advances;
+
+            static constexpr int NO_ADVANCE = std::numeric_limits<int>::min();
+
+            /* NO_ADVANCE until measured */
+            std::array<int, DENSE_GLYPHS> denseAdvances;
+
+            bool autoPreload;
+
+            /* Queued by FindGlyph and left out of layouts until they arrive */
+            std::unordered_set<uint32_t> deferred;
+
+            /* The loader couldn't do these, FindGlyph rasterizes them itself */
+            std::unordered_set<uint32_t> failed;
+
+            /* What FindGlyph hands out in their place */
+            Glyph placeholder;
+
+            /* Pixels of new glyphs for the last texture, waiting for Flush */
+            std::vector<uint8_t> pendingPixels;
+            std::vector<Region> pendingGlyphs;
+
+            /* Rasterizes for Preload, using its own copies of the rasterizers */
+            class GlyphLoader : public Threadable
+            {
+                public:
+                    GlyphLoader(const std::vector<StrongReference<Rasterizer>> & rasterizers, bool useSpacesAsTab);
+
+                    virtual ~GlyphLoader();
+
+                    void Queue(const std::vector<uint32_t> & codepoints);
+
+                    /*
+                    ** Move the glyphs finished so far into @out, and the ones
+                    ** that failed into @failed, false if there were none
+                    */
+                    bool Collect(std::vector<StrongReference<GlyphData>> & out, std::vector<uint32_t> & failed);
+
+                    void SetFinish();
+
+                    void ThreadFunction();
+
+                protected:
+                    std::vector<StrongReference<Rasterizer>> rasterizers;
+                    bool useSpacesAsTab;
+
+                    thread::MutexRef mutex;
+                    thread::ConditionalRef condition;
+
+                    std::deque<uint32_t> requests;
+                    std::vector<StrongReference<GlyphData>> results;
+                    std::vector<uint32_t> failures;
+
+                    bool finish;
+
+                    /* Checked without the lock on every glyph miss */
+                    std::atomic<bool> ready;
+            };
+
+            GlyphLoader * loader;
+    };
+}
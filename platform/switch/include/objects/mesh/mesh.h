@@ -0,0 +1,70 @@
+#pragma once
+
+#include "objects/drawable/drawable.h"
+#include "objects/texture/texture.h"
+
+#include "common/strongref.h"
+
+#include "objects/mesh/meshgeometry.h"
+
+#include "deko3d/CMemPool.h"
+#include "deko3d/vertex.h"
+
+namespace love
+{
+    class Graphics;
+
+    /*
+    ** User geometry
+    ** Vertices are converted to vertex::Vertex when they are set,
+    ** since the standard shaders only take position, color and texcoord.
+    ** Static and dynamic meshes keep them in GPU memory and only upload
+    ** what changed, stream meshes copy into the vertex ring on every draw.
+    */
+    class Mesh : public Drawable, public MeshGeometry
+    {
+        public:
+            static love::Type type;
+
+            Mesh(const std::vector<AttribFormat> & format, const std::vector<float> & data,
+                 size_t vertexCount, DrawMode mode, Usage usage);
+
+            Mesh(const std::vector<AttribFormat> & format, size_t vertexCount, DrawMode mode, Usage usage);
+
+            virtual ~Mesh();
+
+            void SetTexture(Texture * texture);
+
+            void SetTexture();
+
+            Texture * GetTexture() const;
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+
+        private:
+            struct GpuBuffer
+            {
+                CMemPool::Handle memory;
+                uint64_t lastUse = 0;
+                bool used = false;
+            };
+
+            GpuBuffer vertexBuffer;
+            GpuBuffer indexBuffer;
+            DkIdxFormat indexFormat;
+
+            StrongReference<Texture> texture;
+
+            void FlushVertices();
+
+            void FlushVertexMap();
+
+            /* The GPU may still be reading @buffer */
+            static bool IsBusy(const GpuBuffer & buffer);
+
+            /* Writable GPU memory of @size bytes for @buffer, fresh when @orphan */
+            void * MapBuffer(GpuBuffer & buffer, uint32_t size, bool orphan);
+
+            static DkPrimitive GetPrimitive(DrawMode mode);
+    };
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "common/stringmap.h"
+#include "common/vertex.h"
+
+#include <string>
+#include <vector>
+
+namespace love
+{
+    /*
+    ** The part of a Mesh that never touches the GPU: its vertices,
+    ** vertex map and draw range, and which of them need uploading
+    */
+    class MeshGeometry
+    {
+        public:
+            enum DrawMode
+            {
+                DRAWMODE_FAN,
+                DRAWMODE_STRIP,
+                DRAWMODE_TRIANGLES,
+                DRAWMODE_POINTS,
+                DRAWMODE_MAX_ENUM
+            };
+
+            enum Usage
+            {
+                USAGE_STREAM,
+                USAGE_DYNAMIC,
+                USAGE_STATIC,
+                USAGE_MAX_ENUM
+            };
+
+            enum DataType
+            {
+                DATA_FLOAT,
+                DATA_BYTE,
+                DATA_MAX_ENUM
+            };
+
+            enum Attribute
+            {
+                ATTRIBUTE_POSITION,
+                ATTRIBUTE_TEXCOORD,
+                ATTRIBUTE_COLOR,
+                ATTRIBUTE_MAX_ENUM
+            };
+
+            struct AttribFormat
+            {
+                std::string name;
+                DataType type;
+                int components;
+            };
+
+            /*
+            ** How to bring a buffer up to date
+            ** Memory the GPU may still be reading is never written to:
+            ** it is swapped for a fresh allocation that gets everything
+            */
+            struct Upload
+            {
+                bool orphan;
+
+                size_t start;
+                size_t count;
+            };
+
+            MeshGeometry(const std::vector<AttribFormat> & format, size_t vertexCount, DrawMode mode, Usage usage);
+
+            static std::vector<AttribFormat> GetDefaultVertexFormat();
+
+            /*
+            ** @data holds every component of every attribute,
+            ** in format order, starting at vertex @start
+            */
+            void SetVertices(const std::vector<float> & data, size_t start);
+
+            void SetVertex(size_t index, const std::vector<float> & data);
+
+            std::vector<float> GetVertex(size_t index) const;
+
+            size_t GetVertexCount() const;
+
+            /* Components per vertex, across all attributes */
+            size_t GetVertexStride() const;
+
+            const std::vector<AttribFormat> & GetVertexFormat() const;
+
+            void SetVertexMap(const std::vector<uint32_t> & map);
+
+            void SetVertexMap();
+
+            bool GetVertexMap(std::vector<uint32_t> & map) const;
+
+            /* Drawn through the vertex map */
+            bool IsIndexed() const;
+
+            void SetDrawMode(DrawMode mode);
+
+            DrawMode GetDrawMode() const;
+
+            Usage GetUsage() const;
+
+            void SetDrawRange(int start, int count);
+
+            void SetDrawRange();
+
+            bool GetDrawRange(int & start, int & count) const;
+
+            /* The draw range, clamped to what there is to draw */
+            void GetDrawSpan(int & start, int & count) const;
+
+            /*
+            ** Vertices changed since the last call, into a buffer that can
+            ** hold @capacity of them; @busy when the GPU may still read it
+            */
+            Upload TakeVertexUpload(size_t capacity, bool busy);
+
+            /* The vertex map changed since the last call */
+            bool TakeVertexMapUpload();
+
+            static bool GetConstant(const char * in, DrawMode & out);
+            static bool GetConstant(DrawMode in, const char *& out);
+            static std::vector<std::string> GetConstants(DrawMode);
+
+            static bool GetConstant(const char * in, Usage & out);
+            static bool GetConstant(Usage in, const char *& out);
+            static std::vector<std::string> GetConstants(Usage);
+
+            static bool GetConstant(const char * in, DataType & out);
+            static bool GetConstant(DataType in, const char *& out);
+            static std::vector<std::string> GetConstants(DataType);
+
+            static bool GetConstant(const char * in, Attribute & out);
+            static bool GetConstant(Attribute in, const char *& out);
+            static std::vector<std::string> GetConstants(Attribute);
+
+        protected:
+            std::vector<AttribFormat> format;
+            std::vector<Attribute> attributes;
+
+            std::vector<vertex::Vertex> vertices;
+            std::vector<uint32_t> vertexMap;
+            bool useVertexMap;
+
+            /* vertices that changed since the last upload */
+            size_t modifiedStart;
+            size_t modifiedEnd;
+
+            bool vertexMapModified;
+
+            DrawMode mode;
+            Usage usage;
+
+            int rangeStart;
+            int rangeCount;
+
+        private:
+            void SetupFormat(const std::vector<AttribFormat> & format);
+
+            void MarkModified(size_t start, size_t count);
+
+            static StringMap<DrawMode, DRAWMODE_MAX_ENUM>::Entry drawModeEntries[];
+            static StringMap<DrawMode, DRAWMODE_MAX_ENUM> drawModes;
+
+            static StringMap<Usage, USAGE_MAX_ENUM>::Entry usageEntries[];
+            static StringMap<Usage, USAGE_MAX_ENUM> usages;
+
+            static StringMap<DataType, DATA_MAX_ENUM>::Entry dataTypeEntries[];
+            static StringMap<DataType, DATA_MAX_ENUM> dataTypes;
+
+            static StringMap<Attribute, ATTRIBUTE_MAX_ENUM>::Entry attributeEntries[];
+            static StringMap<Attribute, ATTRIBUTE_MAX_ENUM> attributeNames;
+    };
+}
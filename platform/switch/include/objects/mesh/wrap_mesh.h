@@ -0,0 +1,44 @@
+#pragma once
+
+#include "objects/mesh/mesh.h"
+#include "common/luax.h"
+
+namespace Wrap_Mesh
+{
+    int SetVertices(lua_State * L);
+
+    int SetVertex(lua_State * L);
+
+    int GetVertex(lua_State * L);
+
+    int GetVertexCount(lua_State * L);
+
+    int GetVertexFormat(lua_State * L);
+
+    int SetVertexMap(lua_State * L);
+
+    int GetVertexMap(lua_State * L);
+
+    int SetTexture(lua_State * L);
+
+    int GetTexture(lua_State * L);
+
+    int SetDrawMode(lua_State * L);
+
+    int GetDrawMode(lua_State * L);
+
+    int SetDrawRange(lua_State * L);
+
+    int GetDrawRange(lua_State * L);
+
+    /* Vertex format table at @index, { {name, datatype, components}, ... } */
+    std::vector<love::Mesh::AttribFormat> CheckVertexFormat(lua_State * L, int index);
+
+    /* Table of vertex tables at @index, flattened in @format order */
+    size_t CheckVertices(lua_State * L, int index, const std::vector<love::Mesh::AttribFormat> & format,
+                         std::vector<float> & data);
+
+    love::Mesh * CheckMesh(lua_State * L, int index);
+
+    int Register(lua_State * L);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "objects/spritebatch/spritebatchc.h"
+#include "deko3d/vertex.h"
+
+#include "common/tintcache.h"
+
+namespace love
+{
+    class SpriteBatch : public common::SpriteBatch
+    {
+        public:
+            static constexpr int VERTICES_PER_SPRITE = 4;
+
+            SpriteBatch(love::Texture * texture, int size);
+
+            virtual ~SpriteBatch();
+
+            void Draw(Graphics * gfx, const Matrix4 & localTransform) override;
+
+        protected:
+            void SetSprite(int index, love::Quad * quad, const Matrix4 & m, const Colorf & color) override;
+
+            void Resize(int size) override;
+
+        private:
+            std::vector<vertex::Vertex> vertices;
+
+            /* Only used when the current color isn't white */
+            TintCache tinted;
+    };
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "objects/text/textc.h"
+#include "objects/text/textvertices.h"
 #include "deko3d/vertex.h"
+#include "deko3d/CMemPool.h"
 
 namespace love
 {
@@ -42,17 +44,25 @@ namespace love
                 Matrix4 matrix;
             };
 
-            std::vector<Font::DrawCommand> drawCommands;
+            struct GpuBuffer
+            {
+                CMemPool::Handle memory;
+                uint64_t lastUse = 0;
+                bool used = false;
+            };
 
             std::vector<TextData> textData;
 
-            std::vector<vertex::GlyphVertex> vertexBuffer;
+            /* Glyph quads ready to draw */
+            TextVertices vertices;
 
-            size_t vertexOffset;
+            /* Kept in GPU memory between draws */
+            GpuBuffer vertexBuffer;
 
             uint32_t textureCacheId;
 
-            void CopyVertices(const std::vector<vertex::GlyphVertex> & vertices, size_t vertoffset);
+            /* Upload what was added since the last draw */
+            void FlushVertices();
 
             void RegenerateVertices();
 
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "objects/font/glyphatlas.h"
+
+#include "common/matrix.h"
+#include "common/vertex.h"
+
+#include <vector>
+
+namespace love
+{
+    /*
+    ** The glyph quads of a Text, with each piece's transform applied,
+    ** and what of them still has to reach GPU memory
+    ** Between layouts they are only ever appended to
+    */
+    class TextVertices
+    {
+        public:
+            typedef GlyphAtlas::DrawCommand DrawCommand;
+
+            /* Vertices to copy, into fresh memory when @orphan */
+            struct Upload
+            {
+                bool orphan;
+
+                size_t start;
+                size_t count;
+            };
+
+            TextVertices();
+
+            /*
+            ** Add the quads Font laid out in @glyphs, which @commands
+            ** index from 0, transformed by @transform unless it's null
+            */
+            void Append(std::vector<vertex::GlyphVertex> & glyphs, std::vector<DrawCommand> commands,
+                        const Matrix4 * transform);
+
+            void Clear();
+
+            /*
+            ** What changed since the last call, for a buffer that can hold
+            ** @capacity vertices; @busy when the GPU may still read it
+            */
+            Upload TakeUpload(size_t capacity, bool busy);
+
+            /* A draw used everything uploaded so far */
+            void MarkDrawn();
+
+            const std::vector<DrawCommand> & GetDrawCommands() const;
+
+            const std::vector<vertex::Vertex> & GetVertices() const;
+
+        private:
+            std::vector<DrawCommand> drawCommands;
+            std::vector<vertex::Vertex> vertices;
+
+            /* Leading vertices already in GPU memory, and how many the last draw used */
+            size_t uploadedVertices;
+            size_t drawnVertices;
+    };
+}
@@ -0,0 +1,25 @@
+#version 460
+
+layout (location = 0) in vec4 inColor;
+layout (location = 1) in vec2 inTexCoord;
+
+layout (location = 0) out vec4 outColor;
+
+layout (binding = 0) uniform sampler2D texture0;
+
+/*
+** Glyphs keep the distance to their outline in alpha, 0.5 on it
+** fwidth is how much that changes per screen pixel, so the edge
+** stays one pixel soft at any scale
+*/
+void main()
+{
+    vec4 texel = texture(texture0, inTexCoord);
+
+    float distance = texel.a;
+    float width = max(fwidth(distance), 1e-4);
+
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+
+    outColor = inColor * vec4(texel.rgb, alpha);
+}
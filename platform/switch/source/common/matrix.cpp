@@ -1,41 +1,61 @@
 #include "common/matrix.h"
 
-#include <arm_neon.h>
+#if defined (__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
 #include <string.h>
 
 using namespace love;
 
+/*
+** Column-major 4x4 multiply, t = a * b
+** The headless build compiles this file too, hence the scalar path
+*/
 void Matrix4::Multiply(const Matrix4 & a, const Matrix4 & b, Elements & t)
 {
-    float32x4_t cola1 = vld1q_f32(&a.matrix[0]);
-    float32x4_t cola2 = vld1q_f32(&a.matrix[4]);
-    float32x4_t cola3 = vld1q_f32(&a.matrix[8]);
-    float32x4_t cola4 = vld1q_f32(&a.matrix[12]);
-
-    float32x4_t col1 = vmulq_n_f32(cola1, b.matrix[0]);
-    col1 = vmlaq_n_f32(col1, cola2, b.matrix[1]);
-    col1 = vmlaq_n_f32(col1, cola3, b.matrix[2]);
-    col1 = vmlaq_n_f32(col1, cola4, b.matrix[3]);
-
-    float32x4_t col2 = vmulq_n_f32(cola1, b.matrix[4]);
-    col2 = vmlaq_n_f32(col2, cola2, b.matrix[5]);
-    col2 = vmlaq_n_f32(col2, cola3, b.matrix[6]);
-    col2 = vmlaq_n_f32(col2, cola4, b.matrix[7]);
-
-    float32x4_t col3 = vmulq_n_f32(cola1, b.matrix[8]);
-    col3 = vmlaq_n_f32(col3, cola2, b.matrix[9]);
-    col3 = vmlaq_n_f32(col3, cola3, b.matrix[10]);
-    col3 = vmlaq_n_f32(col3, cola4, b.matrix[11]);
-
-    float32x4_t col4 = vmulq_n_f32(cola1, b.matrix[12]);
-    col4 = vmlaq_n_f32(col4, cola2, b.matrix[13]);
-    col4 = vmlaq_n_f32(col4, cola3, b.matrix[14]);
-    col4 = vmlaq_n_f32(col4, cola4, b.matrix[15]);
-
-    vst1q_f32(&t[0], col1);
-    vst1q_f32(&t[4], col2);
-    vst1q_f32(&t[8], col3);
-    vst1q_f32(&t[12], col4);
+    #if defined (__ARM_NEON)
+        float32x4_t cola1 = vld1q_f32(&a.matrix[0]);
+        float32x4_t cola2 = vld1q_f32(&a.matrix[4]);
+        float32x4_t cola3 = vld1q_f32(&a.matrix[8]);
+        float32x4_t cola4 = vld1q_f32(&a.matrix[12]);
+
+        float32x4_t col1 = vmulq_n_f32(cola1, b.matrix[0]);
+        col1 = vmlaq_n_f32(col1, cola2, b.matrix[1]);
+        col1 = vmlaq_n_f32(col1, cola3, b.matrix[2]);
+        col1 = vmlaq_n_f32(col1, cola4, b.matrix[3]);
+
+        float32x4_t col2 = vmulq_n_f32(cola1, b.matrix[4]);
+        col2 = vmlaq_n_f32(col2, cola2, b.matrix[5]);
+        col2 = vmlaq_n_f32(col2, cola3, b.matrix[6]);
+        col2 = vmlaq_n_f32(col2, cola4, b.matrix[7]);
+
+        float32x4_t col3 = vmulq_n_f32(cola1, b.matrix[8]);
+        col3 = vmlaq_n_f32(col3, cola2, b.matrix[9]);
+        col3 = vmlaq_n_f32(col3, cola3, b.matrix[10]);
+        col3 = vmlaq_n_f32(col3, cola4, b.matrix[11]);
+
+        float32x4_t col4 = vmulq_n_f32(cola1, b.matrix[12]);
+        col4 = vmlaq_n_f32(col4, cola2, b.matrix[13]);
+        col4 = vmlaq_n_f32(col4, cola3, b.matrix[14]);
+        col4 = vmlaq_n_f32(col4, cola4, b.matrix[15]);
+
+        vst1q_f32(&t[0], col1);
+        vst1q_f32(&t[4], col2);
+        vst1q_f32(&t[8], col3);
+        vst1q_f32(&t[12], col4);
+    #else
+        for (int column = 0; column < 4; column++)
+        {
+            for (int row = 0; row < 4; row++)
+            {
+                t[column * 4 + row] = a.matrix[row +  0] * b.matrix[column * 4 + 0] +
+                                      a.matrix[row +  4] * b.matrix[column * 4 + 1] +
+                                      a.matrix[row +  8] * b.matrix[column * 4 + 2] +
+                                      a.matrix[row + 12] * b.matrix[column * 4 + 3];
+            }
+        }
+    #endif
 }
 
 void Matrix4::Multiply(const Matrix4 & a, const Matrix4 & b, Matrix4 & t)
@@ -16,7 +16,7 @@
 /*
 ** Load the specified @buffer with @size into an std::unique_ptr
 */
-[[ nodiscard ]] std::unique_ptr<u32[]> CImage::loadPNG(const void * buffer, const size_t size, int & width, int & height)
+[[ nodiscard ]] std::unique_ptr<u8[]> CImage::loadPNG(const void * buffer, const size_t size, int & width, int & height)
 {
     png_image image;
     memset(&image, 0, sizeof(image));
@@ -36,7 +36,7 @@
     width  = image.width;
     height = image.height;
 
-    std::unique_ptr<u32[]> outBuffer = std::make_unique<u32[]>(width * height);
+    std::unique_ptr<u8[]> outBuffer = std::make_unique<u8[]>(width * height * 4);
 
     png_image_finish_read(&image, NULL, outBuffer.get(), PNG_IMAGE_ROW_STRIDE(image), NULL);
     png_image_free(&image);
@@ -85,14 +85,20 @@ bool CImage::load(CMemPool & imagePool, CMemPool & scratchPool, dk::Device devic
 {
     DkImageFormat imageFormat = DkImageFormat_RGBA8_Unorm;
 
-    if (auto uniqueBuffer = this->loadPNG(buffer, size, width, height); uniqueBuffer)
-        return this->loadMemory(imagePool, scratchPool, device, transferQueue, uniqueBuffer.get(), width, height, imageFormat);
-    else if (auto uniqueBuffer = this->loadJPG(buffer, size, width, height); uniqueBuffer)
+    if (auto uniqueBuffer = this->decode(buffer, size, width, height); uniqueBuffer)
         return this->loadMemory(imagePool, scratchPool, device, transferQueue, uniqueBuffer.get(), width, height, imageFormat);
 
     return false;
 }
 
+std::unique_ptr<u8[]> CImage::decode(const void * buffer, size_t size, int & width, int & height)
+{
+    if (auto uniqueBuffer = loadPNG(buffer, size, width, height); uniqueBuffer)
+        return uniqueBuffer;
+
+    return loadJPG(buffer, size, width, height);
+}
+
 size_t CImage::getFormatSize(DkImageFormat format)
 {
     switch (format)
@@ -2,13 +2,34 @@
 
 #include "deko3d/vertex.h"
 
+#include <glm/gtc/type_ptr.hpp>
+
+#include <bit>
+
 namespace {
     constexpr auto gpuFlags = (DkMemBlockFlags_GpuCached   | DkMemBlockFlags_Image    );
     constexpr auto cpuFlags = (DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached);
     constexpr auto shaderFlags = (DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code);
 }
 
-deko3d::deko3d() : firstVertex(0),
+deko3d::deko3d() : vertexData(nullptr),
+                   vertexAddr(DK_GPU_ADDR_INVALID),
+                   vertexCapacity(0),
+                   firstVertex(0),
+                   frameVertices(0),
+                   peakVertices(0),
+                   peakFrames(0),
+                   frameOverflows(0),
+                   uploadCount(0),
+                   transforms(1, glm::mat4(1.0f)),
+                   boundTransform(0),
+                   batch([this](const StreamBatch<BatchState>::Draw & draw) {
+                        this->FlushDraw(draw);
+                   }),
+                   boundTexture(~DkResHandle(0)),
+                   batchedDraws(0),
+                   lastFrame{},
+                   frameIndex(0),
                    renderState(STATE_MAX_ENUM),
                    /*
                    ** Create GPU device
@@ -163,9 +184,15 @@ void deko3d::EnsureInFrame()
 {
     if (!this->framebuffers.inFrame)
     {
-        this->firstVertex = 0;
+        this->boundTexture = ~DkResHandle(0);
         this->cmdRing.begin(this->cmdBuf);
         this->framebuffers.inFrame = true;
+
+        this->DestroyRetired();
+        this->ResizeVertexRing();
+
+        std::pair<void *, DkGpuAddr> data = this->vtxRing.begin();
+        this->BindVertexMemory(data.first, data.second, this->vtxRing.getSize());
     }
 }
 
@@ -185,6 +212,13 @@ void deko3d::EnsureInState(State state)
     {
         love::Shader::standardShaders[love::Shader::STANDARD_TEXTURE]->Attach();
 
+        this->cmdBuf.bindVtxAttribState(vertex::attributes::TextureAttribState);
+        this->cmdBuf.bindVtxBufferState(vertex::attributes::TextureBufferState);
+    }
+    else if (this->renderState == STATE_DISTANCE_FIELD)
+    {
+        love::Shader::standardShaders[love::Shader::STANDARD_DISTANCE_FIELD]->Attach();
+
         this->cmdBuf.bindVtxAttribState(vertex::attributes::TextureAttribState);
         this->cmdBuf.bindVtxBufferState(vertex::attributes::TextureBufferState);
     }
@@ -201,6 +235,10 @@ void deko3d::EnsureHasSlot()
         this->framebuffers.slot = this->queue.acquireImage(this->swapchain);
 }
 
+/*
+** The blend constant is not referenced by any of
+** the blend modes we set, so it doesn't break the batch
+*/
 void deko3d::SetBlendColor(const Colorf & color)
 {
     this->cmdBuf.setBlendConst(color.r, color.g, color.b, color.a);
@@ -213,6 +251,7 @@ void deko3d::SetBlendColor(const Colorf & color)
 void deko3d::ClearColor(const Colorf & color)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
 
     this->cmdBuf.clearColor(0, DkColorMask_RGBA, color.r, color.g, color.b, color.a);
 }
@@ -250,6 +289,8 @@ CMemPool & deko3d::GetData()
 void deko3d::SetDekoBarrier(DkBarrier barrier, uint32_t flags)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
+
     this->cmdBuf.barrier(barrier, flags);
 }
 
@@ -264,6 +305,8 @@ void deko3d::BindFramebuffer(love::Canvas * canvas)
     this->EnsureInFrame();
     this->EnsureHasSlot();
 
+    this->FlushBatch();
+
     if (this->framebuffers.dirty)
         this->SetDekoBarrier(DkBarrier_Fragments, 0);
 
@@ -293,18 +336,14 @@ void deko3d::BindFramebuffer(love::Canvas * canvas)
 
 void deko3d::BeginFrame()
 {
-    std::pair<void *, DkGpuAddr> data = this->vtxRing.begin();
-
-    this->vertexData = (vertex::Vertex *)data.first;
-
     this->cmdBuf.bindRasterizerState(this->state.rasterizer);
     this->cmdBuf.bindColorState(this->state.color);
     this->cmdBuf.bindColorWriteState(this->state.colorWrite);
     this->cmdBuf.bindBlendStates(0, this->state.blendState);
     // this->cmdBuf.bindDepthStencilState(this->state.depthStencil);
 
-    // Bind the current slice's GPU address to the buffer
-    this->cmdBuf.bindVtxBuffer(0, data.second, this->vtxRing.getSize());
+    // Bind whatever vertex memory the frame is currently writing to
+    this->cmdBuf.bindVtxBuffer(0, this->vertexAddr, this->vertexCapacity * sizeof(vertex::Vertex));
 }
 
 /*
@@ -316,11 +355,36 @@ void deko3d::Present()
 {
     if (this->framebuffers.inFrame)
     {
+        this->FlushBatch();
+
+        /* The next frame starts out untransformed, with a fresh list */
+        if (this->boundTransform != 0)
+        {
+            this->SetModelView(glm::mat4(1.0f));
+            this->boundTransform = 0;
+        }
+
+        this->transforms.resize(1);
+
         this->vtxRing.end();
         this->queue.submitCommands(this->cmdRing.end(this->cmdBuf));
         this->queue.presentImage(this->swapchain, this->framebuffers.slot);
 
         this->framebuffers.inFrame = false;
+        this->frameIndex++;
+
+        this->peakVertices = std::max(this->peakVertices, this->frameVertices);
+        this->peakFrames++;
+
+        this->lastFrame.drawCalls        = this->batch.GetFlushCount();
+        this->lastFrame.drawCallsBatched = this->batchedDraws;
+        this->lastFrame.vertexOverflows  = this->frameOverflows;
+
+        this->batch.ResetFlushCount();
+        this->batchedDraws   = 0;
+        this->frameOverflows = 0;
+
+        this->arena.Reset();
     }
 
     this->framebuffers.slot = -1;
@@ -328,6 +392,8 @@ void deko3d::Present()
 
 void deko3d::SetStencil(DkStencilOp op, DkCompareOp compare, int value)
 {
+    this->FlushBatch();
+
     bool enabled = (compare == DkCompareOp_Always) ? false : true;
 
     this->state.depthStencil.setStencilTestEnable(enabled);
@@ -358,7 +424,10 @@ void deko3d::UnRegisterResHandle(DkResHandle handle)
 
 DkResHandle deko3d::RegisterResHandle(const dk::ImageDescriptor & descriptor)
 {
+    this->FlushBatch();
+
     uint32_t index = this->allocator.Allocate();
+    this->boundTexture = ~DkResHandle(0);
 
     this->descriptors.image.update(this->cmdBuf, index, descriptor);
     this->descriptors.sampler.update(this->cmdBuf, index, this->filter.descriptor);
@@ -366,68 +435,430 @@ DkResHandle deko3d::RegisterResHandle(const dk::ImageDescriptor & descriptor)
     return dkMakeTextureHandle(index, index);
 }
 
-bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex * points, size_t count)
+void deko3d::BindVertexMemory(void * data, DkGpuAddr addr, uint32_t size)
+{
+    this->vertexData     = (vertex::Vertex *)data;
+    this->vertexAddr     = addr;
+    this->vertexCapacity = size / sizeof(vertex::Vertex);
+
+    this->firstVertex = 0;
+}
+
+/*
+** Make sure @count more vertices fit in the current vertex memory
+** Whenever they don't, the pending batch is emitted and the frame
+** continues in a new block from the data pool, as large as the ring
+** can ever get (or the draw, if larger); each block is retired right
+** away and destroyed once this frame's fence has passed
+** Draws are only dropped if the pool itself is exhausted
+** The next frame starts with a ring sized for everything asked for
+*/
+bool deko3d::EnsureVertexSpace(size_t count)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    this->EnsureInFrame();
+
+    this->frameVertices += count;
+
+    if (count <= (this->vertexCapacity - this->firstVertex))
+        return true;
+
+    this->FlushBatch();
+
+    size_t size = std::max(MAX_VERTEX_SLICE_SIZE, count * sizeof(vertex::Vertex));
+    CMemPool::Handle block = this->pool.data.allocate(size);
+
+    if (!block)
         return false;
 
-    this->EnsureInState(STATE_TEXTURE);
+    this->ReleaseDeferred(block);
+    this->frameOverflows++;
 
-    this->cmdBuf.bindTextures(DkStage_Fragment, 0, handle);
+    this->BindVertexMemory(block.getCpuAddr(), block.getGpuAddr(), block.getSize());
+    this->cmdBuf.bindVtxBuffer(0, this->vertexAddr, block.getSize());
 
-    memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
+    return true;
+}
+
+/*
+** Size the ring after the most vertices any frame used
+** over the last VERTEX_PEAK_FRAMES frames
+** It grows as soon as a frame has overflowed, but only
+** shrinks once a whole window stayed under a quarter of it
+** The old memory may still be read by frames in flight
+*/
+void deko3d::ResizeVertexRing()
+{
+    size_t current = this->vtxRing.getSize();
+    size_t needed  = this->peakVertices * sizeof(vertex::Vertex);
+
+    size_t target = current;
+
+    if (needed > current)
+        target = std::min(std::bit_ceil(needed), MAX_VERTEX_SLICE_SIZE);
+    else if (this->peakFrames >= VERTEX_PEAK_FRAMES && needed * 4 < current)
+        target = std::max(current / 2, VERTEX_COMMAND_SIZE / 2);
+
+    if (this->peakFrames >= VERTEX_PEAK_FRAMES)
+    {
+        this->peakVertices = 0;
+        this->peakFrames   = 0;
+    }
+
+    this->frameVertices = 0;
 
-    this->cmdBuf.draw(DkPrimitive_Quads, count, 1, this->firstVertex, 0);
+    if (target == current)
+        return;
+
+    this->ReleaseDeferred(this->vtxRing.release());
+
+    if (!this->vtxRing.allocate(this->pool.data, target))
+        this->vtxRing.allocate(this->pool.data, VERTEX_COMMAND_SIZE / 2);
+}
+
+void deko3d::AddToBatch(const BatchState & state, size_t count)
+{
+    if (this->batch.Add(state, this->firstVertex, count))
+        this->batchedDraws++;
 
     this->firstVertex += count;
+}
+
+void deko3d::FlushBatch()
+{
+    this->batch.Flush();
+}
+
+const deko3d::FrameStats & deko3d::GetLastFrame() const
+{
+    return this->lastFrame;
+}
+
+love::FrameArena & deko3d::GetFrameArena()
+{
+    return this->arena;
+}
+
+/*
+** The staging and command memory is retired at once;
+** the render queue waits on the copy before this frame
+** completes, so both are free by the time they're destroyed
+*/
+bool deko3d::UploadRegions(dk::Image & image, const void * data, size_t size,
+                           const CImage::Region * regions, size_t count)
+{
+    if (data == nullptr || count == 0)
+        return false;
+
+    CMemPool::Handle staging = this->pool.data.allocate(size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+
+    if (!staging)
+        return false;
+
+    memcpy(staging.getCpuAddr(), data, size);
+
+    /* A copy is a handful of words, this leaves plenty of room */
+    uint32_t commandSize = (count + 1) * 0x40;
+    CMemPool::Handle commands = this->pool.data.allocate(commandSize, DK_CMDMEM_ALIGNMENT);
+
+    if (!commands)
+    {
+        staging.destroy();
+        return false;
+    }
+
+    dk::UniqueCmdBuf uploadCmdBuf = dk::CmdBufMaker{this->device}.create();
+    uploadCmdBuf.addMemory(commands.getMemBlock(), commands.getOffset(), commands.getSize());
+
+    dk::ImageView imageView{image};
+
+    for (size_t index = 0; index < count; index++)
+    {
+        const love::Rect & rect = regions[index].rect;
+        DkGpuAddr source = staging.getGpuAddr() + regions[index].offset;
+
+        uploadCmdBuf.copyBufferToImage({source}, imageView,
+                                       {uint32_t(rect.x), uint32_t(rect.y), 0, uint32_t(rect.w), uint32_t(rect.h), 1});
+    }
+
+    this->SubmitUpload(uploadCmdBuf, commands);
+    this->ReleaseDeferred(staging);
 
     return true;
 }
 
-bool deko3d::RenderPolyline(const vertex::Vertex * points, size_t count)
+/*
+** The texture queue runs in order, so this sees every
+** upload made to @source before it
+*/
+bool deko3d::CopyImage(dk::Image & source, dk::Image & destination, uint32_t width, uint32_t height)
+{
+    CMemPool::Handle commands = this->pool.data.allocate(0x100, DK_CMDMEM_ALIGNMENT);
+
+    if (!commands)
+        return false;
+
+    dk::UniqueCmdBuf copyCmdBuf = dk::CmdBufMaker{this->device}.create();
+    copyCmdBuf.addMemory(commands.getMemBlock(), commands.getOffset(), commands.getSize());
+
+    dk::ImageView sourceView{source};
+    dk::ImageView destinationView{destination};
+
+    copyCmdBuf.copyImage(sourceView, {0, 0, 0, width, height, 1}, destinationView, {0, 0, 0, width, height, 1});
+
+    this->SubmitUpload(copyCmdBuf, commands);
+
+    return true;
+}
+
+/* Submit to the texture queue and make the render commands recorded next wait for it */
+void deko3d::SubmitUpload(dk::UniqueCmdBuf & commandBuffer, CMemPool::Handle commands)
+{
+    commandBuffer.signalFence(this->uploadFence, true);
+
+    this->textureQueue.submitCommands(commandBuffer.finishList());
+    this->textureQueue.flush();
+
+    this->EnsureInFrame();
+    this->FlushBatch();
+
+    this->cmdBuf.waitFence(this->uploadFence);
+
+    this->ReleaseDeferred(commands);
+
+    this->uploadCount++;
+}
+
+size_t deko3d::GetUploadCount() const
+{
+    return this->uploadCount;
+}
+
+/*
+** Records the actual draw for a batch
+** State binds happen here, not when vertices are queued,
+** so they land in the command buffer after any earlier draws
+*/
+void deko3d::FlushDraw(const StreamBatch<BatchState>::Draw & draw)
+{
+    this->EnsureInState(draw.state.renderState);
+
+    bool textured = (draw.state.renderState == STATE_TEXTURE || draw.state.renderState == STATE_DISTANCE_FIELD);
+
+    if (textured && draw.state.handle != this->boundTexture)
+    {
+        this->cmdBuf.bindTextures(DkStage_Fragment, 0, draw.state.handle);
+        this->boundTexture = draw.state.handle;
+    }
+
+    if (draw.state.transform != this->boundTransform)
+    {
+        this->SetModelView(this->transforms[draw.state.transform]);
+        this->boundTransform = draw.state.transform;
+    }
+
+    this->cmdBuf.draw(draw.state.primitive, draw.vertexCount, 1, draw.firstVertex, 0);
+}
+
+bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex * points, size_t count,
+                           bool distanceField)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    if (points == nullptr || !this->EnsureVertexSpace(count))
         return false;
 
-    this->EnsureInState(STATE_PRIMITIVE);
+    memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
+
+    State state = (distanceField) ? STATE_DISTANCE_FIELD : STATE_TEXTURE;
+    this->AddToBatch({ state, handle, DkPrimitive_Quads }, count);
+
+    return true;
+}
+
+/*
+** The vertices go into the ring untouched and the
+** model-view matrix does the transforming instead
+** The matrix is only pushed when the draw is flushed,
+** and only if it differs from the one already bound
+*/
+bool deko3d::RenderTexture(const DkResHandle handle, const vertex::Vertex * points, size_t count,
+                           const love::Matrix4 & transform)
+{
+    if (points == nullptr || !this->EnsureVertexSpace(count))
+        return false;
 
     memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
 
-    this->cmdBuf.draw(DkPrimitive_LineStrip, count, 1, this->firstVertex, 0);
+    glm::mat4 modelView = glm::make_mat4(transform.GetElements());
+
+    if (this->transforms.back() != modelView)
+        this->transforms.push_back(modelView);
+
+    uint32_t index = (uint32_t)(this->transforms.size() - 1);
+    this->AddToBatch({ STATE_TEXTURE, handle, DkPrimitive_Quads, index }, count);
+
+    return true;
+}
+
+vertex::Vertex * deko3d::ReserveVertices(size_t count, DkGpuAddr & gpuAddr)
+{
+    this->EnsureInFrame();
+
+    if (!this->EnsureVertexSpace(count))
+        return nullptr;
+
+    vertex::Vertex * vertices = this->vertexData + this->firstVertex;
+    gpuAddr = this->vertexAddr + this->firstVertex * sizeof(vertex::Vertex);
 
     this->firstVertex += count;
 
+    return vertices;
+}
+
+void deko3d::RenderMesh(love::Texture * texture, DkPrimitive primitive, const love::Matrix4 & transform,
+                        DkGpuAddr vertices, uint32_t size, uint32_t first, uint32_t count,
+                        DkGpuAddr indices, DkIdxFormat format, bool distanceField)
+{
+    this->EnsureInFrame();
+    this->FlushBatch();
+
+    if (texture == nullptr)
+        this->EnsureInState(STATE_PRIMITIVE);
+    else
+        this->EnsureInState((distanceField) ? STATE_DISTANCE_FIELD : STATE_TEXTURE);
+
+    if (texture != nullptr && texture->GetHandle() != this->boundTexture)
+    {
+        this->cmdBuf.bindTextures(DkStage_Fragment, 0, texture->GetHandle());
+        this->boundTexture = texture->GetHandle();
+    }
+
+    this->SetModelView(glm::make_mat4(transform.GetElements()));
+    this->cmdBuf.bindVtxBuffer(0, vertices, size);
+
+    if (indices != DK_GPU_ADDR_INVALID)
+    {
+        this->cmdBuf.bindIdxBuffer(format, indices);
+        this->cmdBuf.drawIndexed(primitive, count, 1, first, 0, 0);
+    }
+    else
+        this->cmdBuf.draw(primitive, count, 1, first, 0);
+
+    /* Everything else draws out of the ring */
+    this->cmdBuf.bindVtxBuffer(0, this->vertexAddr, this->vertexCapacity * sizeof(vertex::Vertex));
+
+    this->SetModelView(glm::mat4(1.0f));
+    this->boundTransform = 0;
+}
+
+uint64_t deko3d::GetFrameIndex() const
+{
+    return this->frameIndex;
+}
+
+/*
+** Starting a frame waits on the fence of the frame
+** that last used the same slice, which is MAX_FRAMEBUFFERS back
+*/
+bool deko3d::IsFrameComplete(uint64_t frame)
+{
+    this->EnsureInFrame();
+
+    return frame + MAX_FRAMEBUFFERS <= this->frameIndex;
+}
+
+void deko3d::ReleaseDeferred(CMemPool::Handle handle)
+{
+    if (handle)
+        this->retired.emplace_back(this->frameIndex, handle);
+}
+
+void deko3d::DestroyRetired()
+{
+    auto iterator = this->retired.begin();
+
+    while (iterator != this->retired.end())
+    {
+        if (iterator->first + MAX_FRAMEBUFFERS <= this->frameIndex)
+        {
+            iterator->second.destroy();
+            iterator = this->retired.erase(iterator);
+        }
+        else
+            iterator++;
+    }
+}
+
+void deko3d::SetModelView(const glm::mat4 & matrix)
+{
+    this->transformState.mdlvMtx = matrix;
+
+    this->cmdBuf.pushConstants(this->transformUniformBuffer.getGpuAddr(),
+                               this->transformUniformBuffer.getSize(), 0,
+                               sizeof(transformState), &transformState);
+}
+
+/*
+** Line strips can't be joined together,
+** so they're expanded into a list of segments
+*/
+bool deko3d::RenderPolyline(const vertex::Vertex * points, size_t count)
+{
+    if (points == nullptr || count < 2)
+        return false;
+
+    size_t lineCount = (count - 1) * 2;
+
+    if (!this->EnsureVertexSpace(lineCount))
+        return false;
+
+    vertex::Vertex * out = this->vertexData + this->firstVertex;
+
+    for (size_t index = 0; index + 1 < count; index++)
+    {
+        *out++ = points[index];
+        *out++ = points[index + 1];
+    }
+
+    this->AddToBatch({ STATE_PRIMITIVE, 0, DkPrimitive_Lines }, lineCount);
+
     return true;
 }
 
+/*
+** Same as above, triangle fans become triangle lists
+** The winding of each triangle is kept as-is
+*/
 bool deko3d::RenderPolygon(const vertex::Vertex * points, size_t count)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    if (points == nullptr || count < 3)
         return false;
 
-    this->EnsureInState(STATE_PRIMITIVE);
+    size_t triangleCount = (count - 2) * 3;
 
-    memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
+    if (!this->EnsureVertexSpace(triangleCount))
+        return false;
 
-    this->cmdBuf.draw(DkPrimitive_TriangleFan, count, 1, this->firstVertex, 0);
+    vertex::Vertex * out = this->vertexData + this->firstVertex;
 
-    this->firstVertex += count;
+    for (size_t index = 1; index + 1 < count; index++)
+    {
+        *out++ = points[0];
+        *out++ = points[index];
+        *out++ = points[index + 1];
+    }
+
+    this->AddToBatch({ STATE_PRIMITIVE, 0, DkPrimitive_Triangles }, triangleCount);
 
     return true;
 }
 
 bool deko3d::RenderPoints(const vertex::Vertex * points, size_t count)
 {
-    if (count > (this->vtxRing.getSize() - this->firstVertex) || points == nullptr)
+    if (points == nullptr || !this->EnsureVertexSpace(count))
         return false;
 
-    this->EnsureInState(STATE_PRIMITIVE);
-
     memcpy(this->vertexData + this->firstVertex, points, count * sizeof(vertex::Vertex));
 
-    this->cmdBuf.draw(DkPrimitive_Points, count, 1, this->firstVertex, 0);
-
-    this->firstVertex += count;
+    this->AddToBatch({ STATE_PRIMITIVE, 0, DkPrimitive_Points }, count);
 
     return true;
 }
@@ -435,12 +866,16 @@ bool deko3d::RenderPoints(const vertex::Vertex * points, size_t count)
 void deko3d::SetPointSize(float size)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
+
     this->cmdBuf.setPointSize(size);
 }
 
 void deko3d::SetLineWidth(float width)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
+
     this->cmdBuf.setLineWidth(width);
 }
 
@@ -465,12 +900,19 @@ void deko3d::SetColorMask(bool r, bool g, bool b, bool a)
     for (const std::pair<bool, uint32_t> pair : masks)
         mask |= pair.first ? pair.second : 0;
 
+    this->EnsureInFrame();
+    this->FlushBatch();
+
     this->state.colorWrite.setMask(0, mask);
+    this->cmdBuf.bindColorWriteState(this->state.colorWrite);
 }
 
 void deko3d::SetBlendMode(DkBlendOp func, DkBlendFactor srcColor, DkBlendFactor srcAlpha,
                           DkBlendFactor dstColor, DkBlendFactor dstAlpha)
 {
+    this->EnsureInFrame();
+    this->FlushBatch();
+
     this->state.blendState.setColorBlendOp(func);
     this->state.blendState.setAlphaBlendOp(func);
 
@@ -480,6 +922,8 @@ void deko3d::SetBlendMode(DkBlendOp func, DkBlendFactor srcColor, DkBlendFactor
 
     this->state.blendState.setDstColorBlendFactor(dstColor);
     this->state.blendState.setDstAlphaBlendFactor(dstAlpha);
+
+    this->cmdBuf.bindBlendStates(0, this->state.blendState);
 }
 
 void deko3d::SetFrontFaceWinding(DkFrontFace face)
@@ -503,6 +947,7 @@ void deko3d::SetCullMode(DkFace face)
 void deko3d::UseProgram(const love::Shader::Program & program)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
 
     this->cmdBuf.bindShaders(DkStageFlag_GraphicsMask, {*program.vertex, *program.fragment});
     this->cmdBuf.bindUniformBuffer(DkStage_Vertex, 0, this->transformUniformBuffer.getGpuAddr(), this->transformUniformBuffer.getSize());
@@ -545,6 +990,7 @@ void deko3d::SetTextureFilter(const love::Texture::Filter & filter)
 void deko3d::SetTextureFilter(love::Texture * texture, const love::Texture::Filter & filter)
 {
     this->SetTextureFilter(filter);
+    this->FlushBatch();
 
     uint32_t handleID = this->allocator.Find(texture->GetHandle());
     this->descriptors.sampler.update(this->cmdBuf, handleID, this->filter.descriptor);
@@ -563,6 +1009,7 @@ void deko3d::SetTextureWrap(const love::Texture::Wrap & wrap)
 void deko3d::SetTextureWrap(love::Texture * texture, const love::Texture::Wrap & wrap)
 {
     this->SetTextureWrap(wrap);
+    this->FlushBatch();
 
     uint32_t handleID = this->allocator.Find(texture->GetHandle());
     this->descriptors.sampler.update(this->cmdBuf, handleID, this->filter.descriptor);
@@ -591,6 +1038,7 @@ DkWrapMode deko3d::GetDekoWrapMode(love::Texture::WrapMode wrap)
 void deko3d::SetScissor(const love::Rect & scissor, bool canvasActive)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
 
     this->scissor = scissor;
     this->cmdBuf.setScissors(0, { {(uint32_t)scissor.x, (uint32_t)scissor.y,
@@ -604,6 +1052,7 @@ void deko3d::SetScissor(const love::Rect & scissor, bool canvasActive)
 void deko3d::SetViewport(const love::Rect & view)
 {
     this->EnsureInFrame();
+    this->FlushBatch();
 
     this->viewport = view;
     this->cmdBuf.setViewports(0, { {(float)view.x, (float)view.y,
@@ -113,6 +113,19 @@ Graphics::RendererInfo love::deko3d::Graphics::GetRendererInfo() const
     return info;
 }
 
+Graphics::Stats love::deko3d::Graphics::GetStats() const
+{
+    const ::deko3d::FrameStats & frame = ::deko3d::Instance().GetLastFrame();
+
+    Stats stats {};
+
+    stats.drawCalls        = (int)frame.drawCalls;
+    stats.drawCallsBatched = (int)frame.drawCallsBatched;
+    stats.vertexOverflows  = (int)frame.vertexOverflows;
+
+    return stats;
+}
+
 void love::deko3d::Graphics::SetColor(Colorf color)
 {
     love::Graphics::SetColor(color);
@@ -172,9 +185,6 @@ void love::deko3d::Graphics::SetDefaultFilter(const Texture::Filter & filter)
 
 void love::deko3d::Graphics::SetBlendMode(BlendMode mode, BlendAlpha alphamode)
 {
-    if (mode != this->states.back().blendMode || alphamode != this->states.back().blendAlphaMode)
-    {} // flush stream draws
-
     if (alphamode != BLENDALPHA_PREMULTIPLIED)
     {
         const char * modestr = "unknown";
@@ -272,20 +282,21 @@ void love::deko3d::Graphics::Polygon(DrawMode mode, const Vector2 * points,
 
     int vertexCount = (int)count - (mode == DRAW_FILL && skipLastVertex ? 1 : 0);
 
-    std::vector<vertex::Vertex> verts;
+    if (!is2D)
+        return;
 
-    if (is2D)
-    {
-        Vector2 transformed[vertexCount];
-        t.TransformXY(transformed, points, vertexCount);
+    FrameArena & arena = ::deko3d::Instance().GetFrameArena();
 
-        verts = vertex::GeneratePrimitiveFromVectors(transformed, vertexCount, color, 1);
-    }
+    Vector2 * transformed = arena.Allocate<Vector2>(vertexCount);
+    t.TransformXY(transformed, points, vertexCount);
+
+    vertex::Vertex * verts = arena.Allocate<vertex::Vertex>(vertexCount);
+    vertex::GeneratePrimitiveFromVectors(verts, transformed, vertexCount, color, 1);
 
     if (mode == DRAW_FILL)
-        ::deko3d::Instance().RenderPolygon(verts.data(), vertexCount);
+        ::deko3d::Instance().RenderPolygon(verts, vertexCount);
     else
-        ::deko3d::Instance().RenderPolyline(verts.data(), vertexCount);
+        ::deko3d::Instance().RenderPolyline(verts, vertexCount);
 }
 
 void love::deko3d::Graphics::SetLineWidth(float width)
@@ -293,226 +304,12 @@ void love::deko3d::Graphics::SetLineWidth(float width)
     ::deko3d::Instance().SetLineWidth(width);
 }
 
-void love::deko3d::Graphics::Line(const Vector2 * points, int count)
-{
-    this->Polygon(DRAW_LINE, points, count);
-}
-
-void love::deko3d::Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height)
-{
-    Vector2 points[5] =
-    {
-        { x, y,                 },
-        { x, y + height,        },
-        { x + width, y + height },
-        { x + width, y,         },
-        { x, y,                 }
-    };
-
-    this->Polygon(mode, points, 5);
-}
-
-void love::deko3d::Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry, int points)
-{
-    if (rx == 0 || ry == 0)
-    {
-        this->Rectangle(mode, x, y, width, height);
-        return;
-    }
-
-    // Radius values that are more than half the rectangle's size aren't handled
-    // correctly (for now)...
-
-    if (width >= 0.02f)
-        rx = std::min(rx, width / 2.0f - 0.01f);
-    if (height >= 0.02f)
-        ry = std::min(ry, height / 2.0f - 0.01f);
-
-    points = std::max(points / 4, 1);
-
-    const float half_pi = (float)(M_PI / 2);
-    float angle_shift = half_pi / ((float)points + 1.0f);
-
-    int num_coords = (points + 2) * 4;
-
-    Vector2 coords[num_coords + 1] = {};
-    float phi = .0f;
-
-    for (int i = 0; i <= points + 2; ++i, phi += angle_shift)
-    {
-        coords[i].x = x + rx * (1 - cosf(phi));
-        coords[i].y = y + ry * (1 - sinf(phi));
-    }
-
-    phi = half_pi;
-
-    for (int i = points + 2; i <= 2 * (points + 2); ++i, phi += angle_shift)
-    {
-        coords[i].x = x + width - rx * (1 + cosf(phi));
-        coords[i].y = y +         ry * (1 - sinf(phi));
-    }
-
-    phi = 2 * half_pi;
-
-    for (int i = 2 * (points + 2); i <= 3 * (points + 2); ++i, phi += angle_shift)
-    {
-        coords[i].x = x + width  - rx * (1 + cosf(phi));
-        coords[i].y = y + height - ry * (1 + sinf(phi));
-    }
-
-    phi = 3 * half_pi;
-
-    for (int i = 3 * (points + 2); i <= 4 * (points + 2); ++i, phi += angle_shift)
-    {
-        coords[i].x = x +          rx * (1 - cosf(phi));
-        coords[i].y = y + height - ry * (1 + sinf(phi));
-    }
-
-    coords[num_coords] = coords[0];
-
-    this->Polygon(mode, coords, num_coords + 1);
-}
-
-void love::deko3d::Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry)
-{
-    this->Rectangle(mode, x, y, width, height, rx, ry, this->CalculateEllipsePoints(rx, ry));
-}
-
-void love::deko3d::Graphics::Ellipse(DrawMode mode, float x, float y, float a, float b, int points)
-{
-    float two_pi = (float)(M_PI * 2);
-    if (points <= 0)
-        points = 1;
-
-    float angle_shift = (two_pi / points);
-    float phi = .0f;
-
-    // 1 extra point at the end for a closed loop, and 1 extra point at the
-    // start in filled mode for the vertex in the center of the ellipse.
-    int extrapoints = 1 + (mode == DRAW_FILL ? 1 : 0);
-
-    Vector2 coords[points + extrapoints] = {};
-
-    if (mode == DRAW_FILL)
-    {
-        coords[0].x = x;
-        coords[0].y = y;
-    }
-
-    for (int i = 0; i < points; ++i, phi += angle_shift)
-    {
-        coords[i].x = x + a * cosf(phi);
-        coords[i].y = y + b * sinf(phi);
-    }
-
-    coords[points] = coords[0];
-
-    // Last argument to polygon(): don't skip the last vertex in fill mode.
-    this->Polygon(mode, coords, points + extrapoints, false);
-}
-
-void love::deko3d::Graphics::Circle(DrawMode mode, float x, float y, float radius)
-{
-    this->Ellipse(mode, x, y, radius, radius);
-}
-
-void love::deko3d::Graphics::Circle(DrawMode mode, float x, float y, float radius, int points)
-{
-    this->Ellipse(mode, x, y, radius, radius, points);
-}
-
-void love::deko3d::Graphics::Ellipse(DrawMode mode, float x, float y, float a, float b)
-{
-    this->Ellipse(mode, x, y, a, b, this->CalculateEllipsePoints(a, b));
-}
-
-void love::deko3d::Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2, int points)
-{
-    /*
-    ** Nothing to display with no points or equal angles.
-    ** (Or is there with line mode?)
-    */
-    if (points <= 0 || angle1 == angle2)
-        return;
-
-    // Oh, you want to draw a circle?
-    if (fabs(angle1 - angle2) >= 2.0f * (float)M_PI)
-    {
-        this->Circle(drawmode, x, y, radius, points);
-        return;
-    }
-
-    float angle_shift = (angle2 - angle1) / points;
-
-    // Bail on precision issues.
-    if (angle_shift == 0.0f)
-        return;
-
-    /*
-    ** Prevent the connecting line from being drawn if a closed line arc has a
-    ** small angle. Avoids some visual issues when connected lines are at sharp
-    ** angles, due to the miter line join drawing code.
-    */
-    if (drawmode == DRAW_LINE && arcmode == ARC_CLOSED && fabsf(angle1 - angle2) < LOVE_TORAD(4))
-        arcmode = ARC_OPEN;
-
-    /*
-    ** Quick fix for the last part of a filled open arc not being drawn (because
-    ** polygon(DRAW_FILL, ...) doesn't work without a closed loop of vertices.)
-    */
-    if (drawmode == DRAW_FILL && arcmode == ARC_OPEN)
-        arcmode = ARC_CLOSED;
-
-    float phi = angle1;
-
-    int num_coords = 0;
-    Vector2 * coords = nullptr;
-
-    const auto createPoints = [&](Vector2 * coordinates)
-    {
-        for (int i = 0; i <= points; ++i, phi += angle_shift)
-        {
-            coordinates[i].x = x + radius * cosf(phi);
-            coordinates[i].y = y + radius * sinf(phi);
-        }
-    };
-
-    if (arcmode == ARC_PIE)
-    {
-        num_coords = points + 3;
-        coords = new Vector2[num_coords];
-
-        coords[0] = coords[num_coords - 1] = Vector2(x, y);
-
-        createPoints(coords + 1);
-    }
-    else if (arcmode == ARC_OPEN)
-    {
-        num_coords = points + 1;
-        coords = new Vector2[num_coords];
-
-        createPoints(coords);
-    }
-    else // ARC_CLOSED
-    {
-        num_coords = points + 2;
-        coords = new Vector2[num_coords];
-
-        createPoints(coords);
-
-        // Connect the ends of the arc.
-        coords[num_coords - 1] = coords[0];
-    }
-
-    this->Polygon(drawmode, coords, num_coords);
-    delete [] coords;
-}
-
 void love::deko3d::Graphics::Points(const Vector2 * points, size_t count, const Colorf * colors, size_t colorCount)
 {
-    std::vector<vertex::Vertex> verts = vertex::GeneratePrimitiveFromVectors(points, count, colors, colorCount);
+    vertex::Vertex * verts = ::deko3d::Instance().GetFrameArena().Allocate<vertex::Vertex>(count);
+    vertex::GeneratePrimitiveFromVectors(verts, points, count, colors, colorCount);
 
-    ::deko3d::Instance().RenderPoints(verts.data(), count);
+    ::deko3d::Instance().RenderPoints(verts, count);
 }
 
 void love::deko3d::Graphics::SetPointSize(float size)
@@ -521,24 +318,6 @@ void love::deko3d::Graphics::SetPointSize(float size)
     this->states.back().pointSize = size;
 }
 
-void love::deko3d::Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2)
-{
-    float points = (float)this->CalculateEllipsePoints(radius, radius);
-
-    // The amount of points is based on the fraction of the circle created by the arc.
-    float angle = fabsf(angle1 - angle2);
-    if (angle < 2.0f * (float)M_PI)
-        points *= angle / (2.0f * (float)M_PI);
-
-    this->Arc(drawmode, arcmode, x, y, radius, angle1, angle2, (int)(points + 0.5f));
-}
-
-int love::deko3d::Graphics::CalculateEllipsePoints(float rx, float ry) const
-{
-    int points = (int) sqrtf(((rx + ry) / 2.0f) * 20.0f * (float)this->pixelScaleStack.back());
-    return std::max(points, 8);
-}
-
 /* Primitives */
 
 void love::deko3d::Graphics::SetScissor(const Rect & scissor)
@@ -553,8 +332,6 @@ void love::deko3d::Graphics::SetScissor(const Rect & scissor)
 
 void love::deko3d::Graphics::SetColorMask(ColorMask mask)
 {
-    // flushStreamDraws();
-
     ::deko3d::Instance().SetColorMask(mask.r, mask.g, mask.b, mask.a);
     states.back().colorMask = mask;
 }
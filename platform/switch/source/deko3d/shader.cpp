@@ -5,6 +5,7 @@
 #include "s_vsh_dksh.h" //< Vertex Shader
 #include "s_fsh_dksh.h" //< Default Fragment Shader
 #include "t_fsh_dksh.h" //< Texture Fragment Shader
+#include "d_fsh_dksh.h" //< Distance Field Fragment Shader
 
 using namespace love;
 
@@ -51,6 +52,10 @@ void Shader::LoadDefaults(StandardShader type)
             this->program.vertex->loadMemory(::deko3d::Instance().GetCode(),   (void *)s_vsh_dksh, s_vsh_dksh_size);
             this->program.fragment->loadMemory(::deko3d::Instance().GetCode(), (void *)t_fsh_dksh, t_fsh_dksh_size);
             break;
+        case STANDARD_DISTANCE_FIELD:
+            this->program.vertex->loadMemory(::deko3d::Instance().GetCode(),   (void *)s_vsh_dksh, s_vsh_dksh_size);
+            this->program.fragment->loadMemory(::deko3d::Instance().GetCode(), (void *)d_fsh_dksh, d_fsh_dksh_size);
+            break;
         default:
             break;
     }
@@ -139,8 +144,9 @@ bool Shader::GetConstant(StandardShader in, const char *& out)
 
 StringMap<Shader::StandardShader, Shader::STANDARD_MAX_ENUM>::Entry Shader::shaderEntries[] =
 {
-    { "default", STANDARD_DEFAULT },
-    { "texture", STANDARD_TEXTURE }
+    { "default",       STANDARD_DEFAULT        },
+    { "texture",       STANDARD_TEXTURE        },
+    { "distancefield", STANDARD_DISTANCE_FIELD }
 };
 
 StringMap<Shader::StandardShader, Shader::STANDARD_MAX_ENUM> Shader::shaderNames(Shader::shaderEntries, sizeof(Shader::shaderEntries));
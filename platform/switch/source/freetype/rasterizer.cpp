@@ -1,6 +1,6 @@
 #include "freetype/rasterizer.h"
 
-#include "utf8/utf8.h"
+#include "common/utf8decode.h"
 
 using namespace love;
 
@@ -45,30 +45,30 @@ GlyphData * Rasterizer::GetGlyphData(const std::string & text) const
     return this->GetGlyphData(codepoint);
 }
 
+int Rasterizer::GetGlyphAdvance(uint32_t glyph) const
+{
+    love::GlyphData * data = this->GetGlyphData(glyph);
+    int advance = data->GetAdvance();
+
+    data->Release();
+
+    return advance;
+}
+
 bool Rasterizer::HasGlyphs(const std::string & text) const
 {
     if (text.size() == 0)
         return false;
 
-    try
-    {
-        utf8::iterator<std::string::const_iterator> i(text.begin(), text.begin(), text.end());
-        utf8::iterator<std::string::const_iterator> end(text.end(), text.begin(), text.end());
+    bool found = true;
 
-        while (i != end)
-        {
-            uint32_t codepoint = *i++;
-
-            if (!this->HasGlyph(codepoint))
-                return false;
-        }
-    }
-    catch (utf8::exception & e)
+    UTF8::ForEach(text.data(), text.size(), [&](uint32_t codepoint)
     {
-        throw love::Exception("UTF-8 decoding error: %s", e.what());
-    }
+        if (found && !this->HasGlyph(codepoint))
+            found = false;
+    });
 
-    return true;
+    return found;
 }
 
 float Rasterizer::GetKerning(uint32_t /*leftglyph*/, uint32_t /*rightglyph*/) const
@@ -79,4 +79,13 @@ float Rasterizer::GetKerning(uint32_t /*leftglyph*/, uint32_t /*rightglyph*/) co
 float Rasterizer::GetDPIScale() const
 {
     return this->dpiScale;
-}
\ No newline at end of file
+}
+bool Rasterizer::IsDistanceField() const
+{
+    return this->distanceField;
+}
+
+void Rasterizer::SetDistanceField(bool enable)
+{
+    this->distanceField = enable;
+}
@@ -2,10 +2,16 @@
 
 #include "deko3d/graphics.h"
 
+#include "common/distancefield.h"
+
+#include <vector>
+
 using namespace love;
 
 TrueTypeRasterizer::TrueTypeRasterizer(FT_Library library, love::Data * data,
-                                       int size, Hinting hinting) : data(data),
+                                       int size, Hinting hinting) : library(library),
+                                                                    size(size),
+                                                                    data(data),
                                                                     hinting(hinting)
 {
     /* dpiScale is 1.0f */
@@ -45,6 +51,18 @@ TrueTypeRasterizer::~TrueTypeRasterizer()
     FT_Done_Face(this->face);
 }
 
+/*
+** FreeType faces can't be shared between threads,
+** so this opens the same data again in its own face
+*/
+Rasterizer * TrueTypeRasterizer::Clone() const
+{
+    TrueTypeRasterizer * clone = new TrueTypeRasterizer(this->library, this->data.Get(), this->size, this->hinting);
+    clone->distanceField = this->distanceField;
+
+    return clone;
+}
+
 int TrueTypeRasterizer::GetLineHeight() const
 {
     return (int)(this->GetHeight() * 1.25);
@@ -69,8 +87,9 @@ GlyphData * TrueTypeRasterizer::GetGlyphData(uint32_t glyph) const
     if (error != FT_Err_Ok)
         throw love::Exception("TrueType Font glyph error: FT_Get_Glyph failed (0x%x)", error);
 
+    /* Distance fields want the antialiased edges, whatever the hinting */
     FT_Render_Mode rendermode = FT_RENDER_MODE_NORMAL;
-    if (this->hinting == HINTING_MONO)
+    if (this->hinting == HINTING_MONO && !this->distanceField)
         rendermode = FT_RENDER_MODE_MONO;
 
     error = FT_Glyph_To_Bitmap(&ftGlyph, rendermode, 0, 1);
@@ -88,6 +107,37 @@ GlyphData * TrueTypeRasterizer::GetGlyphData(uint32_t glyph) const
     glyphMetrics.width    = bitmap.width;
     glyphMetrics.advance  = (int)(ftGlyph->advance.x >> 16);
 
+    /*
+    ** Padded by the spread, so the field fades out
+    ** before it reaches the edge of the glyph
+    */
+    if (this->distanceField && bitmap.width > 0 && bitmap.rows > 0)
+    {
+        glyphMetrics.bearingX -= DISTANCE_FIELD_SPREAD;
+        glyphMetrics.bearingY += DISTANCE_FIELD_SPREAD;
+        glyphMetrics.width     = DistanceField::GetPadded(bitmap.width, DISTANCE_FIELD_SPREAD);
+        glyphMetrics.height    = DistanceField::GetPadded(bitmap.rows, DISTANCE_FIELD_SPREAD);
+
+        std::vector<uint8_t> field(glyphMetrics.width * glyphMetrics.height);
+        DistanceField::Generate(bitmap.buffer, bitmap.pitch, bitmap.width, bitmap.rows,
+                                DISTANCE_FIELD_SPREAD, field.data());
+
+        love::GlyphData * glyphData = new love::GlyphData(glyph, glyphMetrics);
+        uint8_t * dest = (uint8_t *)glyphData->GetData();
+
+        for (size_t index = 0; index < field.size(); index++)
+        {
+            dest[4 * index + 0] = 255;
+            dest[4 * index + 1] = 255;
+            dest[4 * index + 2] = 255;
+            dest[4 * index + 3] = field[index];
+        }
+
+        FT_Done_Glyph(ftGlyph);
+
+        return glyphData;
+    }
+
     // LOVE says it's LA8 pixel format
     love::GlyphData * glyphData = new love::GlyphData(glyph, glyphMetrics);
 
@@ -144,6 +194,21 @@ GlyphData * TrueTypeRasterizer::GetGlyphData(uint32_t glyph) const
     return glyphData;
 }
 
+/* Loads the outline for its hinted advance, but never renders it */
+int TrueTypeRasterizer::GetGlyphAdvance(uint32_t glyph) const
+{
+    FT_UInt loadOption = HintingToLoadOption(this->hinting);
+    FT_UInt charIndex  = FT_Get_Char_Index(this->face, glyph);
+
+    FT_Error error = FT_Load_Glyph(this->face, charIndex, FT_LOAD_DEFAULT | loadOption);
+
+    if (error != FT_Err_Ok)
+        throw love::Exception("TrueType Font glyph error: FT_Load_Glyph failed (0x%x)", error);
+
+    /* 26.6 here, the same whole pixels GetGlyphData gets from 16.16 */
+    return (int)(this->face->glyph->advance.x >> 6);
+}
+
 int TrueTypeRasterizer::GetGlyphCount() const
 {
     return (int)this->face->num_glyphs;
@@ -29,17 +29,39 @@ int Wrap_FontModule::NewRasterizer(lua_State * L)
     return 1;
 }
 
+/*
+** The hinting argument can also be a settings table,
+** { hinting = "normal", sdf = true }
+*/
+static const char * CheckHinting(lua_State * L, int index, bool & distanceField)
+{
+    if (!lua_istable(L, index))
+        return lua_isnoneornil(L, index) ? nullptr : luaL_checkstring(L, index);
+
+    lua_getfield(L, index, "sdf");
+    distanceField = lua_toboolean(L, -1);
+    lua_pop(L, 1);
+
+    /* The table keeps the string alive */
+    lua_getfield(L, index, "hinting");
+    const char * hintstr = lua_isnoneornil(L, -1) ? nullptr : luaL_checkstring(L, -1);
+    lua_pop(L, 1);
+
+    return hintstr;
+}
+
 int Wrap_FontModule::NewTrueTypeRasterizer(lua_State * L)
 {
     Rasterizer * self = nullptr;
 
     TrueTypeRasterizer::Hinting hinting = TrueTypeRasterizer::HINTING_NORMAL;
+    bool distanceField = false;
 
     if (lua_type(L, 1) == LUA_TNUMBER || lua_isnone(L, 1))
     {
         int size = (int) luaL_optinteger(L, 1, 12);
 
-        const char * hintstr = lua_isnoneornil(L, 2) ? nullptr : luaL_checkstring(L, 2);
+        const char * hintstr = CheckHinting(L, 2, distanceField);
         if (hintstr && !TrueTypeRasterizer::GetConstant(hintstr, hinting))
             return Luax::EnumError(L, "TrueType font hinting mode", TrueTypeRasterizer::GetConstants(hinting), hintstr);
 
@@ -79,7 +101,7 @@ int Wrap_FontModule::NewTrueTypeRasterizer(lua_State * L)
 
         int size = (int)luaL_optinteger(L, 2, 12);
 
-        const char * hintstr = lua_isnoneornil(L, 3) ? nullptr : luaL_checkstring(L, 3);
+        const char * hintstr = CheckHinting(L, 3, distanceField);
         if (hintstr && !TrueTypeRasterizer::GetConstant(hintstr, hinting))
             return Luax::EnumError(L, "TrueType font hinting mode", TrueTypeRasterizer::GetConstants(hinting), hintstr);
 
@@ -100,6 +122,8 @@ int Wrap_FontModule::NewTrueTypeRasterizer(lua_State * L)
         }
     }
 
+    self->SetDistanceField(distanceField);
+
     Luax::PushType(L, self);
     self->Release();
 
@@ -0,0 +1,113 @@
+#include "objects/atlas/atlas.h"
+
+#include "deko3d/CImage.h"
+
+using namespace love;
+
+love::Type Atlas::type("Atlas", &Object::type);
+
+Atlas::Atlas(int pageSize) : pageSize(pageSize)
+{
+    if (pageSize <= 0)
+        throw love::Exception("Invalid Atlas page size.");
+}
+
+Atlas::~Atlas()
+{}
+
+/*
+** Copy @pixels into a buffer PADDING larger on every side,
+** repeating the outermost row and column into the border
+*/
+static std::vector<uint32_t> Extrude(const uint32_t * pixels, int width, int height)
+{
+    int paddedWidth  = width  + Atlas::PADDING * 2;
+    int paddedHeight = height + Atlas::PADDING * 2;
+
+    std::vector<uint32_t> padded(paddedWidth * paddedHeight);
+
+    for (int y = 0; y < paddedHeight; y++)
+    {
+        int sourceY = std::clamp(y - Atlas::PADDING, 0, height - 1);
+
+        for (int x = 0; x < paddedWidth; x++)
+        {
+            int sourceX = std::clamp(x - Atlas::PADDING, 0, width - 1);
+            padded[y * paddedWidth + x] = pixels[sourceY * width + sourceX];
+        }
+    }
+
+    return padded;
+}
+
+Image * Atlas::Add(Data * data, Quad *& quad)
+{
+    int width = 0, height = 0;
+    std::unique_ptr<u8[]> pixels = CImage::decode(data->GetData(), data->GetSize(), width, height);
+
+    if (!pixels)
+        throw love::Exception("Failed to decode Image data.");
+
+    int paddedWidth  = width  + PADDING * 2;
+    int paddedHeight = height + PADDING * 2;
+
+    if (paddedWidth > this->pageSize || paddedHeight > this->pageSize)
+        throw love::Exception("Image is too large for the Atlas (%dx%d, page size %d).", width, height, this->pageSize);
+
+    Rect rect;
+    Page * target = nullptr;
+
+    for (Page & page : this->pages)
+    {
+        if (page.packer.Pack(paddedWidth, paddedHeight, rect))
+        {
+            target = &page;
+            break;
+        }
+    }
+
+    if (target == nullptr)
+    {
+        Image * image = new Image(Texture::TEXTURE_2D, this->pageSize, this->pageSize);
+
+        this->pages.push_back({ StrongReference<Image>(image, Acquire::NORETAIN),
+                                AtlasPacker(this->pageSize, this->pageSize) });
+
+        target = &this->pages.back();
+        target->packer.Pack(paddedWidth, paddedHeight, rect);
+    }
+
+    std::vector<uint32_t> padded = Extrude((const uint32_t *)pixels.get(), width, height);
+    target->image->ReplacePixels(padded.data(), padded.size() * sizeof(uint32_t), rect);
+
+    Quad::Viewport viewport = { double(rect.x + PADDING), double(rect.y + PADDING), double(width), double(height) };
+    quad = new Quad(viewport, this->pageSize, this->pageSize);
+
+    return target->image.Get();
+}
+
+size_t Atlas::GetPageCount() const
+{
+    return this->pages.size();
+}
+
+Image * Atlas::GetPage(size_t index) const
+{
+    if (index >= this->pages.size())
+        throw love::Exception("Invalid Atlas page: %zu", index + 1);
+
+    return this->pages[index].image.Get();
+}
+
+int Atlas::GetPageSize() const
+{
+    return this->pageSize;
+}
+
+float Atlas::GetOccupancy(size_t index) const
+{
+    if (index >= this->pages.size())
+        throw love::Exception("Invalid Atlas page: %zu", index + 1);
+
+    return this->pages[index].packer.GetOccupancy();
+}
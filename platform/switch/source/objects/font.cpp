@@ -9,269 +9,121 @@
 #include "deko3d/deko.h"
 #include "utf8/utf8.h"
 
+#include "common/utf8decode.h"
+
+#include <cmath>
+
 using namespace vertex;
 
 using namespace love;
 
 #define FONT_MODULE() (Module::GetInstance<FontModule>(Module::M_FONT))
 
-Font::Font(Rasterizer * r, const Texture::Filter & filter) : rasterizers({r}),
-                                                             height(r->GetHeight()),
-                                                             textureWidth(128),
-                                                             textureHeight(128),
-                                                             useSpacesAsTab(false),
-                                                             textureCacheID(0),
-                                                             dpiScale(r->GetDPIScale())
+Font::Font(Rasterizer * r, const Texture::Filter & filter) : height(r->GetHeight()),
+                                                             dpiScale(r->GetDPIScale()),
+                                                             textures(this->filter),
+                                                             atlas(r, this->textures, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT),
+                                                             layouts(MAX_LAYOUTS),
+                                                             layoutCacheID(0)
 {
     this->lineHeight = 1.0f;
 
     this->filter = filter;
     this->filter.mipmap = Texture::FILTER_NONE;
 
-    while (true)
-    {
-        if ((this->height * 0.8) * this->height * 30 <= this->textureWidth * this->textureHeight)
-            break;
-
-        TextureSize nextsize = this->GetNextTextureSize();
-
-        if (nextsize.width <= textureWidth && nextsize.height <= textureHeight)
-            break;
-
-        this->textureWidth = nextsize.width;
-        this->textureHeight = nextsize.height;
-    }
-
-    /* No tab character in the Rasterizer. */
-    if (!r->HasGlyph(9))
-        this->useSpacesAsTab = true;
-
-    this->textureCacheID++;
-
-    this->glyphs.clear();
-    this->images.clear();
-
-    this->CreateTexture();
+    /* Fields only work blended between texels */
+    if (r->IsDistanceField())
+        this->filter.min = this->filter.mag = Texture::FILTER_LINEAR;
 }
 
-Font::TextureSize Font::GetNextTextureSize() const
-{
-    TextureSize size = {this->textureWidth, this->textureHeight};
-
-    int maxSize = 2048;
+/* ATLAS TEXTURES */
 
-    int maxWidth  = std::min(8192, maxSize);
-    int maxHeight = std::min(4096, maxSize);
+Font::AtlasTextures::AtlasTextures(const Texture::Filter & filter) : filter(filter)
+{}
 
-    if (size.width * 2 <= maxWidth || size.height * 2 <= maxHeight)
-    {
-        // {128, 128} -> {256, 128} -> {256, 256} -> {512, 256} -> etc.
-        if (size.width == size.height)
-            size.width *= 2;
-        else
-            size.height *= 2;
-    }
-
-    return size;
-}
-
-void Font::CreateTexture()
+/*
+** Growing copies the old pixels over on the GPU
+** The old image stays alive until the frames drawing with it are done
+*/
+love::Texture * Font::AtlasTextures::Create(int width, int height, love::Texture * previous)
 {
     auto gfx = Module::GetInstance<deko3d::Graphics>(Module::M_GRAPHICS);
 
-    TextureSize size = {this->textureWidth, this->textureHeight};
-    TextureSize nextSize = this->GetNextTextureSize();
-
-    love::Image * texture = nullptr;
-    bool recreatetexture = false;
+    love::Image * texture = gfx->NewImage(love::Texture::TEXTURE_2D, width, height);
+    texture->SetFilter(this->filter);
 
-    /*
-    ** If we have an existing texture already, we'll try replacing it with a
-    ** larger-sized one rather than creating a second one. Having a single
-    ** texture reduces texture switches and draw calls when rendering.
-    */
-    if ((nextSize.width > size.width || nextSize.height > size.height) && !this->images.empty())
+    if (previous != nullptr)
     {
-        recreatetexture = true;
-        size = nextSize;
-        images.pop_back();
+        love::Image * image = (love::Image *)previous;
+        texture->CopyPixels(image, image->GetWidth(), image->GetHeight());
+
+        uint64_t frame = ::deko3d::Instance().GetFrameIndex();
+        this->retired.emplace_back(frame, image);
     }
 
-    texture = gfx->NewImage(love::Texture::TEXTURE_2D, size.width, size.height);
-    texture->SetFilter(this->filter);
+    return texture;
+}
 
-    this->images.emplace_back(texture, Acquire::NORETAIN);
+void Font::AtlasTextures::Upload(love::Texture * texture, const std::vector<uint8_t> & pixels,
+                                 const std::vector<GlyphAtlas::Region> & regions)
+{
+    this->regions.clear();
 
-    this->textureWidth  = size.width;
-    this->textureHeight = size.height;
+    for (const auto & region : regions)
+        this->regions.push_back({ region.rect, region.offset });
 
-    this->rowHeight = this->textureX = this->textureY = this->TEXTURE_PADDING;
+    ((love::Image *)texture)->ReplacePixels(pixels.data(), pixels.size(), this->regions);
+}
 
-    if (recreatetexture)
-    {
-        this->textureCacheID++;
+void Font::AtlasTextures::ReleaseRetired()
+{
+    if (this->retired.empty())
+        return;
 
-        std::vector<uint32_t> glyphsToAdd;
+    std::erase_if(this->retired, [](const auto & retired) {
+        return ::deko3d::Instance().IsFrameComplete(retired.first);
+    });
+}
 
-        for (const auto & glyphPair : this->glyphs)
-            glyphsToAdd.push_back(glyphPair.first);
+/* ATLAS TEXTURES */
 
-        this->glyphs.clear();
+/* Text left waiting on the loader sees a new cache ID next frame */
+void Font::FlushGlyphs()
+{
+    this->atlas.PublishPreloaded();
 
-        for (uint32_t glyph : glyphsToAdd)
-            this->AddGlyph(glyph);
-    }
+    this->textures.ReleaseRetired();
+    this->atlas.Flush();
 }
 
 uint32_t Font::GetTextureCacheID()
 {
-    return this->textureCacheID;
+    return this->atlas.GetCacheID();
 }
 
-love::GlyphData * Font::GetRasterizerGlyphData(uint32_t glyph)
+const Font::Glyph & Font::FindGlyph(uint32_t glyph)
 {
-    /* Use spaces for the tab 'glyph' */
-    if (glyph == 9 && useSpacesAsTab)
-    {
-        love::GlyphData * spacegd = this->rasterizers[0]->GetGlyphData(32);
-
-        love::GlyphData::GlyphMetrics gm = {};
-
-        gm.advance  = spacegd->GetAdvance() * SPACES_PER_TAB;
-        gm.bearingX = spacegd->GetBearingX();
-        gm.bearingY = spacegd->GetBearingY();
-
-        spacegd->Release();
-
-        return new love::GlyphData(glyph, gm);
-    }
-
-    for (const auto & r : rasterizers)
-    {
-        if (r->HasGlyph(glyph))
-            return r->GetGlyphData(glyph);
-    }
-
-    return rasterizers[0]->GetGlyphData(glyph);
+    return this->atlas.FindGlyph(glyph);
 }
 
-const Font::Glyph & Font::FindGlyph(uint32_t glyph)
+void Font::Preload(const std::vector<uint32_t> & codepoints)
 {
-    const auto it = this->glyphs.find(glyph);
-
-    if (it != this->glyphs.end())
-        return it->second;
-
-    return this->AddGlyph(glyph);
+    this->atlas.Preload(codepoints);
 }
 
-static inline uint16_t norm16(double n)
+void Font::SetAutoPreload(bool enable)
 {
-    return uint16_t(n * 0xFFFF);
+    this->atlas.SetAutoPreload(enable);
 }
 
-const Font::Glyph & Font::AddGlyph(uint32_t glyph)
+bool Font::GetAutoPreload() const
 {
-    love::StrongReference<love::GlyphData> gd(this->GetRasterizerGlyphData(glyph), Acquire::NORETAIN);
-
-    int width  = gd->GetWidth();
-    int height = gd->GetHeight();
-
-    if (width + this->TEXTURE_PADDING * 2 < this->textureWidth && height + this->TEXTURE_PADDING * 2 < this->textureHeight)
-    {
-        if (this->textureX + width + this->TEXTURE_PADDING > this->textureWidth)
-        {
-            // Out of space - new row!
-            this->textureX = this->TEXTURE_PADDING;
-            this->textureY += this->rowHeight;
-            this->rowHeight = this->TEXTURE_PADDING;
-        }
-
-        if (this->textureY + height + this->TEXTURE_PADDING > this->textureHeight)
-        {
-            /* Totally out of space - new texture! */
-            this->CreateTexture();
-
-            /* Ensure last glyph is re-added */
-            return this->AddGlyph(glyph);
-        }
-    }
-
-    Glyph g;
-
-    g.texture = 0;
-    g.spacing = floorf(gd->GetAdvance() / this->dpiScale + 0.5f);
-
-    std::fill_n(g.vertices, 4, GlyphVertex{});
-
-    /* Don't waste space on empty glyphs */
-    if (width > 0 && height > 0)
-    {
-        Image * image = images.back();
-        g.texture = image;
-
-        Rect rect = {this->textureX, this->textureY, gd->GetWidth(), gd->GetHeight()};
-
-        image->ReplacePixels(gd->GetData(), gd->GetSize(), rect);
-
-        double tX     = (double)this->textureX,     tY      = (double)this->textureY;
-        double tWidth = (double)this->textureWidth, tHeight = (double)this->textureHeight;
-
-        Colorf c(1.0f, 1.0f, 1.0f, 1.0f);
-
-        // Extrude the quad borders by 1 pixel. We have an extra pixel of
-        // transparent padding in the texture atlas, so the quad extrusion will
-        // add some antialiasing at the edges of the quad.
-        int o = 1;
-
-        // 0---3
-        // |   |
-        // 1---2
-        const GlyphVertex verts[4] =
-        {
-            { float(-o),                    float(-o),                     norm16((tX - o) / tWidth),         norm16((tY - o) / tHeight),          c },
-            { float(-o),                    (height + o) / this->dpiScale, norm16((tX - o) / tWidth),         norm16((tY + height + o) / tHeight), c },
-            { (width + o) / this->dpiScale, (height + o) / this->dpiScale, norm16((tX + width + o) / tWidth), norm16((tY + height + o) / tHeight), c },
-            { (width + o) / this->dpiScale, float(-o),                     norm16((tX + width + o) / tWidth), norm16((tY - o) / tHeight),          c },
-        };
-
-        // Copy vertex data to the glyph
-        // and set proper bearing.
-        for (int i = 0; i < 4; i++)
-        {
-            g.vertices[i] = verts[i];
-
-            g.vertices[i].x += gd->GetBearingX() / this->dpiScale;
-            g.vertices[i].y -= gd->GetBearingY() / this->dpiScale;
-        }
-
-        this->textureX += width + this->TEXTURE_PADDING;
-        this->rowHeight = std::max(this->rowHeight, height + this->TEXTURE_PADDING);
-    }
-
-    this->glyphs[glyph] = g;
-    return this->glyphs[glyph];
+    return this->atlas.GetAutoPreload();
 }
 
 void Font::GetCodepointsFromString(const std::string & text, Codepoints & codepoints)
 {
-    codepoints.reserve(text.size());
-
-    try
-    {
-        utf8::iterator<std::string::const_iterator> i(text.begin(), text.begin(), text.end());
-        utf8::iterator<std::string::const_iterator> end(text.end(), text.begin(), text.end());
-
-        while (i != end)
-        {
-            uint32_t g = *i++;
-            codepoints.push_back(g);
-        }
-    }
-    catch (utf8::exception & e)
-    {
-        throw love::Exception("UTF-8 decoding error: %s", e.what());
-    }
+    UTF8::Decode(text.data(), text.size(), codepoints);
 }
 
 void Font::GetCodepointsFromString(const std::vector<ColoredString> & strings, ColoredCodepoints & codepoints)
@@ -302,10 +154,7 @@ void Font::GetCodepointsFromString(const std::vector<ColoredString> & strings, C
 }
 
 Font::~Font()
-{
-    this->glyphs.clear();
-    this->images.clear();
-}
+{}
 
 std::vector<Font::DrawCommand> Font::GenerateVertices(const ColoredCodepoints & codepoints, const Colorf & constantColor,
                                                       std::vector<GlyphVertex> & glyphVertices, float extra_spacing,
@@ -320,7 +169,7 @@ std::vector<Font::DrawCommand> Font::GenerateVertices(const ColoredCodepoints &
 
     float heightoffset = 0.0f;
 
-    if (this->rasterizers[0]->GetDataType() == Rasterizer::DATA_TRUETYPE)
+    if (this->atlas.GetRasterizers()[0]->GetDataType() == Rasterizer::DATA_TRUETYPE)
         heightoffset = this->GetBaseline();
 
     int maxwidth = 0;
@@ -376,7 +225,7 @@ std::vector<Font::DrawCommand> Font::GenerateVertices(const ColoredCodepoints &
         if (glyphChar == '\r')
             continue;
 
-        uint32_t cacheID = this->textureCacheID;
+        uint32_t cacheID = this->atlas.GetCacheID();
 
         const Glyph & glyph = this->FindGlyph(glyphChar);
 
@@ -384,7 +233,7 @@ std::vector<Font::DrawCommand> Font::GenerateVertices(const ColoredCodepoints &
         ** If findGlyph invalidates the texture cache
         ** restart the loop.
         */
-        if (cacheID != this->textureCacheID)
+        if (cacheID != this->atlas.GetCacheID())
         {
             i = -1; // The next iteration will increment this to 0.
             maxwidth = 0;
@@ -476,7 +325,7 @@ std::vector<Font::DrawCommand> Font::GenerateVerticesFormatted(const ColoredCode
 {
     wrap = std::max(wrap, 0.0f);
 
-    uint32_t cacheid = this->textureCacheID;
+    uint32_t cacheid = this->atlas.GetCacheID();
 
     std::vector<DrawCommand> drawcommands;
     vertices.reserve(text.codes.size() * 4);
@@ -553,7 +402,7 @@ std::vector<Font::DrawCommand> Font::GenerateVerticesFormatted(const ColoredCode
         info->height = (int) y;
     }
 
-    if (cacheid != textureCacheID)
+    if (cacheid != this->atlas.GetCacheID())
     {
         vertices.clear();
         drawcommands = this->GenerateVerticesFormatted(text, constantColor, wrap, align, vertices);
@@ -564,50 +413,92 @@ std::vector<Font::DrawCommand> Font::GenerateVerticesFormatted(const ColoredCode
 
 float Font::GetKerning(uint32_t leftGlyph, uint32_t rightGlyph)
 {
-    uint64_t packed = ((uint64_t)leftGlyph << 32) | (uint64_t)rightGlyph;
-    const auto iterator = this->kerning.find(packed);
-
-    if (iterator != this->kerning.end())
-        return iterator->second;
-
-    float kern = rasterizers[0]->GetKerning(leftGlyph, rightGlyph);
+    return this->kerning.Get(leftGlyph, rightGlyph, [this](uint32_t left, uint32_t right) {
+        return this->FindKerning(left, right);
+    });
+}
 
-    for (const auto & rasterizer : this->rasterizers)
+/* Kerning from the first rasterizer that has both glyphs */
+float Font::FindKerning(uint32_t leftGlyph, uint32_t rightGlyph)
+{
+    for (const auto & rasterizer : this->atlas.GetRasterizers())
     {
         if (rasterizer->HasGlyph(leftGlyph) && rasterizer->HasGlyph(rightGlyph))
-        {
-            kern = floorf(rasterizer->GetKerning(leftGlyph, rightGlyph) / this->dpiScale + 0.5f);
-            break;
-        }
+            return floorf(rasterizer->GetKerning(leftGlyph, rightGlyph) / this->dpiScale + 0.5f);
     }
 
-    this->kerning[packed] = kern;
+    return this->atlas.GetRasterizers()[0]->GetKerning(leftGlyph, rightGlyph);
+}
 
-    return kern;
+int Font::GetGlyphSpacing(uint32_t glyph)
+{
+    return this->atlas.GetGlyphSpacing(glyph);
 }
 
 void Font::Print(Graphics * gfx, const std::vector<Font::ColoredString> & text,
                  const Matrix4 & localTransform, const Colorf & color)
 {
-    ColoredCodepoints codepoints;
-    Font::GetCodepointsFromString(text, codepoints);
+    const Layout & layout = this->GetLayout(text, color, false);
 
-    std::vector<GlyphVertex> vertices;
-    std::vector<DrawCommand> drawCommands = this->GenerateVertices(codepoints, color, vertices);
-
-    this->PrintV(gfx, localTransform, drawCommands, vertices);
+    this->PrintV(gfx, localTransform, layout.commands, layout.vertices);
 }
 
 void Font::Printf(Graphics * gfx, const std::vector<Font::ColoredString> & text, float wrap,
                   Font::AlignMode align, const Matrix4 & localTransform, const Colorf & color)
 {
+    const Layout & layout = this->GetLayout(text, color, true, wrap, align);
+
+    this->PrintV(gfx, localTransform, layout.commands, layout.vertices);
+}
+
+/*
+** HUD text tends to be the same every frame, so the
+** layout is only done again when something about it changed
+*/
+const Font::Layout & Font::GetLayout(const std::vector<ColoredString> & text, const Colorf & color,
+                                     bool formatted, float wrap, AlignMode align)
+{
+    this->atlas.PublishPreloaded();
+
+    if (this->layoutCacheID != this->atlas.GetCacheID())
+    {
+        this->layouts.Clear();
+        this->layoutCacheID = this->atlas.GetCacheID();
+    }
+
+    Font::GetLayoutKey(this->layoutKey, text, color, formatted, wrap, align);
+
+    if (Layout * cached = this->layouts.Find(this->layoutKey))
+        return *cached;
+
     ColoredCodepoints codepoints;
     Font::GetCodepointsFromString(text, codepoints);
 
-    std::vector<GlyphVertex> vertices;
-    std::vector<DrawCommand> drawCommands = this->GenerateVerticesFormatted(codepoints, color, wrap, align, vertices);
+    Layout layout;
 
-    this->PrintV(gfx, localTransform, drawCommands, vertices);
+    if (formatted)
+        layout.commands = this->GenerateVerticesFormatted(codepoints, color, wrap, align, layout.vertices);
+    else
+        layout.commands = this->GenerateVertices(codepoints, color, layout.vertices);
+
+    /* New glyphs may have grown the textures, making older entries stale */
+    if (this->layoutCacheID != this->atlas.GetCacheID())
+    {
+        this->layouts.Clear();
+        this->layoutCacheID = this->atlas.GetCacheID();
+    }
+
+    return this->layouts.Insert(this->layoutKey, std::move(layout));
+}
+
+size_t Font::GetLayoutCacheHits() const
+{
+    return this->layouts.GetHits();
+}
+
+size_t Font::GetLayoutCacheMisses() const
+{
+    return this->layouts.GetMisses();
 }
 
 void Font::PrintV(Graphics * gfx, const Matrix4 & t, const std::vector<DrawCommand> & drawCommands,
@@ -616,18 +507,22 @@ void Font::PrintV(Graphics * gfx, const Matrix4 & t, const std::vector<DrawComma
     if (vertices.empty() || drawCommands.empty())
         return;
 
+    this->FlushGlyphs();
+
     Matrix4 m(gfx->GetTransform(), t);
+    FrameArena & arena = ::deko3d::Instance().GetFrameArena();
 
     for (const DrawCommand & cmd : drawCommands)
     {
-        vertex::GlyphVertex vertexData[cmd.vertexCount];
+        GlyphVertex * vertexData = arena.Allocate<GlyphVertex>(cmd.vertexCount);
 
         memcpy(vertexData, &vertices[cmd.startVertex], sizeof(GlyphVertex) * cmd.vertexCount);
         m.TransformXY(vertexData, &vertices[cmd.startVertex], cmd.vertexCount);
 
-        std::vector<Vertex> verts = vertex::GenerateTextureFromGlyphs(vertexData, cmd.vertexCount);
+        Vertex * verts = arena.Allocate<Vertex>(cmd.vertexCount);
+        vertex::GenerateTextureFromGlyphs(verts, vertexData, cmd.vertexCount);
 
-        ::deko3d::Instance().RenderTexture(cmd.texture->GetHandle(), verts.data(), cmd.vertexCount);
+        ::deko3d::Instance().RenderTexture(cmd.texture->GetHandle(), verts, cmd.vertexCount, this->IsDistanceField());
     }
 }
 
@@ -724,8 +619,7 @@ void Font::GetWrap(const ColoredCodepoints & codepoints, float wraplimit, std::v
             continue;
         }
 
-        const Glyph &g = this->FindGlyph(c);
-        float charwidth = g.spacing + this->GetKerning(prevglyph, c);
+        float charwidth = this->GetGlyphSpacing(c) + this->GetKerning(prevglyph, c);
         float newwidth = width + charwidth;
 
         // Wrap the line if it exceeds the wrap limit. Don't wrap yet if we're
@@ -818,14 +712,19 @@ void Font::GetWrap(const ColoredCodepoints & codepoints, float wraplimit, std::v
     }
 }
 
+bool Font::IsDistanceField() const
+{
+    return this->atlas.GetRasterizers()[0]->IsDistanceField();
+}
+
 float Font::GetAscent() const
 {
-    return floorf(this->rasterizers[0]->GetAscent() / this->dpiScale + 0.5f);
+    return floorf(this->atlas.GetRasterizers()[0]->GetAscent() / this->dpiScale + 0.5f);
 }
 
 float Font::GetDescent() const
 {
-    return floorf(this->rasterizers[0]->GetDescent() / this->dpiScale + 0.5f);
+    return floorf(this->atlas.GetRasterizers()[0]->GetDescent() / this->dpiScale + 0.5f);
 }
 
 float Font::GetHeight() const
@@ -839,7 +738,7 @@ float Font::GetBaseline() const
 
     if (ascent != 0.0f)
         return ascent;
-    else if (this->rasterizers[0]->GetDataType() == love::Rasterizer::DATA_TRUETYPE)
+    else if (this->atlas.GetRasterizers()[0]->GetDataType() == love::Rasterizer::DATA_TRUETYPE)
         return floorf(this->GetHeight() / 1.25f + 0.5f);
     else
         return 0.0f;
@@ -847,8 +746,7 @@ float Font::GetBaseline() const
 
 int Font::GetWidth(uint32_t prevGlyph, uint32_t current)
 {
-    const Glyph & g = this->FindGlyph(current);
-    return g.spacing + this->GetKerning(prevGlyph, current);
+    return this->GetGlyphSpacing(current) + this->GetKerning(prevGlyph, current);
 }
 
 StringMap<love::Font::SystemFontType, love::Font::MAX_SYSFONTS>::Entry love::common::Font::sharedFontEntries[] =
@@ -0,0 +1,560 @@
+#include "objects/font/glyphatlas.h"
+
+#include <cmath>
+
+using namespace vertex;
+
+using namespace love;
+
+GlyphAtlas::GlyphAtlas(Rasterizer * rasterizer, Textures & textures, size_t uploadAlignment) : rasterizers({rasterizer}),
+                                                                                              textures(textures),
+                                                                                              uploadAlignment(uploadAlignment),
+                                                                                              dpiScale(rasterizer->GetDPIScale()),
+                                                                                              useSpacesAsTab(false),
+                                                                                              textureWidth(128),
+                                                                                              textureHeight(128),
+                                                                                              cacheID(0),
+                                                                                              packer(0, 0),
+                                                                                              autoPreload(false),
+                                                                                              placeholder{},
+                                                                                              loader(nullptr)
+{
+    int height = rasterizer->GetHeight();
+
+    while (true)
+    {
+        if ((height * 0.8) * height * 30 <= this->textureWidth * this->textureHeight)
+            break;
+
+        TextureSize nextsize = this->GetNextTextureSize();
+
+        if (nextsize.width <= textureWidth && nextsize.height <= textureHeight)
+            break;
+
+        this->textureWidth = nextsize.width;
+        this->textureHeight = nextsize.height;
+    }
+
+    /* No tab character in the Rasterizer. */
+    if (!rasterizer->HasGlyph(9))
+        this->useSpacesAsTab = true;
+
+    this->denseGlyphs.fill(nullptr);
+    this->denseAdvances.fill(NO_ADVANCE);
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    if (this->loader != nullptr)
+    {
+        this->loader->SetFinish();
+        this->loader->Wait();
+
+        delete this->loader;
+    }
+}
+
+GlyphAtlas::TextureSize GlyphAtlas::GetNextTextureSize() const
+{
+    TextureSize size = {this->textureWidth, this->textureHeight};
+
+    int maxSize = 2048;
+
+    int maxWidth  = std::min(8192, maxSize);
+    int maxHeight = std::min(4096, maxSize);
+
+    if (size.width * 2 <= maxWidth || size.height * 2 <= maxHeight)
+    {
+        // {128, 128} -> {256, 128} -> {256, 256} -> {512, 256} -> etc.
+        if (size.width == size.height)
+            size.width *= 2;
+        else
+            size.height *= 2;
+    }
+
+    return size;
+}
+
+static inline uint16_t norm16(double n)
+{
+    return uint16_t(n * 0xFFFF);
+}
+
+/*
+** Growing the last texture copies its pixels over,
+** so cached glyphs keep their place and only get new texture
+** coordinates; nothing is rasterized again
+*/
+void GlyphAtlas::CreateTexture()
+{
+    TextureSize size = {this->textureWidth, this->textureHeight};
+    TextureSize nextSize = this->GetNextTextureSize();
+
+    /*
+    ** If we have an existing texture already, we'll try replacing it with a
+    ** larger-sized one rather than creating a second one. Having a single
+    ** texture reduces texture switches and draw calls when rendering.
+    */
+    bool growTexture = (nextSize.width > size.width || nextSize.height > size.height) && !this->pages.empty();
+
+    if (growTexture)
+        size = nextSize;
+
+    /* The last texture is done either way */
+    this->Flush();
+
+    love::Texture * previous = growTexture ? this->pages.back().Get() : nullptr;
+    love::Texture * texture  = this->textures.Create(size.width, size.height, previous);
+
+    if (growTexture)
+    {
+        this->pages.back().Set(texture, Acquire::NORETAIN);
+        this->packer.Resize(size.width - TEXTURE_PADDING, size.height - TEXTURE_PADDING);
+    }
+    else
+    {
+        this->pages.emplace_back(texture, Acquire::NORETAIN);
+        this->packer = AtlasPacker(size.width - TEXTURE_PADDING, size.height - TEXTURE_PADDING);
+    }
+
+    this->textureWidth  = size.width;
+    this->textureHeight = size.height;
+
+    if (growTexture)
+    {
+        this->cacheID++;
+
+        /* @previous may be gone by now, only its address is compared */
+        for (auto & glyphPair : this->glyphs)
+        {
+            Glyph & glyph = glyphPair.second;
+
+            if (glyph.texture == previous)
+            {
+                glyph.texture = texture;
+                this->SetTexCoords(glyph);
+            }
+        }
+    }
+}
+
+void GlyphAtlas::SetTexCoords(Glyph & glyph) const
+{
+    double tX     = (double)glyph.rect.x,        tY      = (double)glyph.rect.y;
+    double width  = (double)glyph.rect.w,        height  = (double)glyph.rect.h;
+    double tWidth = (double)this->textureWidth,  tHeight = (double)this->textureHeight;
+
+    // Extrude the quad borders by 1 pixel. We have an extra pixel of
+    // transparent padding in the texture atlas, so the quad extrusion will
+    // add some antialiasing at the edges of the quad.
+    int o = 1;
+
+    uint16_t left   = norm16((tX - o) / tWidth),          top    = norm16((tY - o) / tHeight);
+    uint16_t right  = norm16((tX + width + o) / tWidth),  bottom = norm16((tY + height + o) / tHeight);
+
+    // 0---3
+    // |   |
+    // 1---2
+    glyph.vertices[0].s = left;  glyph.vertices[0].t = top;
+    glyph.vertices[1].s = left;  glyph.vertices[1].t = bottom;
+    glyph.vertices[2].s = right; glyph.vertices[2].t = bottom;
+    glyph.vertices[3].s = right; glyph.vertices[3].t = top;
+}
+
+/*
+** Glyphs only ever go into the last texture,
+** so this is at most one upload per frame
+*/
+void GlyphAtlas::Flush()
+{
+    if (this->pendingGlyphs.empty())
+        return;
+
+    this->textures.Upload(this->pages.back(), this->pendingPixels, this->pendingGlyphs);
+
+    this->pendingPixels.clear();
+    this->pendingGlyphs.clear();
+}
+
+uint32_t GlyphAtlas::GetCacheID() const
+{
+    return this->cacheID;
+}
+
+const std::vector<StrongReference<Rasterizer>> & GlyphAtlas::GetRasterizers() const
+{
+    return this->rasterizers;
+}
+
+size_t GlyphAtlas::GetGlyphCount() const
+{
+    return this->glyphs.size();
+}
+
+GlyphData * GlyphAtlas::RasterizeGlyph(const std::vector<StrongReference<Rasterizer>> & rasterizers,
+                                       bool useSpacesAsTab, uint32_t glyph)
+{
+    /* Use spaces for the tab 'glyph' */
+    if (glyph == 9 && useSpacesAsTab)
+    {
+        GlyphData * spacegd = rasterizers[0]->GetGlyphData(32);
+
+        GlyphData::GlyphMetrics gm = {};
+
+        gm.advance  = spacegd->GetAdvance() * SPACES_PER_TAB;
+        gm.bearingX = spacegd->GetBearingX();
+        gm.bearingY = spacegd->GetBearingY();
+
+        spacegd->Release();
+
+        return new GlyphData(glyph, gm);
+    }
+
+    for (const auto & r : rasterizers)
+    {
+        if (r->HasGlyph(glyph))
+            return r->GetGlyphData(glyph);
+    }
+
+    return rasterizers[0]->GetGlyphData(glyph);
+}
+
+const GlyphAtlas::Glyph & GlyphAtlas::FindGlyph(uint32_t glyph)
+{
+    if (glyph < DENSE_GLYPHS && this->denseGlyphs[glyph] != nullptr)
+        return *this->denseGlyphs[glyph];
+
+    auto it = this->glyphs.find(glyph);
+
+    /* It may be waiting in the loader, which beats rasterizing it again */
+    if (it == this->glyphs.end() && this->PublishPreloaded())
+        it = this->glyphs.find(glyph);
+
+    if (it == this->glyphs.end() && this->autoPreload && this->failed.count(glyph) == 0)
+    {
+        if (this->deferred.insert(glyph).second)
+            this->Preload({ glyph });
+
+        this->placeholder.spacing = this->GetGlyphSpacing(glyph);
+
+        return this->placeholder;
+    }
+
+    const Glyph & found = (it != this->glyphs.end()) ? it->second : this->AddGlyph(glyph);
+
+    if (glyph < DENSE_GLYPHS)
+        this->denseGlyphs[glyph] = &found;
+
+    return found;
+}
+
+const GlyphAtlas::Glyph & GlyphAtlas::AddGlyph(uint32_t glyph)
+{
+    StrongReference<GlyphData> gd(GlyphAtlas::RasterizeGlyph(this->rasterizers, this->useSpacesAsTab, glyph),
+                                  Acquire::NORETAIN);
+
+    return this->AddGlyph(glyph, gd);
+}
+
+const GlyphAtlas::Glyph & GlyphAtlas::AddGlyph(uint32_t glyph, GlyphData * gd)
+{
+    int width  = gd->GetWidth();
+    int height = gd->GetHeight();
+
+    Glyph g;
+
+    g.texture = 0;
+    g.spacing = floorf(gd->GetAdvance() / this->dpiScale + 0.5f);
+    g.rect    = {};
+
+    std::fill_n(g.vertices, 4, GlyphVertex{});
+
+    /* Don't waste space on empty glyphs */
+    if (width > 0 && height > 0)
+    {
+        Rect rect;
+
+        if (this->pages.empty())
+            this->CreateTexture();
+
+        while (!this->packer.Pack(width + TEXTURE_PADDING, height + TEXTURE_PADDING, rect))
+        {
+            TextureSize nextSize = this->GetNextTextureSize();
+            bool canGrow = (nextSize.width > this->textureWidth || nextSize.height > this->textureHeight);
+
+            /* An empty texture that can't grow won't fit it either */
+            if (this->packer.GetOccupancy() == 0.0f && !canGrow)
+                throw love::Exception("Glyph %u is too large for the font texture.", glyph);
+
+            this->CreateTexture();
+        }
+
+        g.texture = this->pages.back();
+        g.rect    = {rect.x + TEXTURE_PADDING, rect.y + TEXTURE_PADDING, width, height};
+
+        /* Copy sources need the same alignment as a whole staging buffer */
+        size_t offset = (this->pendingPixels.size() + this->uploadAlignment - 1) & ~(this->uploadAlignment - 1);
+        const uint8_t * pixels = (const uint8_t *)gd->GetData();
+
+        this->pendingPixels.resize(offset);
+        this->pendingPixels.insert(this->pendingPixels.end(), pixels, pixels + gd->GetSize());
+
+        this->pendingGlyphs.push_back({ g.rect, offset });
+
+        Colorf c(1.0f, 1.0f, 1.0f, 1.0f);
+
+        /* See SetTexCoords for the extrusion */
+        int o = 1;
+
+        // 0---3
+        // |   |
+        // 1---2
+        const GlyphVertex verts[4] =
+        {
+            { float(-o),                    float(-o),                     0, 0, c },
+            { float(-o),                    (height + o) / this->dpiScale, 0, 0, c },
+            { (width + o) / this->dpiScale, (height + o) / this->dpiScale, 0, 0, c },
+            { (width + o) / this->dpiScale, float(-o),                     0, 0, c },
+        };
+
+        // Copy vertex data to the glyph
+        // and set proper bearing.
+        for (int i = 0; i < 4; i++)
+        {
+            g.vertices[i] = verts[i];
+
+            g.vertices[i].x += gd->GetBearingX() / this->dpiScale;
+            g.vertices[i].y -= gd->GetBearingY() / this->dpiScale;
+        }
+
+        this->SetTexCoords(g);
+    }
+
+    this->glyphs[glyph] = g;
+    return this->glyphs[glyph];
+}
+
+int GlyphAtlas::GetGlyphSpacing(uint32_t glyph)
+{
+    if (glyph < DENSE_GLYPHS)
+    {
+        if (this->denseGlyphs[glyph] != nullptr)
+            return this->denseGlyphs[glyph]->spacing;
+
+        int & advance = this->denseAdvances[glyph];
+
+        if (advance == NO_ADVANCE)
+            advance = this->FindAdvance(glyph);
+
+        return advance;
+    }
+
+    const auto glyphIterator = this->glyphs.find(glyph);
+
+    if (glyphIterator != this->glyphs.end())
+        return glyphIterator->second.spacing;
+
+    const auto iterator = this->advances.find(glyph);
+
+    if (iterator != this->advances.end())
+        return iterator->second;
+
+    int advance = this->FindAdvance(glyph);
+    this->advances[glyph] = advance;
+
+    return advance;
+}
+
+/* Same rasterizer choice and rounding as AddGlyph, so the two always agree */
+int GlyphAtlas::FindAdvance(uint32_t glyph) const
+{
+    int advance = 0;
+
+    if (glyph == 9 && this->useSpacesAsTab)
+        advance = this->rasterizers[0]->GetGlyphAdvance(32) * SPACES_PER_TAB;
+    else
+    {
+        const Rasterizer * found = this->rasterizers[0];
+
+        for (const auto & rasterizer : this->rasterizers)
+        {
+            if (rasterizer->HasGlyph(glyph))
+            {
+                found = rasterizer;
+                break;
+            }
+        }
+
+        advance = found->GetGlyphAdvance(glyph);
+    }
+
+    return floorf(advance / this->dpiScale + 0.5f);
+}
+
+/* GLYPH LOADER */
+
+GlyphAtlas::GlyphLoader::GlyphLoader(const std::vector<StrongReference<Rasterizer>> & rasterizers,
+                                     bool useSpacesAsTab) : useSpacesAsTab(useSpacesAsTab),
+                                                            finish(false),
+                                                            ready(false)
+{
+    for (const auto & rasterizer : rasterizers)
+        this->rasterizers.emplace_back(rasterizer->Clone(), Acquire::NORETAIN);
+
+    this->threadName = "GlyphLoader";
+
+    /* FreeType needs more than the default */
+    this->stackSize = 0x10000;
+}
+
+GlyphAtlas::GlyphLoader::~GlyphLoader()
+{}
+
+void GlyphAtlas::GlyphLoader::Queue(const std::vector<uint32_t> & codepoints)
+{
+    thread::Lock lock(this->mutex);
+
+    this->requests.insert(this->requests.end(), codepoints.begin(), codepoints.end());
+    this->condition->Broadcast();
+}
+
+bool GlyphAtlas::GlyphLoader::Collect(std::vector<StrongReference<GlyphData>> & out, std::vector<uint32_t> & failed)
+{
+    if (!this->ready)
+        return false;
+
+    thread::Lock lock(this->mutex);
+
+    for (auto & result : this->results)
+        out.push_back(std::move(result));
+
+    failed.insert(failed.end(), this->failures.begin(), this->failures.end());
+
+    this->results.clear();
+    this->failures.clear();
+    this->ready = false;
+
+    return true;
+}
+
+void GlyphAtlas::GlyphLoader::SetFinish()
+{
+    thread::Lock lock(this->mutex);
+
+    this->finish = true;
+    this->condition->Broadcast();
+}
+
+void GlyphAtlas::GlyphLoader::ThreadFunction()
+{
+    while (true)
+    {
+        uint32_t glyph = 0;
+
+        {
+            thread::Lock lock(this->mutex);
+
+            while (this->requests.empty() && !this->finish)
+                this->condition->Wait(this->mutex);
+
+            if (this->finish)
+                return;
+
+            glyph = this->requests.front();
+            this->requests.pop_front();
+        }
+
+        GlyphData * data = nullptr;
+
+        /* Failures are left for FindGlyph to report on the main thread */
+        try
+        {
+            data = GlyphAtlas::RasterizeGlyph(this->rasterizers, this->useSpacesAsTab, glyph);
+        }
+        catch (love::Exception &)
+        {
+            thread::Lock lock(this->mutex);
+
+            this->failures.push_back(glyph);
+            this->ready = true;
+
+            continue;
+        }
+
+        thread::Lock lock(this->mutex);
+
+        this->results.emplace_back(data, Acquire::NORETAIN);
+        this->ready = true;
+    }
+}
+
+/* GLYPH LOADER */
+
+void GlyphAtlas::Preload(const std::vector<uint32_t> & codepoints)
+{
+    std::vector<uint32_t> missing;
+
+    for (uint32_t codepoint : codepoints)
+    {
+        if (this->glyphs.find(codepoint) == this->glyphs.end())
+            missing.push_back(codepoint);
+    }
+
+    if (missing.empty())
+        return;
+
+    if (this->loader == nullptr)
+    {
+        this->loader = new GlyphLoader(this->rasterizers, this->useSpacesAsTab);
+        this->loader->Start();
+    }
+
+    this->loader->Queue(missing);
+}
+
+/*
+** Runs on the main thread, where the atlas lives
+** Glyphs that got drawn before the loader finished them are dropped
+*/
+bool GlyphAtlas::PublishPreloaded()
+{
+    std::vector<StrongReference<GlyphData>> finished;
+    std::vector<uint32_t> failures;
+
+    if (this->loader == nullptr || !this->loader->Collect(finished, failures))
+        return false;
+
+    bool arrived = false;
+
+    for (uint32_t glyph : failures)
+    {
+        this->failed.insert(glyph);
+        arrived |= (this->deferred.erase(glyph) > 0);
+    }
+
+    for (const auto & data : finished)
+    {
+        uint32_t glyph = data->GetGlyph();
+
+        if (this->glyphs.find(glyph) == this->glyphs.end())
+            this->AddGlyph(glyph, data);
+
+        arrived |= (this->deferred.erase(glyph) > 0);
+    }
+
+    /* Text laid out without them has to be done again */
+    if (arrived)
+        this->cacheID++;
+
+    return true;
+}
+
+void GlyphAtlas::SetAutoPreload(bool enable)
+{
+    this->autoPreload = enable;
+}
+
+bool GlyphAtlas::GetAutoPreload() const
+{
+    return this->autoPreload;
+}
@@ -48,6 +48,16 @@ void Image::ReplacePixels(const void * data, size_t size, const Rect & rect)
                                 data, size, ::deko3d::Instance().GetTextureQueue(), rect);
 }
 
+void Image::ReplacePixels(const void * data, size_t size, const std::vector<CImage::Region> & regions)
+{
+    ::deko3d::Instance().UploadRegions(this->texture.get(), data, size, regions.data(), regions.size());
+}
+
+void Image::CopyPixels(Image * source, int width, int height)
+{
+    ::deko3d::Instance().CopyImage(source->texture.get(), this->texture.get(), width, height);
+}
+
 void Image::Init(int width, int height)
 {
     this->width = width;
@@ -0,0 +1,187 @@
+#include "objects/mesh/mesh.h"
+#include "modules/graphics/graphics.h"
+
+#include "deko3d/deko.h"
+
+using namespace love;
+
+love::Type Mesh::type("Mesh", &Drawable::type);
+
+Mesh::Mesh(const std::vector<AttribFormat> & format, const std::vector<float> & data,
+           size_t vertexCount, DrawMode mode, Usage usage) : Mesh(format, vertexCount, mode, usage)
+{
+    this->SetVertices(data, 0);
+}
+
+Mesh::Mesh(const std::vector<AttribFormat> & format, size_t vertexCount, DrawMode mode, Usage usage) : MeshGeometry(format, vertexCount, mode, usage),
+                                                                                                        indexFormat(DkIdxFormat_Uint16)
+{}
+
+Mesh::~Mesh()
+{
+    ::deko3d::Instance().ReleaseDeferred(this->vertexBuffer.memory);
+    ::deko3d::Instance().ReleaseDeferred(this->indexBuffer.memory);
+}
+
+void Mesh::SetTexture(Texture * texture)
+{
+    this->texture.Set(texture);
+}
+
+void Mesh::SetTexture()
+{
+    this->texture.Set(nullptr);
+}
+
+Texture * Mesh::GetTexture() const
+{
+    return this->texture.Get();
+}
+
+bool Mesh::IsBusy(const GpuBuffer & buffer)
+{
+    return buffer.used && !::deko3d::Instance().IsFrameComplete(buffer.lastUse);
+}
+
+void * Mesh::MapBuffer(GpuBuffer & buffer, uint32_t size, bool orphan)
+{
+    if (!buffer.memory || buffer.memory.getSize() < size || orphan)
+    {
+        ::deko3d::Instance().ReleaseDeferred(buffer.memory);
+
+        buffer.memory = ::deko3d::Instance().GetData().allocate(size, alignof(vertex::Vertex));
+        buffer.used = false;
+
+        if (!buffer.memory)
+            throw love::Exception("Failed to allocate Mesh memory.");
+    }
+
+    return buffer.memory.getCpuAddr();
+}
+
+/* See MeshGeometry::Upload for when the buffer is replaced */
+void Mesh::FlushVertices()
+{
+    size_t capacity = (this->vertexBuffer.memory) ? this->vertexBuffer.memory.getSize() / sizeof(vertex::Vertex) : 0;
+    Upload upload = this->TakeVertexUpload(capacity, Mesh::IsBusy(this->vertexBuffer));
+
+    if (upload.count == 0)
+        return;
+
+    uint32_t size = this->vertices.size() * sizeof(vertex::Vertex);
+    vertex::Vertex * out = (vertex::Vertex *)this->MapBuffer(this->vertexBuffer, size, upload.orphan);
+
+    memcpy(out + upload.start, this->vertices.data() + upload.start, upload.count * sizeof(vertex::Vertex));
+}
+
+/* The whole map is written each time, so a busy buffer is always replaced */
+void Mesh::FlushVertexMap()
+{
+    if (!this->TakeVertexMapUpload())
+        return;
+
+    bool orphan = Mesh::IsBusy(this->indexBuffer);
+
+    if (this->vertices.size() <= 0x10000)
+    {
+        uint32_t size = this->vertexMap.size() * sizeof(uint16_t);
+        uint16_t * out = (uint16_t *)this->MapBuffer(this->indexBuffer, size, orphan);
+
+        std::copy(this->vertexMap.begin(), this->vertexMap.end(), out);
+        this->indexFormat = DkIdxFormat_Uint16;
+    }
+    else
+    {
+        uint32_t size = this->vertexMap.size() * sizeof(uint32_t);
+        uint32_t * out = (uint32_t *)this->MapBuffer(this->indexBuffer, size, orphan);
+
+        std::copy(this->vertexMap.begin(), this->vertexMap.end(), out);
+        this->indexFormat = DkIdxFormat_Uint32;
+    }
+}
+
+DkPrimitive Mesh::GetPrimitive(DrawMode mode)
+{
+    switch (mode)
+    {
+        case DRAWMODE_FAN:
+            return DkPrimitive_TriangleFan;
+        case DRAWMODE_STRIP:
+            return DkPrimitive_TriangleStrip;
+        case DRAWMODE_POINTS:
+            return DkPrimitive_Points;
+        case DRAWMODE_TRIANGLES:
+        default:
+            return DkPrimitive_Triangles;
+    }
+}
+
+/*
+** The standard shaders have no color uniform, so a non-white
+** current color means the vertices have to be tinted on the way.
+** That copy goes through the vertex ring like a stream mesh does.
+*/
+void Mesh::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    bool indexed = this->IsIndexed();
+
+    int start = 0, count = 0;
+    this->GetDrawSpan(start, count);
+
+    if (count <= 0)
+        return;
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+
+    Colorf color = gfx->GetColor();
+    bool tinted = (color != Colorf(1.0f, 1.0f, 1.0f, 1.0f));
+
+    uint32_t size = this->vertices.size() * sizeof(vertex::Vertex);
+    DkGpuAddr vertexAddr = DK_GPU_ADDR_INVALID;
+
+    if (this->usage == USAGE_STREAM || tinted)
+    {
+        vertex::Vertex * out = ::deko3d::Instance().ReserveVertices(this->vertices.size(), vertexAddr);
+
+        if (out == nullptr)
+            return;
+
+        if (!tinted)
+            memcpy(out, this->vertices.data(), size);
+        else
+        {
+            /* Ring memory is uncached, so tint a local copy and write it once */
+            for (size_t index = 0; index < this->vertices.size(); index++)
+            {
+                vertex::Vertex point = this->vertices[index];
+                vertex::Tint(point, color);
+
+                out[index] = point;
+            }
+        }
+    }
+    else
+    {
+        this->FlushVertices();
+
+        vertexAddr = this->vertexBuffer.memory.getGpuAddr();
+
+        this->vertexBuffer.lastUse = ::deko3d::Instance().GetFrameIndex();
+        this->vertexBuffer.used = true;
+    }
+
+    DkGpuAddr indexAddr = DK_GPU_ADDR_INVALID;
+
+    if (indexed)
+    {
+        this->FlushVertexMap();
+
+        indexAddr = this->indexBuffer.memory.getGpuAddr();
+
+        this->indexBuffer.lastUse = ::deko3d::Instance().GetFrameIndex();
+        this->indexBuffer.used = true;
+    }
+
+    ::deko3d::Instance().RenderMesh(this->texture.Get(), Mesh::GetPrimitive(this->mode), t,
+                                    vertexAddr, size, start, count, indexAddr, this->indexFormat);
+}
@@ -0,0 +1,408 @@
+#include "objects/mesh/meshgeometry.h"
+
+#include "common/exception.h"
+
+#include <algorithm>
+
+using namespace love;
+
+MeshGeometry::MeshGeometry(const std::vector<AttribFormat> & format, size_t vertexCount, DrawMode mode, Usage usage) : useVertexMap(false),
+                                                                                                                       modifiedStart(0),
+                                                                                                                       modifiedEnd(vertexCount),
+                                                                                                                       vertexMapModified(false),
+                                                                                                                       mode(mode),
+                                                                                                                       usage(usage),
+                                                                                                                       rangeStart(-1),
+                                                                                                                       rangeCount(-1)
+{
+    if (vertexCount == 0)
+        throw love::Exception("A Mesh must have at least one vertex.");
+
+    this->SetupFormat(format);
+
+    vertex::Vertex empty =
+    {
+        .position = {0.0f, 0.0f},
+        .color    = {0xFF, 0xFF, 0xFF, 0xFF},
+        .texcoord = {0, 0}
+    };
+
+    this->vertices.resize(vertexCount, empty);
+}
+
+std::vector<MeshGeometry::AttribFormat> MeshGeometry::GetDefaultVertexFormat()
+{
+    return
+    {
+        { "VertexPosition", DATA_FLOAT, 2 },
+        { "VertexTexCoord", DATA_FLOAT, 2 },
+        { "VertexColor",    DATA_BYTE,  4 }
+    };
+}
+
+void MeshGeometry::SetupFormat(const std::vector<AttribFormat> & format)
+{
+    static constexpr int minComponents[ATTRIBUTE_MAX_ENUM] = { 2, 2, 3 };
+    static constexpr int maxComponents[ATTRIBUTE_MAX_ENUM] = { 2, 2, 4 };
+
+    bool used[ATTRIBUTE_MAX_ENUM] = { false };
+
+    for (const AttribFormat & attribute : format)
+    {
+        Attribute which = ATTRIBUTE_MAX_ENUM;
+
+        if (!MeshGeometry::GetConstant(attribute.name.c_str(), which))
+            throw love::Exception("Unsupported vertex attribute '%s'.", attribute.name.c_str());
+
+        if (used[which])
+            throw love::Exception("Duplicate vertex attribute '%s'.", attribute.name.c_str());
+
+        if (attribute.components < minComponents[which] || attribute.components > maxComponents[which])
+            throw love::Exception("Invalid component count for vertex attribute '%s'.", attribute.name.c_str());
+
+        used[which] = true;
+        this->attributes.push_back(which);
+    }
+
+    if (!used[ATTRIBUTE_POSITION])
+        throw love::Exception("Vertex format must include VertexPosition.");
+
+    this->format = format;
+}
+
+size_t MeshGeometry::GetVertexStride() const
+{
+    size_t stride = 0;
+
+    for (const AttribFormat & attribute : this->format)
+        stride += attribute.components;
+
+    return stride;
+}
+
+static inline uint16_t normto16t(float in)
+{
+    return uint16_t(std::clamp(in, 0.0f, 1.0f) * 0xFFFF);
+}
+
+/*
+** Texture coordinates are stored as 16-bit unorm,
+** so anything outside of [0, 1] is clamped
+*/
+void MeshGeometry::SetVertices(const std::vector<float> & data, size_t start)
+{
+    size_t stride = this->GetVertexStride();
+    size_t count  = data.size() / stride;
+
+    if (start >= this->vertices.size() || count > this->vertices.size() - start)
+        throw love::Exception("Too many vertices (expected at most %zu).", this->vertices.size() - std::min(start, this->vertices.size()));
+
+    const float * in = data.data();
+
+    for (size_t index = start; index < start + count; index++)
+    {
+        vertex::Vertex & point = this->vertices[index];
+
+        for (size_t attribute = 0; attribute < this->format.size(); attribute++)
+        {
+            int components = this->format[attribute].components;
+
+            switch (this->attributes[attribute])
+            {
+                case ATTRIBUTE_POSITION:
+                    std::copy(in, in + components, point.position);
+                    break;
+                case ATTRIBUTE_TEXCOORD:
+                    point.texcoord[0] = normto16t(in[0]);
+                    point.texcoord[1] = normto16t(in[1]);
+                    break;
+                case ATTRIBUTE_COLOR:
+                    vertex::PackColor(Colorf(in[0], in[1], in[2], (components == 4) ? in[3] : 1.0f), point.color);
+                    break;
+                default:
+                    break;
+            }
+
+            in += components;
+        }
+    }
+
+    this->MarkModified(start, count);
+}
+
+void MeshGeometry::SetVertex(size_t index, const std::vector<float> & data)
+{
+    if (index >= this->vertices.size())
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    this->SetVertices(data, index);
+}
+
+std::vector<float> MeshGeometry::GetVertex(size_t index) const
+{
+    if (index >= this->vertices.size())
+        throw love::Exception("Invalid vertex index: %zu", index + 1);
+
+    const vertex::Vertex & point = this->vertices[index];
+    std::vector<float> data;
+
+    for (size_t attribute = 0; attribute < this->format.size(); attribute++)
+    {
+        int components = this->format[attribute].components;
+
+        switch (this->attributes[attribute])
+        {
+            case ATTRIBUTE_POSITION:
+                data.insert(data.end(), point.position, point.position + components);
+                break;
+            case ATTRIBUTE_TEXCOORD:
+                data.push_back(point.texcoord[0] / (float)0xFFFF);
+                data.push_back(point.texcoord[1] / (float)0xFFFF);
+                break;
+            case ATTRIBUTE_COLOR:
+            {
+                Colorf color = vertex::UnpackColor(point.color);
+                const float values[4] = { color.r, color.g, color.b, color.a };
+
+                data.insert(data.end(), values, values + components);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    return data;
+}
+
+size_t MeshGeometry::GetVertexCount() const
+{
+    return this->vertices.size();
+}
+
+const std::vector<MeshGeometry::AttribFormat> & MeshGeometry::GetVertexFormat() const
+{
+    return this->format;
+}
+
+void MeshGeometry::MarkModified(size_t start, size_t count)
+{
+    this->modifiedStart = std::min(this->modifiedStart, start);
+    this->modifiedEnd   = std::max(this->modifiedEnd, start + count);
+}
+
+void MeshGeometry::SetVertexMap(const std::vector<uint32_t> & map)
+{
+    for (uint32_t index : map)
+    {
+        if (index >= this->vertices.size())
+            throw love::Exception("Invalid vertex map value: %u", index + 1);
+    }
+
+    this->vertexMap = map;
+    this->useVertexMap = true;
+    this->vertexMapModified = true;
+}
+
+void MeshGeometry::SetVertexMap()
+{
+    this->useVertexMap = false;
+}
+
+bool MeshGeometry::GetVertexMap(std::vector<uint32_t> & map) const
+{
+    if (!this->useVertexMap)
+        return false;
+
+    map = this->vertexMap;
+
+    return true;
+}
+
+void MeshGeometry::SetDrawMode(DrawMode mode)
+{
+    this->mode = mode;
+}
+
+MeshGeometry::DrawMode MeshGeometry::GetDrawMode() const
+{
+    return this->mode;
+}
+
+void MeshGeometry::SetDrawRange(int start, int count)
+{
+    if (start < 0 || count <= 0)
+        throw love::Exception("Invalid draw range.");
+
+    this->rangeStart = start;
+    this->rangeCount = count;
+}
+
+void MeshGeometry::SetDrawRange()
+{
+    this->rangeStart = this->rangeCount = -1;
+}
+
+bool MeshGeometry::GetDrawRange(int & start, int & count) const
+{
+    if (this->rangeStart < 0 || this->rangeCount <= 0)
+        return false;
+
+    start = this->rangeStart;
+    count = this->rangeCount;
+
+    return true;
+}
+
+bool MeshGeometry::IsIndexed() const
+{
+    return this->useVertexMap && !this->vertexMap.empty();
+}
+
+MeshGeometry::Usage MeshGeometry::GetUsage() const
+{
+    return this->usage;
+}
+
+void MeshGeometry::GetDrawSpan(int & start, int & count) const
+{
+    int total = (this->IsIndexed()) ? this->vertexMap.size() : this->vertices.size();
+
+    start = 0;
+    count = total;
+
+    if (this->rangeStart >= 0 && this->rangeCount > 0)
+    {
+        start = std::min(this->rangeStart, total);
+        count = std::min(this->rangeCount, total - start);
+    }
+}
+
+MeshGeometry::Upload MeshGeometry::TakeVertexUpload(size_t capacity, bool busy)
+{
+    Upload upload = { false, 0, 0 };
+
+    if (this->modifiedStart >= this->modifiedEnd)
+        return upload;
+
+    upload.orphan = busy || capacity < this->vertices.size();
+
+    if (upload.orphan)
+        upload.count = this->vertices.size();
+    else
+    {
+        upload.start = this->modifiedStart;
+        upload.count = this->modifiedEnd - this->modifiedStart;
+    }
+
+    this->modifiedStart = this->vertices.size();
+    this->modifiedEnd   = 0;
+
+    return upload;
+}
+
+bool MeshGeometry::TakeVertexMapUpload()
+{
+    if (!this->vertexMapModified || this->vertexMap.empty())
+        return false;
+
+    this->vertexMapModified = false;
+
+    return true;
+}
+
+bool MeshGeometry::GetConstant(const char * in, DrawMode & out)
+{
+    return drawModes.Find(in, out);
+}
+
+bool MeshGeometry::GetConstant(DrawMode in, const char *& out)
+{
+    return drawModes.Find(in, out);
+}
+
+std::vector<std::string> MeshGeometry::GetConstants(DrawMode)
+{
+    return drawModes.GetNames();
+}
+
+bool MeshGeometry::GetConstant(const char * in, Usage & out)
+{
+    return usages.Find(in, out);
+}
+
+bool MeshGeometry::GetConstant(Usage in, const char *& out)
+{
+    return usages.Find(in, out);
+}
+
+std::vector<std::string> MeshGeometry::GetConstants(Usage)
+{
+    return usages.GetNames();
+}
+
+bool MeshGeometry::GetConstant(const char * in, DataType & out)
+{
+    return dataTypes.Find(in, out);
+}
+
+bool MeshGeometry::GetConstant(DataType in, const char *& out)
+{
+    return dataTypes.Find(in, out);
+}
+
+std::vector<std::string> MeshGeometry::GetConstants(DataType)
+{
+    return dataTypes.GetNames();
+}
+
+bool MeshGeometry::GetConstant(const char * in, Attribute & out)
+{
+    return attributeNames.Find(in, out);
+}
+
+bool MeshGeometry::GetConstant(Attribute in, const char *& out)
+{
+    return attributeNames.Find(in, out);
+}
+
+std::vector<std::string> MeshGeometry::GetConstants(Attribute)
+{
+    return attributeNames.GetNames();
+}
+
+StringMap<MeshGeometry::DrawMode, MeshGeometry::DRAWMODE_MAX_ENUM>::Entry MeshGeometry::drawModeEntries[] =
+{
+    { "fan",       DRAWMODE_FAN       },
+    { "strip",     DRAWMODE_STRIP     },
+    { "triangles", DRAWMODE_TRIANGLES },
+    { "points",    DRAWMODE_POINTS    }
+};
+
+StringMap<MeshGeometry::DrawMode, MeshGeometry::DRAWMODE_MAX_ENUM> MeshGeometry::drawModes(MeshGeometry::drawModeEntries, sizeof(MeshGeometry::drawModeEntries));
+
+StringMap<MeshGeometry::Usage, MeshGeometry::USAGE_MAX_ENUM>::Entry MeshGeometry::usageEntries[] =
+{
+    { "stream",  USAGE_STREAM  },
+    { "dynamic", USAGE_DYNAMIC },
+    { "static",  USAGE_STATIC  }
+};
+
+StringMap<MeshGeometry::Usage, MeshGeometry::USAGE_MAX_ENUM> MeshGeometry::usages(MeshGeometry::usageEntries, sizeof(MeshGeometry::usageEntries));
+
+StringMap<MeshGeometry::DataType, MeshGeometry::DATA_MAX_ENUM>::Entry MeshGeometry::dataTypeEntries[] =
+{
+    { "float", DATA_FLOAT },
+    { "byte",  DATA_BYTE  }
+};
+
+StringMap<MeshGeometry::DataType, MeshGeometry::DATA_MAX_ENUM> MeshGeometry::dataTypes(MeshGeometry::dataTypeEntries, sizeof(MeshGeometry::dataTypeEntries));
+
+StringMap<MeshGeometry::Attribute, MeshGeometry::ATTRIBUTE_MAX_ENUM>::Entry MeshGeometry::attributeEntries[] =
+{
+    { "VertexPosition", ATTRIBUTE_POSITION },
+    { "VertexTexCoord", ATTRIBUTE_TEXCOORD },
+    { "VertexColor",    ATTRIBUTE_COLOR    }
+};
+
+StringMap<MeshGeometry::Attribute, MeshGeometry::ATTRIBUTE_MAX_ENUM> MeshGeometry::attributeNames(MeshGeometry::attributeEntries, sizeof(MeshGeometry::attributeEntries));
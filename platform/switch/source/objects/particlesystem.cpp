@@ -0,0 +1,39 @@
+#include "objects/particlesystem/particlesystem.h"
+#include "modules/graphics/graphics.h"
+
+#include "deko3d/deko.h"
+
+using namespace love;
+
+ParticleSystem::ParticleSystem(love::Texture * texture, uint32_t size) : common::ParticleSystem(texture, size)
+{}
+
+ParticleSystem::~ParticleSystem()
+{}
+
+/*
+** Quads are generated straight into the vertex ring,
+** the draw transform is applied on the GPU
+*/
+void ParticleSystem::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    if (this->count == 0)
+        return;
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+
+    uint32_t vertexCount = this->count * VERTICES_PER_PARTICLE;
+    DkGpuAddr vertexAddr = DK_GPU_ADDR_INVALID;
+
+    vertex::Vertex * out = ::deko3d::Instance().ReserveVertices(vertexCount, vertexAddr);
+
+    if (out == nullptr)
+        return;
+
+    Quad * quad = this->texture->GetQuad();
+
+    this->GenerateVertices(out, quad->GetVertexPositions(), quad->GetVertexTexCoords(), gfx->GetColor());
+
+    ::deko3d::Instance().RenderMesh(this->texture.Get(), DkPrimitive_Quads, t, vertexAddr,
+                                    vertexCount * sizeof(vertex::Vertex), 0, vertexCount);
+}
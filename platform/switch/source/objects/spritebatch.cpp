@@ -0,0 +1,59 @@
+#include "objects/spritebatch/spritebatch.h"
+#include "modules/graphics/graphics.h"
+
+#include "deko3d/deko.h"
+
+using namespace love;
+
+SpriteBatch::SpriteBatch(love::Texture * texture, int size) : common::SpriteBatch(texture, size)
+{
+    this->Resize(size);
+}
+
+SpriteBatch::~SpriteBatch()
+{}
+
+void SpriteBatch::Resize(int size)
+{
+    this->vertices.resize(size * VERTICES_PER_SPRITE);
+}
+
+void SpriteBatch::SetSprite(int index, love::Quad * quad, const Matrix4 & m, const Colorf & color)
+{
+    Vector2 transformed[VERTICES_PER_SPRITE];
+    m.TransformXY(transformed, quad->GetVertexPositions(), VERTICES_PER_SPRITE);
+
+    vertex::GenerateTextureFromVectors(this->vertices.data() + index * VERTICES_PER_SPRITE, transformed,
+                                       quad->GetVertexTexCoords(), VERTICES_PER_SPRITE, color);
+
+    this->tinted.Invalidate(index * VERTICES_PER_SPRITE, VERTICES_PER_SPRITE);
+}
+
+/*
+** The sprite vertices never change here, the draw
+** transform is handed to the GPU alongside them
+** The shaders can't tint, so a non-white color draws from
+** a tinted copy that's only redone where something changed
+*/
+void SpriteBatch::Draw(Graphics * gfx, const Matrix4 & localTransform)
+{
+    int start = 0, count = 0;
+
+    if (!this->GetDrawSprites(start, count))
+        return;
+
+    Matrix4 t(gfx->GetTransform(), localTransform);
+
+    const vertex::Vertex * points = this->vertices.data() + start * VERTICES_PER_SPRITE;
+    size_t vertexCount = count * VERTICES_PER_SPRITE;
+
+    Colorf color = gfx->GetColor();
+
+    if (color != Colorf(1.0f, 1.0f, 1.0f, 1.0f))
+    {
+        size_t first = start * VERTICES_PER_SPRITE;
+        points = this->tinted.Get(this->vertices, first + vertexCount, color) + first;
+    }
+
+    ::deko3d::Instance().RenderTexture(this->texture->GetHandle(), points, vertexCount, t);
+}
@@ -6,14 +6,15 @@
 using namespace love;
 
 Text::Text(Font * font, const std::vector<Font::ColoredString> & text) : common::Text(font, text),
-                                                                         vertexOffset(0),
                                                                          textureCacheId(-1)
 {
     this->Set(text);
 }
 
 Text::~Text()
-{}
+{
+    ::deko3d::Instance().ReleaseDeferred(this->vertexBuffer.memory);
+}
 
 void Text::RegenerateVertices()
 {
@@ -29,28 +30,43 @@ void Text::RegenerateVertices()
     }
 }
 
-void Text::CopyVertices(const std::vector<vertex::GlyphVertex> & vertices, size_t vertoffset)
+/* See TextVertices::TakeUpload for when the memory is replaced */
+void Text::FlushVertices()
 {
-    size_t offset = vertoffset * sizeof(vertex::GlyphVertex);
-    size_t dataSize = vertices.size() * sizeof(vertex::GlyphVertex);
+    GpuBuffer & buffer = this->vertexBuffer;
+
+    size_t capacity = (buffer.memory) ? buffer.memory.getSize() / sizeof(vertex::Vertex) : 0;
+    bool busy = buffer.used && !::deko3d::Instance().IsFrameComplete(buffer.lastUse);
+
+    TextVertices::Upload upload = this->vertices.TakeUpload(capacity, busy);
+
+    if (upload.count == 0)
+        return;
 
-    if (dataSize > 0 && (this->vertexBuffer.empty() || (offset + dataSize) > this->vertexBuffer.size()))
+    const std::vector<vertex::Vertex> & vertices = this->vertices.GetVertices();
+
+    if (upload.orphan)
     {
-        size_t newSize = size_t((offset + dataSize) * 1.5);
+        ::deko3d::Instance().ReleaseDeferred(buffer.memory);
+
+        /* Room to grow, so appending a line doesn't reallocate every time */
+        uint32_t size = vertices.size() * sizeof(vertex::Vertex);
 
-        if (!this->vertexBuffer.empty())
-            newSize = std::max(size_t(this->vertexBuffer.size() * 1.5), newSize);
+        buffer.memory = ::deko3d::Instance().GetData().allocate(size + size / 2, alignof(vertex::Vertex));
+        buffer.used = false;
 
-        this->vertexBuffer.resize(newSize);
+        if (!buffer.memory)
+            throw love::Exception("Failed to allocate Text memory.");
     }
 
-    if (!this->vertexBuffer.empty() || dataSize > 0)
-        memcpy(this->vertexBuffer.data() + vertoffset, &vertices[0], dataSize);
+    vertex::Vertex * out = (vertex::Vertex *)buffer.memory.getCpuAddr();
+
+    memcpy(out + upload.start, vertices.data() + upload.start, upload.count * sizeof(vertex::Vertex));
 }
 
 void Text::AddTextData(const Text::TextData & text)
 {
-    std::vector<vertex::GlyphVertex> vertices;
+    std::vector<vertex::GlyphVertex> glyphVertices;
     std::vector<Font::DrawCommand> commands;
 
     Font::TextInfo info;
@@ -58,50 +74,17 @@ void Text::AddTextData(const Text::TextData & text)
     Colorf constantColor = Colorf(1.0f, 1.0f, 1.0f, 1.0f);
 
     if (text.align == Font::ALIGN_MAX_ENUM)
-        commands = this->font->GenerateVertices(text.codepoints, constantColor, vertices, 0.0f, Vector2(0.0f, 0.0f), &info);
+        commands = this->font->GenerateVertices(text.codepoints, constantColor, glyphVertices, 0.0f, Vector2(0.0f, 0.0f), &info);
     else
-        commands = this->font->GenerateVerticesFormatted(text.codepoints, constantColor, text.wrap, text.align, vertices, &info);
-
-    size_t offset = this->vertexOffset;
+        commands = this->font->GenerateVerticesFormatted(text.codepoints, constantColor, text.wrap, text.align, glyphVertices, &info);
 
     if (!text.appendVertices)
     {
-        offset = 0;
-        this->vertexOffset = 0;
-        this->drawCommands.clear();
+        this->vertices.Clear();
         this->textData.clear();
     }
 
-    if (vertices.empty())
-        return;
-
-    if (text.useMatrix)
-        text.matrix.TransformXY(&vertices[0], &vertices[0], vertices.size());
-
-    this->CopyVertices(vertices, offset);
-
-    if (!commands.empty())
-    {
-        for (Font::DrawCommand & command : commands)
-            command.startVertex += offset;
-
-        auto firstCmd = commands.begin();
-
-        if (!this->drawCommands.empty())
-        {
-            auto lastCmd = this->drawCommands.back();
-
-            if (lastCmd.texture == firstCmd->texture && (lastCmd.startVertex + lastCmd.vertexCount) == firstCmd->startVertex)
-            {
-                this->drawCommands.back().vertexCount += firstCmd->vertexCount;
-                ++firstCmd;
-            }
-        }
-
-        this->drawCommands.insert(this->drawCommands.end(), firstCmd, commands.end());
-    }
-
-    this->vertexOffset = offset + vertices.size();
+    this->vertices.Append(glyphVertices, std::move(commands), (text.useMatrix) ? &text.matrix : nullptr);
 
     this->textData.push_back(text);
     this->textData.back().textInfo = info;
@@ -144,9 +127,8 @@ int Text::Addf(const std::vector<Font::ColoredString> & text, float wrap, Font::
 void Text::Clear()
 {
     this->textData.clear();
-    this->drawCommands.clear();
+    this->vertices.Clear();
     this->textureCacheId = this->font->GetTextureCacheID();
-    this->vertexOffset = 0;
 }
 
 void Text::SetFont(Font * font)
@@ -178,29 +160,35 @@ int Text::GetHeight(int index) const
     return this->textData[index].textInfo.height;
 }
 
+/*
+** Glyph quads stay in GPU memory and the transform is applied there,
+** so this is one draw per font texture however the text was built
+*/
 void Text::Draw(Graphics * gfx, const Matrix4 & localTransform)
 {
-    if (this->drawCommands.empty() || this->vertexBuffer.empty())
+    if (this->vertices.GetDrawCommands().empty())
         return;
 
     if (this->font->GetTextureCacheID() != this->textureCacheId)
         this->RegenerateVertices();
 
-    int totalVertices = 0;
-    for (const Font::DrawCommand & command : this->drawCommands)
-        totalVertices = std::max(command.startVertex + command.vertexCount, totalVertices);
+    this->font->FlushGlyphs();
+    this->FlushVertices();
 
-    Graphics::TempTransform transform(gfx, localTransform);
+    Matrix4 t(gfx->GetTransform(), localTransform);
 
-    for (const Font::DrawCommand & command : this->drawCommands)
+    DkGpuAddr vertexAddr = this->vertexBuffer.memory.getGpuAddr();
+    uint32_t size = this->vertices.GetVertices().size() * sizeof(vertex::Vertex);
+
+    for (const Font::DrawCommand & command : this->vertices.GetDrawCommands())
     {
-        size_t vertexCount = command.vertexCount;
-        vertex::GlyphVertex vertexData[command.vertexCount];
+        ::deko3d::Instance().RenderMesh(command.texture, DkPrimitive_Quads, t, vertexAddr, size,
+                                        command.startVertex, command.vertexCount, DK_GPU_ADDR_INVALID,
+                                        DkIdxFormat_Uint16, this->font->IsDistanceField());
+    }
 
-        memcpy(vertexData, this->vertexBuffer.data(), sizeof(vertex::GlyphVertex) * vertexCount);
-        transform.TransformXY(vertexData, this->vertexBuffer.data(), vertexCount);
+    this->vertexBuffer.lastUse = ::deko3d::Instance().GetFrameIndex();
+    this->vertexBuffer.used = true;
 
-        std::vector<vertex::Vertex> verts = vertex::GenerateTextureFromGlyphs(vertexData, command.vertexCount);
-        ::deko3d::Instance().RenderTexture(command.texture->GetHandle(), verts.data(), vertexCount);
-    }
+    this->vertices.MarkDrawn();
 }
@@ -49,14 +49,15 @@ void Texture::Draw(Graphics * gfx, love::Quad * quad, const Matrix4 & localTrans
 
     Matrix4 t(tm, localTransform);
 
-    std::vector<vertex::Vertex> points(TEXTURE_QUAD_POINT_COUNT);
+    if (!is2D)
+        return;
 
-    if (is2D)
-    {
-        Vector2 transformed[4];
-        t.TransformXY(transformed, quad->GetVertexPositions(), 4);
-        points = vertex::GenerateTextureFromVectors(transformed, quad->GetVertexTexCoords(), points.size(), gfx->GetColor());
-    }
+    Vector2 transformed[TEXTURE_QUAD_POINT_COUNT];
+    t.TransformXY(transformed, quad->GetVertexPositions(), TEXTURE_QUAD_POINT_COUNT);
 
-    ::deko3d::Instance().RenderTexture(this->handle, points.data(), 4);
+    vertex::Vertex points[TEXTURE_QUAD_POINT_COUNT];
+    vertex::GenerateTextureFromVectors(points, transformed, quad->GetVertexTexCoords(),
+                                       TEXTURE_QUAD_POINT_COUNT, gfx->GetColor());
+
+    ::deko3d::Instance().RenderTexture(this->handle, points, TEXTURE_QUAD_POINT_COUNT);
 }
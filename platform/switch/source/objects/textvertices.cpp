@@ -0,0 +1,98 @@
+#include "objects/text/textvertices.h"
+
+using namespace love;
+
+TextVertices::TextVertices() : uploadedVertices(0),
+                               drawnVertices(0)
+{}
+
+void TextVertices::Append(std::vector<vertex::GlyphVertex> & glyphs, std::vector<DrawCommand> commands,
+                          const Matrix4 * transform)
+{
+    if (glyphs.empty())
+        return;
+
+    if (transform != nullptr)
+        transform->TransformXY(&glyphs[0], &glyphs[0], glyphs.size());
+
+    size_t offset = this->vertices.size();
+
+    this->vertices.resize(offset + glyphs.size());
+    vertex::GenerateTextureFromGlyphs(&this->vertices[offset], glyphs.data(), glyphs.size());
+
+    if (commands.empty())
+        return;
+
+    for (DrawCommand & command : commands)
+        command.startVertex += offset;
+
+    auto firstCmd = commands.begin();
+
+    if (!this->drawCommands.empty())
+    {
+        const DrawCommand & lastCmd = this->drawCommands.back();
+
+        if (lastCmd.texture == firstCmd->texture && (lastCmd.startVertex + lastCmd.vertexCount) == firstCmd->startVertex)
+        {
+            this->drawCommands.back().vertexCount += firstCmd->vertexCount;
+            ++firstCmd;
+        }
+    }
+
+    this->drawCommands.insert(this->drawCommands.end(), firstCmd, commands.end());
+}
+
+void TextVertices::Clear()
+{
+    this->vertices.clear();
+    this->drawCommands.clear();
+
+    this->uploadedVertices = 0;
+}
+
+/*
+** The GPU never reads past what was there at the last draw, so
+** appended vertices go in right after; starting over while a
+** frame may still be drawing the old ones takes fresh memory
+*/
+TextVertices::Upload TextVertices::TakeUpload(size_t capacity, bool busy)
+{
+    Upload upload = { false, 0, 0 };
+
+    size_t count = this->vertices.size();
+
+    if (this->uploadedVertices >= count)
+        return upload;
+
+    bool overwrite = this->uploadedVertices < this->drawnVertices;
+
+    upload.orphan = (capacity < count) || (busy && overwrite);
+
+    if (upload.orphan)
+    {
+        this->uploadedVertices = 0;
+        this->drawnVertices = 0;
+    }
+
+    upload.start = this->uploadedVertices;
+    upload.count = count - upload.start;
+
+    this->uploadedVertices = count;
+
+    return upload;
+}
+
+void TextVertices::MarkDrawn()
+{
+    this->drawnVertices = this->uploadedVertices;
+}
+
+const std::vector<TextVertices::DrawCommand> & TextVertices::GetDrawCommands() const
+{
+    return this->drawCommands;
+}
+
+const std::vector<vertex::Vertex> & TextVertices::GetVertices() const
+{
+    return this->vertices;
+}
@@ -0,0 +1,97 @@
+#include "common/luax.h"
+#include "objects/atlas/wrap_atlas.h"
+
+#include "modules/filesystem/wrap_filesystem.h"
+
+using namespace love;
+
+/* Returns the page Image and the Quad inside it */
+int Wrap_Atlas::Add(lua_State * L)
+{
+    Atlas * self = Wrap_Atlas::CheckAtlas(L, 1);
+
+    Image * page = nullptr;
+    Quad * quad = nullptr;
+
+    Luax::CatchException(L, [&]() {
+        StrongReference<Data> data(Wrap_Filesystem::GetData(L, 2), Acquire::NORETAIN);
+        page = self->Add(data, quad);
+    });
+
+    Luax::PushType(L, page);
+
+    Luax::PushType(L, quad);
+    quad->Release();
+
+    return 2;
+}
+
+int Wrap_Atlas::GetPage(lua_State * L)
+{
+    Atlas * self = Wrap_Atlas::CheckAtlas(L, 1);
+    size_t index = luaL_checkinteger(L, 2) - 1;
+
+    Image * page = nullptr;
+
+    Luax::CatchException(L, [&]() {
+        page = self->GetPage(index);
+    });
+
+    Luax::PushType(L, page);
+
+    return 1;
+}
+
+int Wrap_Atlas::GetPageCount(lua_State * L)
+{
+    Atlas * self = Wrap_Atlas::CheckAtlas(L, 1);
+
+    lua_pushinteger(L, self->GetPageCount());
+
+    return 1;
+}
+
+int Wrap_Atlas::GetPageSize(lua_State * L)
+{
+    Atlas * self = Wrap_Atlas::CheckAtlas(L, 1);
+
+    lua_pushinteger(L, self->GetPageSize());
+
+    return 1;
+}
+
+int Wrap_Atlas::GetOccupancy(lua_State * L)
+{
+    Atlas * self = Wrap_Atlas::CheckAtlas(L, 1);
+    size_t index = luaL_optinteger(L, 2, 1) - 1;
+
+    float occupancy = 0.0f;
+
+    Luax::CatchException(L, [&]() {
+        occupancy = self->GetOccupancy(index);
+    });
+
+    lua_pushnumber(L, occupancy);
+
+    return 1;
+}
+
+Atlas * Wrap_Atlas::CheckAtlas(lua_State * L, int index)
+{
+    return Luax::CheckType<Atlas>(L, index);
+}
+
+int Wrap_Atlas::Register(lua_State * L)
+{
+    luaL_Reg reg[] =
+    {
+        { "add",          Add          },
+        { "getOccupancy", GetOccupancy },
+        { "getPage",      GetPage      },
+        { "getPageCount", GetPageCount },
+        { "getPageSize",  GetPageSize  },
+        { 0,              0            }
+    };
+
+    return Luax::RegisterType(L, &Atlas::type, reg, nullptr);
+}
@@ -0,0 +1,351 @@
+#include "common/luax.h"
+#include "objects/mesh/wrap_mesh.h"
+
+#include "objects/texture/wrap_texture.h"
+
+using namespace love;
+
+/*
+** Reads one vertex table at @index
+** Missing color components default to 1, everything else to 0
+*/
+static void CheckVertex(lua_State * L, int index, const std::vector<Mesh::AttribFormat> & format,
+                        std::vector<float> & data)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    int component = 1;
+
+    for (const Mesh::AttribFormat & attribute : format)
+    {
+        float fallback = (attribute.name == "VertexColor") ? 1.0f : 0.0f;
+
+        for (int i = 0; i < attribute.components; i++, component++)
+        {
+            lua_rawgeti(L, index, component);
+            data.push_back(luaL_optnumber(L, -1, fallback));
+            lua_pop(L, 1);
+        }
+    }
+}
+
+std::vector<Mesh::AttribFormat> Wrap_Mesh::CheckVertexFormat(lua_State * L, int index)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    std::vector<Mesh::AttribFormat> format;
+    size_t length = lua_objlen(L, index);
+
+    for (size_t i = 1; i <= length; i++)
+    {
+        lua_rawgeti(L, index, i);
+        luaL_checktype(L, -1, LUA_TTABLE);
+
+        for (int field = 1; field <= 3; field++)
+            lua_rawgeti(L, -field, field);
+
+        Mesh::AttribFormat attribute;
+
+        attribute.name = luaL_checkstring(L, -3);
+
+        const char * typeName = luaL_checkstring(L, -2);
+        if (!Mesh::GetConstant(typeName, attribute.type))
+            luaL_error(L, "Invalid vertex data type: %s", typeName);
+
+        attribute.components = (int)luaL_checkinteger(L, -1);
+
+        lua_pop(L, 4);
+
+        format.push_back(attribute);
+    }
+
+    return format;
+}
+
+size_t Wrap_Mesh::CheckVertices(lua_State * L, int index, const std::vector<Mesh::AttribFormat> & format,
+                                std::vector<float> & data)
+{
+    luaL_checktype(L, index, LUA_TTABLE);
+
+    size_t count = lua_objlen(L, index);
+
+    for (size_t i = 1; i <= count; i++)
+    {
+        lua_rawgeti(L, index, i);
+        CheckVertex(L, lua_gettop(L), format, data);
+        lua_pop(L, 1);
+    }
+
+    return count;
+}
+
+int Wrap_Mesh::SetVertices(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+    size_t start = luaL_optinteger(L, 3, 1) - 1;
+
+    std::vector<float> data;
+    Wrap_Mesh::CheckVertices(L, 2, self->GetVertexFormat(), data);
+
+    Luax::CatchException(L, [&]() {
+        self->SetVertices(data, start);
+    });
+
+    return 0;
+}
+
+int Wrap_Mesh::SetVertex(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index = luaL_checkinteger(L, 2) - 1;
+
+    std::vector<float> data;
+
+    if (lua_istable(L, 3))
+        CheckVertex(L, 3, self->GetVertexFormat(), data);
+    else
+    {
+        for (size_t i = 0; i < self->GetVertexStride(); i++)
+            data.push_back(luaL_checknumber(L, 3 + i));
+    }
+
+    Luax::CatchException(L, [&]() {
+        self->SetVertex(index, data);
+    });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertex(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+    size_t index = luaL_checkinteger(L, 2) - 1;
+
+    std::vector<float> data;
+
+    Luax::CatchException(L, [&]() {
+        data = self->GetVertex(index);
+    });
+
+    for (float value : data)
+        lua_pushnumber(L, value);
+
+    return data.size();
+}
+
+int Wrap_Mesh::GetVertexCount(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    lua_pushinteger(L, self->GetVertexCount());
+
+    return 1;
+}
+
+int Wrap_Mesh::GetVertexFormat(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+    const auto & format = self->GetVertexFormat();
+
+    lua_createtable(L, format.size(), 0);
+
+    for (size_t index = 0; index < format.size(); index++)
+    {
+        const char * typeName = nullptr;
+        Mesh::GetConstant(format[index].type, typeName);
+
+        lua_createtable(L, 3, 0);
+
+        Luax::PushString(L, format[index].name);
+        lua_rawseti(L, -2, 1);
+
+        lua_pushstring(L, typeName);
+        lua_rawseti(L, -2, 2);
+
+        lua_pushinteger(L, format[index].components);
+        lua_rawseti(L, -2, 3);
+
+        lua_rawseti(L, -2, index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_Mesh::SetVertexMap(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+    {
+        self->SetVertexMap();
+        return 0;
+    }
+
+    std::vector<uint32_t> map;
+
+    if (lua_istable(L, 2))
+    {
+        size_t length = lua_objlen(L, 2);
+
+        for (size_t index = 1; index <= length; index++)
+        {
+            lua_rawgeti(L, 2, index);
+            map.push_back(luaL_checkinteger(L, -1) - 1);
+            lua_pop(L, 1);
+        }
+    }
+    else
+    {
+        for (int index = 2; index <= lua_gettop(L); index++)
+            map.push_back(luaL_checkinteger(L, index) - 1);
+    }
+
+    Luax::CatchException(L, [&]() {
+        self->SetVertexMap(map);
+    });
+
+    return 0;
+}
+
+int Wrap_Mesh::GetVertexMap(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    std::vector<uint32_t> map;
+
+    if (!self->GetVertexMap(map))
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_createtable(L, map.size(), 0);
+
+    for (size_t index = 0; index < map.size(); index++)
+    {
+        lua_pushinteger(L, map[index] + 1);
+        lua_rawseti(L, -2, index + 1);
+    }
+
+    return 1;
+}
+
+int Wrap_Mesh::SetTexture(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetTexture();
+    else
+    {
+        Texture * texture = Wrap_Texture::CheckTexture(L, 2);
+        self->SetTexture(texture);
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::GetTexture(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+    Texture * texture = self->GetTexture();
+
+    if (texture == nullptr)
+        return 0;
+
+    Luax::PushType(L, texture);
+
+    return 1;
+}
+
+int Wrap_Mesh::SetDrawMode(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    Mesh::DrawMode mode;
+    const char * name = luaL_checkstring(L, 2);
+
+    if (!Mesh::GetConstant(name, mode))
+        return Luax::EnumError(L, "mesh draw mode", Mesh::GetConstants(mode), name);
+
+    self->SetDrawMode(mode);
+
+    return 0;
+}
+
+int Wrap_Mesh::GetDrawMode(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    const char * name = nullptr;
+
+    if (!Mesh::GetConstant(self->GetDrawMode(), name))
+        return luaL_error(L, "Unknown mesh draw mode.");
+
+    lua_pushstring(L, name);
+
+    return 1;
+}
+
+int Wrap_Mesh::SetDrawRange(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetDrawRange();
+    else
+    {
+        int start = (int)luaL_checkinteger(L, 2) - 1;
+        int count = (int)luaL_checkinteger(L, 3);
+
+        Luax::CatchException(L, [&]() {
+            self->SetDrawRange(start, count);
+        });
+    }
+
+    return 0;
+}
+
+int Wrap_Mesh::GetDrawRange(lua_State * L)
+{
+    Mesh * self = Wrap_Mesh::CheckMesh(L, 1);
+
+    int start = 0;
+    int count = 1;
+
+    if (!self->GetDrawRange(start, count))
+        return 0;
+
+    lua_pushinteger(L, start + 1);
+    lua_pushinteger(L, count);
+
+    return 2;
+}
+
+Mesh * Wrap_Mesh::CheckMesh(lua_State * L, int index)
+{
+    return Luax::CheckType<Mesh>(L, index);
+}
+
+int Wrap_Mesh::Register(lua_State * L)
+{
+    luaL_Reg reg[] =
+    {
+        { "getDrawMode",     GetDrawMode     },
+        { "getDrawRange",    GetDrawRange    },
+        { "getTexture",      GetTexture      },
+        { "getVertex",       GetVertex       },
+        { "getVertexCount",  GetVertexCount  },
+        { "getVertexFormat", GetVertexFormat },
+        { "getVertexMap",    GetVertexMap    },
+        { "setDrawMode",     SetDrawMode     },
+        { "setDrawRange",    SetDrawRange    },
+        { "setTexture",      SetTexture      },
+        { "setVertex",       SetVertex       },
+        { "setVertexMap",    SetVertexMap    },
+        { "setVertices",     SetVertices     },
+        { 0,                 0               }
+    };
+
+    return Luax::RegisterType(L, &Mesh::type, reg, nullptr);
+}
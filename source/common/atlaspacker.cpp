@@ -0,0 +1,166 @@
+#include "common/atlaspacker.h"
+
+#include <climits>
+
+using namespace love;
+
+AtlasPacker::AtlasPacker(int width, int height) : width(width),
+                                                  height(height),
+                                                  usedArea(0)
+{
+    this->Reset();
+}
+
+void AtlasPacker::Reset()
+{
+    this->skyline.clear();
+    this->skyline.push_back({ 0, 0, this->width });
+
+    this->usedArea = 0;
+}
+
+/*
+** Extra width is a new empty level along the bottom edge
+** Extra height needs nothing, levels only say how high they are
+*/
+void AtlasPacker::Resize(int width, int height)
+{
+    if (width > this->width)
+    {
+        Level & last = this->skyline.back();
+
+        if (last.y == 0)
+            last.width += width - this->width;
+        else
+            this->skyline.push_back({ this->width, 0, width - this->width });
+
+        this->width = width;
+    }
+
+    this->height = std::max(height, this->height);
+}
+
+int AtlasPacker::GetWidth() const
+{
+    return this->width;
+}
+
+int AtlasPacker::GetHeight() const
+{
+    return this->height;
+}
+
+float AtlasPacker::GetOccupancy() const
+{
+    return (float)this->usedArea / (float)(this->width * this->height);
+}
+
+/*
+** Would a rectangle starting at level @index fit?
+** @y is where it would have to sit, on top of
+** the highest level it spans
+*/
+bool AtlasPacker::Fits(size_t index, int width, int height, int & y) const
+{
+    int x = this->skyline[index].x;
+
+    if (x + width > this->width)
+        return false;
+
+    int remaining = width;
+    y = this->skyline[index].y;
+
+    while (remaining > 0)
+    {
+        y = std::max(y, this->skyline[index].y);
+
+        if (y + height > this->height)
+            return false;
+
+        remaining -= this->skyline[index].width;
+        index++;
+    }
+
+    return true;
+}
+
+/*
+** Pick the spot whose top edge ends up lowest,
+** breaking ties on the narrowest level
+*/
+bool AtlasPacker::Pack(int width, int height, Rect & out)
+{
+    if (width <= 0 || height <= 0)
+        return false;
+
+    int bestTop = INT_MAX;
+    int bestWidth = INT_MAX;
+    size_t bestIndex = this->skyline.size();
+
+    for (size_t index = 0; index < this->skyline.size(); index++)
+    {
+        int y = 0;
+
+        if (!this->Fits(index, width, height, y))
+            continue;
+
+        int top = y + height;
+        int levelWidth = this->skyline[index].width;
+
+        if (top < bestTop || (top == bestTop && levelWidth < bestWidth))
+        {
+            bestTop = top;
+            bestWidth = levelWidth;
+            bestIndex = index;
+
+            out = { this->skyline[index].x, y, width, height };
+        }
+    }
+
+    if (bestIndex == this->skyline.size())
+        return false;
+
+    this->AddLevel(bestIndex, out);
+    this->usedArea += width * height;
+
+    return true;
+}
+
+/*
+** Raise the skyline under @rect, trim the levels it
+** now covers and merge neighbours of equal height
+*/
+void AtlasPacker::AddLevel(size_t index, const Rect & rect)
+{
+    this->skyline.insert(this->skyline.begin() + index, { rect.x, rect.y + rect.h, rect.w });
+
+    for (size_t next = index + 1; next < this->skyline.size(); next++)
+    {
+        const Level & previous = this->skyline[next - 1];
+        Level & level = this->skyline[next];
+
+        int overlap = (previous.x + previous.width) - level.x;
+
+        if (overlap <= 0)
+            break;
+
+        level.x += overlap;
+        level.width -= overlap;
+
+        if (level.width > 0)
+            break;
+
+        this->skyline.erase(this->skyline.begin() + next);
+        next--;
+    }
+
+    for (size_t next = 1; next < this->skyline.size(); next++)
+    {
+        if (this->skyline[next - 1].y != this->skyline[next].y)
+            continue;
+
+        this->skyline[next - 1].width += this->skyline[next].width;
+        this->skyline.erase(this->skyline.begin() + next);
+        next--;
+    }
+}
@@ -0,0 +1,256 @@
+#include "common/distancefield.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    constexpr double INF = 1e20;
+
+    /* Where the parabolas rooted at @q and @r cross */
+    inline double Intersect(const double * f, size_t stride, int q, int r)
+    {
+        double fq = f[q * stride] + (double)q * q;
+        double fr = f[r * stride] + (double)r * r;
+
+        return (fq - fr) / (2.0 * (q - r));
+    }
+
+    /*
+    ** Distance from a pixel centre to the outline crossing it,
+    ** positive outside, from its @coverage and the gradient around it
+    */
+    double EdgeDistance(double gx, double gy, double coverage)
+    {
+        if (gx == 0.0 || gy == 0.0)
+            return 0.5 - coverage;
+
+        double length = std::sqrt(gx * gx + gy * gy);
+
+        gx = std::fabs(gx / length);
+        gy = std::fabs(gy / length);
+
+        if (gx < gy)
+            std::swap(gx, gy);
+
+        double corner = 0.5 * gy / gx;
+
+        if (coverage < corner)
+            return 0.5 * (gx + gy) - std::sqrt(2.0 * gx * gy * coverage);
+        else if (coverage < 1.0 - corner)
+            return (0.5 - coverage) * gx;
+
+        return -0.5 * (gx + gy) + std::sqrt(2.0 * gx * gy * (1.0 - coverage));
+    }
+
+    /*
+    ** Squared distance transform of one row or column
+    ** (Felzenszwalb and Huttenlocher), in place over @f
+    ** @source follows along, naming the cell each distance is to
+    ** @v, @z, @d and @found are scratch for @count entries (@z needs one more)
+    */
+    void Transform(double * f, int * source, size_t stride, int count,
+                   int * v, double * z, double * d, int * found)
+    {
+        int k = 0;
+
+        v[0] = 0;
+        z[0] = -INF;
+        z[1] = INF;
+
+        for (int q = 1; q < count; q++)
+        {
+            double s = Intersect(f, stride, q, v[k]);
+
+            /* Never passes k == 0, z[0] is below any intersection */
+            while (s <= z[k])
+            {
+                k--;
+                s = Intersect(f, stride, q, v[k]);
+            }
+
+            k++;
+
+            v[k]     = q;
+            z[k]     = s;
+            z[k + 1] = INF;
+        }
+
+        k = 0;
+
+        for (int q = 0; q < count; q++)
+        {
+            while (z[k + 1] < q)
+                k++;
+
+            int r = v[k];
+
+            d[q]     = (double)(q - r) * (q - r) + f[r * stride];
+            found[q] = source[r * stride];
+        }
+
+        for (int q = 0; q < count; q++)
+        {
+            f[q * stride]      = d[q];
+            source[q * stride] = found[q];
+        }
+    }
+
+    /* Find the nearest zero in @grid for every cell, as an index into @grid */
+    void Transform2D(std::vector<double> & grid, std::vector<int> & source, int width, int height)
+    {
+        int longest = std::max(width, height);
+
+        std::vector<int> v(longest);
+        std::vector<double> z(longest + 1);
+        std::vector<double> d(longest);
+        std::vector<int> found(longest);
+
+        for (int x = 0; x < width; x++)
+            Transform(&grid[x], &source[x], width, height, v.data(), z.data(), d.data(), found.data());
+
+        for (int y = 0; y < height; y++)
+        {
+            Transform(&grid[y * width], &source[y * width], 1, width,
+                      v.data(), z.data(), d.data(), found.data());
+        }
+    }
+}
+
+/*
+** Every pixel the outline touches gets the point of the outline
+** nearest its centre, from its coverage and the gradient around it
+** (Gustavson's edge estimate), so FreeType's antialiasing carries
+** into the field; everything else measures to the outline point
+** of its nearest such pixel
+*/
+void DistanceField::Generate(const uint8_t * coverage, size_t pitch, int width, int height,
+                             int spread, uint8_t * out)
+{
+    int paddedWidth  = DistanceField::GetPadded(width, spread);
+    int paddedHeight = DistanceField::GetPadded(height, spread);
+
+    size_t count = (size_t)paddedWidth * paddedHeight;
+
+    auto sample = [&](int x, int y) -> double
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height)
+            return 0.0;
+
+        return coverage[y * pitch + x] / 255.0;
+    };
+
+    std::vector<double> grid(count, INF);
+    std::vector<int> source(count, -1);
+
+    /* Where the outline is, for each pixel it touches, and which side each pixel is on */
+    std::vector<double> outlineX(count);
+    std::vector<double> outlineY(count);
+    std::vector<bool> inside(count, false);
+
+    /* One pixel into the padding, where the outline can still be next door */
+    for (int y = -1; y <= height; y++)
+    {
+        for (int x = -1; x <= width; x++)
+        {
+            size_t index = (size_t)(y + spread) * paddedWidth + x + spread;
+            double value = sample(x, y);
+
+            inside[index] = (value >= 0.5);
+
+            outlineX[index] = x + spread;
+            outlineY[index] = y + spread;
+
+            if (value > 0.0 && value < 1.0)
+            {
+                double gx = sample(x + 1, y - 1) + M_SQRT2 * sample(x + 1, y) + sample(x + 1, y + 1) -
+                            sample(x - 1, y - 1) - M_SQRT2 * sample(x - 1, y) - sample(x - 1, y + 1);
+
+                double gy = sample(x - 1, y + 1) + M_SQRT2 * sample(x, y + 1) + sample(x + 1, y + 1) -
+                            sample(x - 1, y - 1) - M_SQRT2 * sample(x, y - 1) - sample(x + 1, y - 1);
+
+                double length   = std::sqrt(gx * gx + gy * gy);
+                double distance = EdgeDistance(gx, gy, value);
+
+                /* The gradient points inwards, the outline is @distance along it */
+                if (length > 0.0)
+                {
+                    outlineX[index] += distance * gx / length;
+                    outlineY[index] += distance * gy / length;
+                }
+            }
+            else
+            {
+                /*
+                ** Whole pixels only touch the outline when it runs along
+                ** their side, with a whole pixel of the other kind there
+                */
+                static constexpr int sides[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+                double other = 1.0 - value;
+                const int * side = nullptr;
+
+                for (const auto & candidate : sides)
+                {
+                    if (sample(x + candidate[0], y + candidate[1]) == other)
+                    {
+                        side = candidate;
+                        break;
+                    }
+                }
+
+                if (side == nullptr)
+                    continue;
+
+                outlineX[index] += side[0] * 0.5;
+                outlineY[index] += side[1] * 0.5;
+            }
+
+            grid[index]   = 0.0;
+            source[index] = (int)index;
+        }
+    }
+
+    Transform2D(grid, source, paddedWidth, paddedHeight);
+
+    /*
+    ** The nearest pixel centre doesn't always have the nearest outline,
+    ** so the ones found for the neighbours get a look too
+    */
+    for (int y = 0; y < paddedHeight; y++)
+    {
+        for (int x = 0; x < paddedWidth; x++)
+        {
+            size_t index = (size_t)y * paddedWidth + x;
+            double nearest = INF;
+
+            for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, paddedHeight - 1); ny++)
+            {
+                for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, paddedWidth - 1); nx++)
+                {
+                    int found = source[ny * paddedWidth + nx];
+
+                    if (found < 0)
+                        continue;
+
+                    double dx = x - outlineX[found];
+                    double dy = y - outlineY[found];
+
+                    nearest = std::min(nearest, dx * dx + dy * dy);
+                }
+            }
+
+            double distance = std::sqrt(nearest);
+
+            if (inside[index])
+                distance = -distance;
+
+            double scaled = 128.0 - distance * 127.0 / spread;
+
+            out[index] = (uint8_t)std::clamp(scaled + 0.5, 0.0, 255.0);
+        }
+    }
+}
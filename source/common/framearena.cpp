@@ -0,0 +1,74 @@
+#include "common/framearena.h"
+
+#include <algorithm>
+
+using namespace love;
+
+FrameArena::FrameArena() : current(0),
+                           offset(0),
+                           used(0)
+{}
+
+/*
+** Blocks are filled front to back
+** When none of the remaining ones has room, a new one is added
+*/
+void * FrameArena::Allocate(size_t size, size_t alignment)
+{
+    for (; this->current < this->blocks.size(); this->current++, this->offset = 0)
+    {
+        Block & block = this->blocks[this->current];
+
+        size_t start = (this->offset + alignment - 1) & ~(alignment - 1);
+
+        if (start + size <= block.size)
+        {
+            this->offset = start + size;
+            this->used  += size;
+
+            return block.data.get() + start;
+        }
+    }
+
+    size_t blockSize = std::max(size, BLOCK_SIZE);
+    this->blocks.push_back({ std::make_unique<uint8_t[]>(blockSize), blockSize });
+
+    this->offset = size;
+    this->used  += size;
+
+    return this->blocks.back().data.get();
+}
+
+/*
+** A frame that spilled into several blocks gets them
+** merged into one, so the next frame fits in a single block
+*/
+void FrameArena::Reset()
+{
+    if (this->blocks.size() > 1)
+    {
+        size_t capacity = this->GetCapacity();
+
+        this->blocks.clear();
+        this->blocks.push_back({ std::make_unique<uint8_t[]>(capacity), capacity });
+    }
+
+    this->current = 0;
+    this->offset  = 0;
+    this->used    = 0;
+}
+
+size_t FrameArena::GetUsed() const
+{
+    return this->used;
+}
+
+size_t FrameArena::GetCapacity() const
+{
+    size_t capacity = 0;
+
+    for (const Block & block : this->blocks)
+        capacity += block.size;
+
+    return capacity;
+}
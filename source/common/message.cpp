@@ -5,8 +5,11 @@ using namespace love;
 #define FROM_LUA_ERROR "Argument %d can't be stored safely\nExpected boolean, number, string or userdata."
 
 Message::Message(const std::string & name, const std::vector<Variant> & args) : name(name),
-                                                                                args(args)
-{}
+                                                                                argCount(0)
+{
+    for (const Variant & arg : args)
+        this->AddArg(arg);
+}
 
 Message::~Message()
 {}
@@ -46,8 +49,90 @@ int Message::ToLua(lua_State * L)
 {
     Luax::PushString(L, this->name);
 
-    for (const Variant & v : this->args)
-        v.ToLua(L);
+    for (size_t index = 0; index < this->argCount; index++)
+    {
+        if (index < MAX_INLINE_ARGS)
+            this->inlineArgs[index].ToLua(L);
+        else
+            this->extraArgs[index - MAX_INLINE_ARGS].ToLua(L);
+    }
+
+    return (int)this->argCount + 1;
+}
+
+/* Releases whatever the old arguments referenced, the name keeps its capacity */
+void Message::Reset(const char * name)
+{
+    size_t inlineCount = std::min(this->argCount, MAX_INLINE_ARGS);
+
+    for (size_t index = 0; index < inlineCount; index++)
+        this->inlineArgs[index] = Variant();
 
-    return (int)this->args.size() + 1;
+    this->extraArgs.clear();
+    this->argCount = 0;
+
+    this->name.assign(name);
+}
+
+void Message::AddArg(const Variant & arg)
+{
+    if (this->argCount < MAX_INLINE_ARGS)
+        this->inlineArgs[this->argCount] = arg;
+    else
+        this->extraArgs.push_back(arg);
+
+    this->argCount++;
 }
+
+void Message::SetArg(size_t index, const Variant & arg)
+{
+    if (index >= this->argCount)
+        throw love::Exception("Message argument %zu out of range.", index + 1);
+
+    if (index < MAX_INLINE_ARGS)
+        this->inlineArgs[index] = arg;
+    else
+        this->extraArgs[index - MAX_INLINE_ARGS] = arg;
+}
+
+size_t Message::GetArgCount() const
+{
+    return this->argCount;
+}
+
+/* MESSAGE POOL */
+
+MessagePool::MessagePool() : next(0)
+{
+    for (auto & message : this->messages)
+        message = new Message("");
+}
+
+/* Messages still queued somewhere go when those let go of them */
+MessagePool::~MessagePool()
+{
+    for (auto & message : this->messages)
+        message->Release();
+}
+
+Message * MessagePool::Acquire(const char * name)
+{
+    for (size_t tries = 0; tries < CAPACITY; tries++)
+    {
+        Message * message = this->messages[this->next];
+        this->next = (this->next + 1) % CAPACITY;
+
+        /* Only the pool's own reference left */
+        if (message->GetReferenceCount() != 1)
+            continue;
+
+        message->Reset(name);
+        message->Retain();
+
+        return message;
+    }
+
+    return new Message(name);
+}
+
+/* MESSAGE POOL */
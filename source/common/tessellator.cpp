@@ -0,0 +1,107 @@
+#include "common/tessellator.h"
+
+#include <cmath>
+
+using namespace love;
+
+Vector2 * Tessellator::GetScratch(size_t count)
+{
+    if (this->scratch.size() < count)
+        this->scratch.resize(count);
+
+    return this->scratch.data();
+}
+
+const Vector2 * Tessellator::GetTable(TableMap & tables, int key, float step, int count)
+{
+    auto found = tables.find(key);
+
+    if (found != tables.end())
+        return found->second.data();
+
+    if (tables.size() >= MAX_TABLES)
+        tables.clear();
+
+    std::vector<Vector2> & table = tables[key];
+    table.resize(count);
+
+    for (int index = 0; index < count; index++)
+    {
+        float phi = step * index;
+        table[index] = Vector2(cosf(phi), sinf(phi));
+    }
+
+    return table.data();
+}
+
+void Tessellator::Ellipse(Vector2 * out, float x, float y, float a, float b, int points)
+{
+    const Vector2 * unit = this->GetTable(this->circles, points, (float)(M_PI * 2) / points, points);
+
+    for (int index = 0; index < points; index++)
+    {
+        out[index].x = x + a * unit[index].x;
+        out[index].y = y + b * unit[index].y;
+    }
+
+    out[points] = out[0];
+}
+
+/*
+** Arcs start at any angle, so there's no table to share
+** The step is a rotation applied to the previous point instead,
+** which keeps it at two trig calls per arc
+** Doubles keep the error from adding up over long arcs
+*/
+void Tessellator::Arc(Vector2 * out, float x, float y, float radius, float angle1, float angle2, int points)
+{
+    double step = ((double)angle2 - angle1) / points;
+
+    double stepCos = cos(step);
+    double stepSin = sin(step);
+
+    double c = cos(angle1);
+    double s = sin(angle1);
+
+    for (int index = 0; index <= points; index++)
+    {
+        out[index].x = x + radius * (float)c;
+        out[index].y = y + radius * (float)s;
+
+        double next = c * stepCos - s * stepSin;
+
+        s = s * stepCos + c * stepSin;
+        c = next;
+    }
+}
+
+int Tessellator::GetRoundedRectangleSize(int points)
+{
+    return (points + 2) * 4 + 1;
+}
+
+/*
+** Every corner is the same quarter circle turned by 90 degrees,
+** and those turns only swap and negate cos and sin
+*/
+void Tessellator::RoundedRectangle(Vector2 * out, float x, float y, float width, float height,
+                                   float rx, float ry, int points)
+{
+    const float halfPi = (float)(M_PI / 2);
+
+    int corner = points + 2;
+    const Vector2 * unit = this->GetTable(this->corners, points, halfPi / (points + 1.0f), corner);
+
+    for (int index = 0; index < corner; index++)
+    {
+        float c = unit[index].x;
+        float s = unit[index].y;
+
+        out[index]              = Vector2(x + rx * (1 - c),         y + ry * (1 - s));
+        out[index + corner]     = Vector2(x + width - rx * (1 - s), y + ry * (1 - c));
+        out[index + corner * 2] = Vector2(x + width - rx * (1 - c), y + height - ry * (1 - s));
+        out[index + corner * 3] = Vector2(x + rx * (1 - s),         y + height - ry * (1 - c));
+    }
+
+    out[corner * 4] = out[0];
+}
@@ -1,7 +1,326 @@
 #include "common/variant.h"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace love;
 
+/*
+** Tables are flattened into one buffer, in native byte order since
+** it never leaves the process: a tag byte for every value, then
+**   TAG_NUMBER    a double
+**   TAG_STRING    a uint32_t length and the bytes
+**   TAG_LUSERDATA the pointer
+**   TAG_OBJECT    the Proxy
+**   TAG_TABLE     uint32_t array size hint and pair count, then each key and value
+*/
+namespace
+{
+    enum Tag : uint8_t
+    {
+        TAG_NIL,
+        TAG_FALSE,
+        TAG_TRUE,
+        TAG_NUMBER,
+        TAG_STRING,
+        TAG_LUSERDATA,
+        TAG_OBJECT,
+        TAG_TABLE
+    };
+
+    /*
+    ** Fills a buffer that only grows, doubling; going through
+    ** vector::resize for every value costs more than the encoding
+    */
+    class Writer
+    {
+        public:
+            Writer(size_t capacity) : data(capacity),
+                                      size(0)
+            {}
+
+            /* Room for @tag and @count more bytes, returning where those go */
+            uint8_t * Append(Tag tag, size_t count)
+            {
+                if (this->size + 1 + count > this->data.size())
+                    this->data.resize(std::max(this->data.size() * 2, this->size + 1 + count));
+
+                uint8_t * dest = &this->data[this->size];
+
+                *dest = tag;
+                this->size += 1 + count;
+
+                return dest + 1;
+            }
+
+            template <typename T>
+            void Write(Tag tag, const T & value)
+            {
+                memcpy(this->Append(tag, sizeof(T)), &value, sizeof(T));
+            }
+
+            uint8_t * At(size_t offset)
+            {
+                return &this->data[offset];
+            }
+
+            size_t GetSize() const
+            {
+                return this->size;
+            }
+
+            /* Trim to what was written; shrinking never reallocates */
+            std::vector<uint8_t> Finish()
+            {
+                this->data.resize(this->size);
+                return std::move(this->data);
+            }
+
+        private:
+            std::vector<uint8_t> data;
+            size_t size;
+    };
+
+    template <typename T>
+    inline T Read(const uint8_t *& cursor)
+    {
+        T value;
+
+        memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+
+        return value;
+    }
+
+    enum Result
+    {
+        RESULT_ENCODED,
+        RESULT_UNSUPPORTED,      //< no encoding, the Variant is left unknown
+        RESULT_FOREIGN_USERDATA, //< these two are raised as Lua errors
+        RESULT_TOO_DEEP          //< once nothing needs destroying
+    };
+
+    /*
+    ** Append the value at @index
+    ** @path holds the tables being encoded, to catch cycles
+    */
+    Result Encode(lua_State * L, int index, Writer & out,
+                  std::vector<const void *> & path, bool & hasObjects)
+    {
+        if (index < 0)
+            index += lua_gettop(L) + 1;
+
+        switch (lua_type(L, index))
+        {
+            case LUA_TNIL:
+                out.Append(TAG_NIL, 0);
+                return RESULT_ENCODED;
+            case LUA_TBOOLEAN:
+                out.Append(lua_toboolean(L, index) ? TAG_TRUE : TAG_FALSE, 0);
+                return RESULT_ENCODED;
+            case LUA_TNUMBER:
+                out.Write<double>(TAG_NUMBER, lua_tonumber(L, index));
+                return RESULT_ENCODED;
+            case LUA_TSTRING:
+            {
+                size_t length = 0;
+                const char * string = lua_tolstring(L, index, &length);
+
+                uint8_t * dest = out.Append(TAG_STRING, sizeof(uint32_t) + length);
+                uint32_t size  = (uint32_t)length;
+
+                memcpy(dest, &size, sizeof(size));
+                memcpy(dest + sizeof(size), string, length);
+
+                return RESULT_ENCODED;
+            }
+            case LUA_TLIGHTUSERDATA:
+                out.Write<void *>(TAG_LUSERDATA, lua_touserdata(L, index));
+                return RESULT_ENCODED;
+            case LUA_TUSERDATA:
+            {
+                Proxy * proxy = Variant::TryExtractProxy(L, index);
+
+                if (proxy == nullptr)
+                    return RESULT_FOREIGN_USERDATA;
+
+                out.Write<Proxy>(TAG_OBJECT, *proxy);
+
+                hasObjects = true;
+
+                return RESULT_ENCODED;
+            }
+            case LUA_TTABLE:
+            {
+                const void * table = lua_topointer(L, index);
+
+                if (std::find(path.begin(), path.end(), table) != path.end())
+                    throw love::Exception("Cycle detected in table.");
+
+                /* A key and a value for every level of nesting */
+                if (!lua_checkstack(L, 2))
+                    return RESULT_TOO_DEEP;
+
+                path.push_back(table);
+
+                uint8_t * header = out.Append(TAG_TABLE, sizeof(uint32_t) * 2);
+                uint32_t arraySize = (uint32_t)lua_objlen(L, index);
+
+                memcpy(header, &arraySize, sizeof(arraySize));
+
+                /* The count is filled in at the end, @header may have moved by then */
+                size_t countOffset = out.GetSize() - sizeof(uint32_t);
+
+                uint32_t count = 0;
+
+                lua_pushnil(L);
+
+                while (lua_next(L, index))
+                {
+                    Result result = Encode(L, -2, out, path, hasObjects);
+
+                    if (result == RESULT_ENCODED)
+                        result = Encode(L, -1, out, path, hasObjects);
+
+                    if (result != RESULT_ENCODED)
+                    {
+                        lua_pop(L, 2);
+                        path.pop_back();
+
+                        return result;
+                    }
+
+                    lua_pop(L, 1);
+                    count++;
+                }
+
+                memcpy(out.At(countOffset), &count, sizeof(count));
+                path.pop_back();
+
+                return RESULT_ENCODED;
+            }
+            default:
+                return RESULT_UNSUPPORTED;
+        }
+    }
+
+    /* Push the value at @cursor, moving past it */
+    void Decode(lua_State * L, const uint8_t *& cursor)
+    {
+        switch (Read<uint8_t>(cursor))
+        {
+            case TAG_FALSE:
+                lua_pushboolean(L, 0);
+                break;
+            case TAG_TRUE:
+                lua_pushboolean(L, 1);
+                break;
+            case TAG_NUMBER:
+                lua_pushnumber(L, Read<double>(cursor));
+                break;
+            case TAG_STRING:
+            {
+                uint32_t length = Read<uint32_t>(cursor);
+
+                lua_pushlstring(L, (const char *)cursor, length);
+                cursor += length;
+
+                break;
+            }
+            case TAG_LUSERDATA:
+                lua_pushlightuserdata(L, Read<void *>(cursor));
+                break;
+            case TAG_OBJECT:
+            {
+                Proxy proxy = Read<Proxy>(cursor);
+                Luax::PushType(L, *proxy.type, proxy.object);
+
+                break;
+            }
+            case TAG_TABLE:
+            {
+                uint32_t arraySize = Read<uint32_t>(cursor);
+                uint32_t count     = Read<uint32_t>(cursor);
+
+                /* The table, a key and a value for every level of nesting */
+                luaL_checkstack(L, 3, "table too deeply nested");
+
+                arraySize = std::min(arraySize, count);
+                lua_createtable(L, arraySize, count - arraySize);
+
+                for (uint32_t pair = 0; pair < count; pair++)
+                {
+                    Decode(L, cursor);
+                    Decode(L, cursor);
+
+                    lua_rawset(L, -3);
+                }
+
+                break;
+            }
+            case TAG_NIL:
+            default:
+                lua_pushnil(L);
+                break;
+        }
+    }
+
+    /* Call @func with every object in the value at @cursor, moving past it */
+    template <typename T>
+    void ForEachObject(const uint8_t *& cursor, T func)
+    {
+        switch (Read<uint8_t>(cursor))
+        {
+            case TAG_NUMBER:
+                cursor += sizeof(double);
+                break;
+            case TAG_STRING:
+                cursor += Read<uint32_t>(cursor);
+                break;
+            case TAG_LUSERDATA:
+                cursor += sizeof(void *);
+                break;
+            case TAG_OBJECT:
+                func(Read<Proxy>(cursor).object);
+                break;
+            case TAG_TABLE:
+            {
+                cursor += sizeof(uint32_t);
+                uint32_t count = Read<uint32_t>(cursor);
+
+                for (uint32_t pair = 0; pair < count; pair++)
+                {
+                    ForEachObject(cursor, func);
+                    ForEachObject(cursor, func);
+                }
+
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+Variant::SharedTable::SharedTable(std::vector<uint8_t> && data, bool hasObjects) : data(std::move(data)),
+                                                                                  hasObjects(hasObjects)
+{
+    if (!this->hasObjects)
+        return;
+
+    const uint8_t * cursor = this->data.data();
+    ForEachObject(cursor, [](Object * object) { object->Retain(); });
+}
+
+Variant::SharedTable::~SharedTable()
+{
+    if (!this->hasObjects)
+        return;
+
+    const uint8_t * cursor = this->data.data();
+    ForEachObject(cursor, [](Object * object) { object->Release(); });
+}
+
 Proxy * Variant::TryExtractProxy(lua_State * L, size_t index)
 {
     Proxy * proxy = (Proxy *)lua_touserdata(L, index);
@@ -100,11 +419,6 @@ Variant & Variant::operator=(const Variant & v)
     return *this;
 }
 
-Variant::Variant(std::vector<std::pair<Variant, Variant>> * table)
-{
-    this->variant = new SharedTable(table);
-}
-
 Variant::Variant(const Variant & other) : variant(other.variant)
 {
     if (this->GetType() == Type::STRING)
@@ -115,8 +429,24 @@ Variant::Variant(const Variant & other) : variant(other.variant)
         this->GetValue<Type::TABLE>()->Retain();
 }
 
-Variant::Variant(Variant && other) : variant(std::move(other.variant))
-{}
+Variant::Variant(Variant && other) noexcept : variant(std::move(other.variant))
+{
+    other.variant = Nil();
+}
+
+Variant & Variant::operator=(Variant && other) noexcept
+{
+    if (this != &other)
+    {
+        /* whatever this held is released when @previous goes out of scope */
+        Variant previous(std::move(*this));
+
+        this->variant = std::move(other.variant);
+        other.variant = Nil();
+    }
+
+    return *this;
+}
 
 std::string Variant::GetTypeString() const
 {
@@ -147,7 +477,7 @@ Variant::Type Variant::GetType() const
     return retval;
 }
 
-Variant Variant::FromLua(lua_State * L, int n, std::set<const void *> * tableSet)
+Variant Variant::FromLua(lua_State * L, int n)
 {
     Proxy * proxy = nullptr;
     const char * string;
@@ -166,7 +496,7 @@ Variant Variant::FromLua(lua_State * L, int n, std::set<const void *> * tableSet
         case LUA_TBOOLEAN:
             return Variant((bool)lua_toboolean(L, n));
         case LUA_TNUMBER:
-            return Variant((float)lua_tonumber(L, n));
+            return Variant((double)lua_tonumber(L, n));
         case LUA_TLIGHTUSERDATA:
             return Variant(lua_touserdata(L, n));
         case LUA_TUSERDATA:
@@ -180,52 +510,28 @@ Variant Variant::FromLua(lua_State * L, int n, std::set<const void *> * tableSet
             }
         case LUA_TTABLE:
         {
-            bool success = true;
-            std::set<const void *> topTableSet;
-
-            std::vector<std::pair<Variant, Variant>> * table = new std::vector<std::pair<Variant, Variant>>();
-
-            // We can use a pointer to a stack-allocated variable because it's
-            // never used after the stack-allocated variable is destroyed.
-            if (tableSet == nullptr)
-                tableSet = &topTableSet;
-
-            // Check it's not already serialized
-            const void * tablePointer = lua_topointer(L, n);
+            Result result = RESULT_UNSUPPORTED;
 
+            /* Lua errors longjmp, so they're raised only once these are gone */
             {
-                auto result = tableSet->insert(tablePointer);
-                if (!result.second) // Insertion failure
-                    throw love::Exception("Cycle detected in table.");
-            }
+                std::vector<const void *> path;
+                bool hasObjects = false;
 
-            size_t length = lua_objlen(L, -1);
-            if (length > 0)
-                table->reserve(length);
+                /* Roughly enough for an array of numbers, so it's usually one allocation */
+                Writer writer(32 + lua_objlen(L, n) * 20);
 
-            lua_pushnil(L);
+                result = Encode(L, n, writer, path, hasObjects);
 
-            while (lua_next(L, n))
-            {
-                table->emplace_back(FromLua(L, -2, tableSet), FromLua(L, -1, tableSet));
-                lua_pop(L, 1);
-
-                const auto & p = table->back();
-
-                if (p.first.GetType() == Type::UNKNOWN || p.second.GetType() == Type::UNKNOWN)
-                {
-                    success = false;
-                    break;
-                }
+                if (result == RESULT_ENCODED)
+                    return Variant(new SharedTable(writer.Finish(), hasObjects));
             }
 
-            // remove the table from the set
-            tableSet->erase(tablePointer);
+            if (result == RESULT_FOREIGN_USERDATA)
+                luaL_argerror(L, n, "love type expected in table, got userdata");
+            else if (result == RESULT_TOO_DEEP)
+                luaL_argerror(L, n, "table too deeply nested");
 
-            if (success)
-                return Variant(table);
-            else
-                delete table;
+            break;
         }
         default:
             break;
@@ -240,7 +546,7 @@ void Variant::ToLua(lua_State * L) const
     SmallString smallStr;
     Proxy proxy;
     bool boolean;
-    float number;
+    double number;
     void * lightUserdata;
 
     switch (this->GetType())
@@ -271,20 +577,8 @@ void Variant::ToLua(lua_State * L) const
             break;
         case Type::TABLE:
         {
-            auto table = GetValue<Type::TABLE>()->table;
-            size_t size = table->size();
-
-            lua_createtable(L, 0, size);
-
-            for (size_t index = 0; index < size; ++index)
-            {
-                std::pair<Variant, Variant> & keyValue = (*table)[index];
-
-                keyValue.first.ToLua(L);
-                keyValue.second.ToLua(L);
-
-                lua_settable(L, -3);
-            }
+            const uint8_t * cursor = GetValue<Type::TABLE>()->data.data();
+            Decode(L, cursor);
 
             break;
         }
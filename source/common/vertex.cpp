@@ -0,0 +1,72 @@
+#include "common/vertex.h"
+
+using namespace love;
+
+void vertex::GeneratePrimitiveFromVectors(Vertex * out, const Vector2 * points, size_t count,
+                                          const Colorf * colors, size_t colorCount)
+{
+    Colorf currentColor = colors[0];
+
+    for (size_t currentVertex = 0; currentVertex < count; currentVertex++)
+    {
+        const Vector2 point = points[currentVertex];
+
+        if (currentVertex < colorCount)
+            currentColor = colors[currentVertex];
+
+        vertex::Vertex vert =
+        {
+            .position = {point.x, point.y},
+            .color = {0xFF, 0xFF, 0xFF, 0xFF},
+            .texcoord = {0, 0}
+        };
+
+        PackColor(currentColor, vert.color);
+
+        out[currentVertex] = vert;
+    }
+}
+
+static inline uint16_t normto16t(float in)
+{ return uint16_t(in * 0xFFFF); }
+
+void vertex::GenerateTextureFromVectors(Vertex * out, const love::Vector2 * points, const love::Vector2 * texcoord,
+                                        size_t count, const Colorf & color)
+{
+    uint8_t packed[4];
+    PackColor(color, packed);
+
+    for (size_t currentVertex = 0; currentVertex < count; currentVertex++)
+    {
+        const Vector2 point    = points[currentVertex];
+        const Vector2 texCoord = texcoord[currentVertex];
+
+        vertex::Vertex vert =
+        {
+            .position = {point.x, point.y},
+            .color = {packed[0], packed[1], packed[2], packed[3]},
+            .texcoord = {normto16t(texCoord.x), normto16t(texCoord.y)}
+        };
+
+        out[currentVertex] = vert;
+    }
+}
+
+void vertex::GenerateTextureFromGlyphs(Vertex * out, const vertex::GlyphVertex * data, size_t count)
+{
+    for (size_t currentVertex = 0; currentVertex < count; currentVertex++)
+    {
+        const GlyphVertex & glyph = data[currentVertex];
+
+        vertex::Vertex vert =
+        {
+            .position = {glyph.x, glyph.y},
+            .color = {0xFF, 0xFF, 0xFF, 0xFF},
+            .texcoord = {glyph.s, glyph.t}
+        };
+
+        PackColor(glyph.color, vert.color);
+
+        out[currentVertex] = vert;
+    }
+}
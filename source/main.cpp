@@ -104,7 +104,7 @@ DoneAction Run_Love_Potion(int argc, char ** argv, int & retval)
 
     #if defined (_3DS)
         while (Luax::Resume(L, 0) == LUA_YIELD && aptMainLoop())
-    #elif defined (__SWITCH__)
+    #elif defined (__SWITCH__) || defined (__HEADLESS__)
         while (Luax::Resume(L, 0) == LUA_YIELD)
     #endif
             lua_pop(L, lua_gettop(L) - stackpos);
@@ -1,6 +1,8 @@
 #include "common/luax.h"
 #include "modules/data/wrap_datamodule.h"
 
+#include <limits>
+
 using namespace love;
 
 #define instance() (Module::GetInstance<DataModule>(Module::M_DATA))
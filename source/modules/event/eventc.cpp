@@ -5,8 +5,12 @@
 
 using namespace love::driver;
 
-love::common::Event::Event()
+love::common::Event::Event() : queueHead(0),
+                                coalescing(false)
 {
+    this->queue.reserve(MessagePool::CAPACITY);
+    this->sources.reserve(MessagePool::CAPACITY);
+
     this->driver = std::make_unique<love::driver::Hidrv>();
 }
 
@@ -21,52 +25,163 @@ void love::common::Event::Pump()
 
     while (this->driver->Poll(&event))
     {
+        /* Merged events never take a message from the pool */
+        if (this->coalescing && this->Coalesce(event))
+            continue;
+
         Message * message = this->Convert(event);
 
-        if (message)
+        if (!message)
+            continue;
+
+        thread::Lock lock(this->mutex);
+
+        /* The reference from Convert goes to the queue */
+        this->queue.push_back(message);
+        this->sources.push_back({ event, true });
+    }
+}
+
+void love::common::Event::SetCoalescing(bool enable)
+{
+    this->coalescing = enable;
+}
+
+bool love::common::Event::IsCoalescing() const
+{
+    return this->coalescing;
+}
+
+namespace
+{
+    bool IsTouch(uint8_t type)
+    {
+        return type == Hidrv::TYPE_TOUCHPRESS || type == Hidrv::TYPE_TOUCHRELEASE ||
+               type == Hidrv::TYPE_TOUCHMOVED;
+    }
+
+    /* The gamepad @event came from, or -1 */
+    int64_t GamepadOf(const Hidrv::LOVE_Event & event)
+    {
+        switch (event.type)
         {
-            this->Push(message);
-            message->Release();
+            case Hidrv::TYPE_GAMEPADAXIS:
+                return (int64_t)event.axis.which;
+            case Hidrv::TYPE_GAMEPADDOWN:
+            case Hidrv::TYPE_GAMEPADUP:
+                return (int64_t)event.button.which;
+            case Hidrv::TYPE_GAMEPADADDED:
+            case Hidrv::TYPE_GAMEPADREMOVED:
+                return (int64_t)event.padStatus.which;
+            default:
+                return -1;
         }
     }
 }
 
-love::Message * love::common::Event::Convert(const Hidrv::LOVE_Event & event)
+/*
+** Fold @event into the newest queued message for the same touch or axis
+** Looks back from the tail, past other touches and gamepads, and gives up
+** at a press or release of that touch, any other event from that gamepad,
+** or a pushed message, so nothing moves across those
+** Moves keep the latest position and add up their deltas
+*/
+bool love::common::Event::Coalesce(const Hidrv::LOVE_Event & event)
 {
-    Message * message = nullptr;
+    bool touch = (event.type == Hidrv::TYPE_TOUCHMOVED);
 
-    std::vector<Variant> vargs;
-    vargs.reserve(4);
+    if (!touch && event.type != Hidrv::TYPE_GAMEPADAXIS)
+        return false;
 
-    const char * text = nullptr;
+    thread::Lock lock(this->mutex);
+
+    for (size_t index = this->queue.size(); index-- > this->queueHead;)
+    {
+        Source & source = this->sources[index];
+
+        if (!source.converted)
+            return false;
+
+        Hidrv::LOVE_Event & queued = source.event;
+        Message * message = this->queue[index];
+
+        if (touch)
+        {
+            if (!IsTouch(queued.type) || queued.touch.id != event.touch.id)
+                continue;
+
+            if (queued.type != Hidrv::TYPE_TOUCHMOVED)
+                return false;
+
+            queued.touch.x  = event.touch.x;
+            queued.touch.y  = event.touch.y;
+            queued.touch.dx += event.touch.dx;
+            queued.touch.dy += event.touch.dy;
+
+            queued.touch.pressure = event.touch.pressure;
+
+            message->SetArg(1, Variant(queued.touch.x));
+            message->SetArg(2, Variant(queued.touch.y));
+            message->SetArg(3, Variant(queued.touch.dx));
+            message->SetArg(4, Variant(queued.touch.dy));
+            message->SetArg(5, Variant(queued.touch.pressure));
+
+            this->UpdateTouches(event);
+
+            return true;
+        }
+
+        if (GamepadOf(queued) != (int64_t)event.axis.which)
+            continue;
+
+        if (queued.type != Hidrv::TYPE_GAMEPADAXIS)
+            return false;
+
+        if (queued.axis.number != event.axis.number)
+            continue;
+
+        queued.axis.value = event.axis.value;
+        message->SetArg(2, Variant(queued.axis.value));
+
+        return true;
+    }
+
+    return false;
+}
+
+/* Keep love.touch up to date, whether or not @event gets its own message */
+void love::common::Event::UpdateTouches(const Hidrv::LOVE_Event & event)
+{
+    Touch * touchModule = Module::GetInstance<Touch>(M_TOUCH);
+
+    if (!touchModule)
+        return;
 
-    Touch * touchModule = nullptr;
     Touch::TouchInfo touchinfo;
 
+    touchinfo.id       = (int64_t)event.touch.id;
+    touchinfo.x        = event.touch.x;
+    touchinfo.y        = event.touch.y;
+    touchinfo.dx       = event.touch.dx;
+    touchinfo.dy       = event.touch.dy;
+    touchinfo.pressure = event.touch.pressure;
+
+    touchModule->OnEvent(event.type, touchinfo);
+}
+
+love::Message * love::common::Event::Convert(const Hidrv::LOVE_Event & event)
+{
+    Message * message = nullptr;
+
+    const char * text = nullptr;
+
     switch (event.type)
     {
         case Hidrv::TYPE_TOUCHPRESS:
         case Hidrv::TYPE_TOUCHRELEASE:
         case Hidrv::TYPE_TOUCHMOVED:
         {
-            touchinfo.id = (int64_t)event.touch.id;
-            touchinfo.x = event.touch.x;
-            touchinfo.y = event.touch.y;
-            touchinfo.dx = event.touch.dx;
-            touchinfo.dy = event.touch.dy;
-            touchinfo.pressure = event.touch.pressure;
-
-            touchModule = (Touch *)Module::GetInstance<Touch>(M_TOUCH);
-
-            if (touchModule)
-                touchModule->OnEvent(event.type, touchinfo);
-
-            vargs.emplace_back((void *)(intptr_t)touchinfo.id);
-            vargs.emplace_back((float)touchinfo.x);
-            vargs.emplace_back((float)touchinfo.y);
-            vargs.emplace_back((float)touchinfo.dx);
-            vargs.emplace_back((float)touchinfo.dy);
-            vargs.emplace_back((float)touchinfo.pressure);
+            this->UpdateTouches(event);
 
             if (event.type == Hidrv::TYPE_TOUCHPRESS)
                 text = "touchpressed";
@@ -75,7 +190,14 @@ love::Message * love::common::Event::Convert(const Hidrv::LOVE_Event & event)
             else
                 text = "touchmoved";
 
-            message = new Message(text, vargs);
+            message = this->pool.Acquire(text);
+
+            message->AddArg(Variant((void *)(intptr_t)event.touch.id));
+            message->AddArg(Variant(event.touch.x));
+            message->AddArg(Variant(event.touch.y));
+            message->AddArg(Variant(event.touch.dx));
+            message->AddArg(Variant(event.touch.dy));
+            message->AddArg(Variant(event.touch.pressure));
 
             break;
         }
@@ -90,10 +212,10 @@ love::Message * love::common::Event::Convert(const Hidrv::LOVE_Event & event)
             message = this->ConvertWindowEvent(event);
             break;
         case Hidrv::TYPE_QUIT:
-            message = new Message("quit");
+            message = this->pool.Acquire("quit");
             break;
         case Hidrv::TYPE_LOWMEMORY:
-            message = new Message("lowmemory");
+            message = this->pool.Acquire("lowmemory");
             break;
         default:
             break;
@@ -102,7 +224,7 @@ love::Message * love::common::Event::Convert(const Hidrv::LOVE_Event & event)
     return message;
 }
 
-love::Message * love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Event & event) const
+love::Message * love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Event & event)
 {
     auto joyModule = Module::GetInstance<Joystick>(M_JOYSTICK);
 
@@ -111,9 +233,6 @@ love::Message * love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Even
 
     Message * message = nullptr;
 
-    std::vector<Variant> vargs;
-    vargs.reserve(4);
-
     love::Type * joystickType = &Gamepad::type;
 
     love::Gamepad * stick = nullptr;
@@ -139,10 +258,10 @@ love::Message * love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Even
             if (!stick)
                 break;
 
-            vargs.emplace_back(joystickType, stick);
-            vargs.emplace_back(text, strlen(text));
+            message = this->pool.Acquire((event.type == Hidrv::TYPE_GAMEPADDOWN) ? "gamepadpressed" : "gamepadreleased");
 
-            message = new Message((event.type == Hidrv::TYPE_GAMEPADDOWN) ? "gamepadpressed" : "gamepadreleased", vargs);
+            message->AddArg(Variant(joystickType, stick));
+            message->AddArg(Variant(text, strlen(text)));
 
             break;
         }
@@ -159,11 +278,11 @@ love::Message * love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Even
             if (!stick)
                 break;
 
-            vargs.emplace_back(joystickType, stick);
-            vargs.emplace_back(text, strlen(text));
-            vargs.emplace_back(event.axis.value);
+            message = this->pool.Acquire("gamepadaxis");
 
-            message = new Message("gamepadaxis", vargs);
+            message->AddArg(Variant(joystickType, stick));
+            message->AddArg(Variant(text, strlen(text)));
+            message->AddArg(Variant(event.axis.value));
 
             break;
         }
@@ -174,9 +293,8 @@ love::Message * love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Even
             if (!stick)
                 break;
 
-            vargs.emplace_back(joystickType, stick);
-
-            message = new Message("joystickadded", vargs);
+            message = this->pool.Acquire("joystickadded");
+            message->AddArg(Variant(joystickType, stick));
 
             break;
         }
@@ -188,9 +306,9 @@ love::Message * love::common::Event::ConvertJoystickEvent(const Hidrv::LOVE_Even
                 break;
 
             joyModule->RemoveGamepad(stick);
-            vargs.emplace_back(joystickType, stick);
 
-            message = new Message("joystickremoved", vargs);
+            message = this->pool.Acquire("joystickremoved");
+            message->AddArg(Variant(joystickType, stick));
 
             break;
         }
@@ -205,9 +323,6 @@ love::Message * love::common::Event::ConvertWindowEvent(const Hidrv::LOVE_Event
 {
     Message * message = nullptr;
 
-    std::vector<Variant> vargs;
-    vargs.reserve(4);
-
     Window * windowModule = nullptr;
 
     switch (event.subType)
@@ -215,9 +330,8 @@ love::Message * love::common::Event::ConvertWindowEvent(const Hidrv::LOVE_Event
         case Hidrv::TYPE_FOCUS_LOST:
         case Hidrv::TYPE_FOCUS_GAINED:
         {
-            vargs.emplace_back(event.type == Hidrv::TYPE_FOCUS_GAINED);
-
-            message = new Message("focus", vargs);
+            message = this->pool.Acquire("focus");
+            message->AddArg(Variant(event.type == Hidrv::TYPE_FOCUS_GAINED));
 
             break;
         }
@@ -228,10 +342,10 @@ love::Message * love::common::Event::ConvertWindowEvent(const Hidrv::LOVE_Event
             int width  = event.size.width;
             int height = event.size.width;
 
-            vargs.emplace_back((float)width);
-            vargs.emplace_back((float)height);
+            message = this->pool.Acquire("resize");
 
-            message = new Message("resize", vargs);
+            message->AddArg(Variant((float)width));
+            message->AddArg(Variant((float)height));
 
             if (windowModule)
                 windowModule->OnSizeChanged(width, height);
@@ -269,22 +383,30 @@ void love::common::Event::Clear()
 {
     thread::Lock lock(this->mutex);
 
-    while (!this->queue.empty())
-    {
-        this->queue.front()->Release();
-        this->queue.pop();
-    }
+    for (size_t index = this->queueHead; index < this->queue.size(); index++)
+        this->queue[index]->Release();
+
+    this->queue.clear();
+    this->sources.clear();
+    this->queueHead = 0;
 }
 
 bool love::common::Event::Poll(Message *& message)
 {
     thread::Lock lock(this->mutex);
 
-    if (this->queue.empty())
+    if (this->queueHead == this->queue.size())
         return false;
 
-    message = this->queue.front();
-    this->queue.pop();
+    message = this->queue[this->queueHead++];
+
+    /* Drained, start over at the front without giving up the storage */
+    if (this->queueHead == this->queue.size())
+    {
+        this->queue.clear();
+        this->sources.clear();
+        this->queueHead = 0;
+    }
 
     return true;
 };
@@ -294,7 +416,8 @@ void love::common::Event::Push(Message * message)
     thread::Lock lock(this->mutex);
 
     message->Retain();
-    this->queue.push(message);
+    this->queue.push_back(message);
+    this->sources.push_back({ {}, false });
 }
 
 love::Message * love::common::Event::Wait()
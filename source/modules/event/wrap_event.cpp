@@ -92,17 +92,35 @@ int Wrap_Event::Quit(lua_State * L)
     return 1;
 }
 
+int Wrap_Event::SetCoalescing(lua_State * L)
+{
+    bool enable = Luax::CheckBoolean(L, 1);
+
+    instance()->SetCoalescing(enable);
+
+    return 0;
+}
+
+int Wrap_Event::IsCoalescing(lua_State * L)
+{
+    lua_pushboolean(L, instance()->IsCoalescing());
+
+    return 1;
+}
+
 int Wrap_Event::Register(lua_State * L)
 {
     luaL_Reg reg[] =
     {
-        { "poll_i", Poll_I },
-        { "clear",  Clear  },
-        { "pump",   Pump   },
-        { "push",   Push   },
-        { "quit",   Quit   },
-        { "wait",   Wait   },
-        { 0,        0      }
+        { "poll_i",        Poll_I        },
+        { "clear",         Clear         },
+        { "isCoalescing",  IsCoalescing  },
+        { "pump",          Pump          },
+        { "push",          Push          },
+        { "quit",          Quit          },
+        { "setCoalescing", SetCoalescing },
+        { "wait",          Wait          },
+        { 0,               0             }
     };
 
     love::Event * instance = instance();
@@ -13,6 +13,7 @@
     #include <switch.h>
 #endif
 
+#include <algorithm>
 #include <filesystem>
 
 #define LOVE_APPDATA_FOLDER ""
@@ -264,6 +264,186 @@ Vector2 Graphics::InverseTransformPoint(Vector2 point)
 
 /* Objects */
 
+/* Primitives */
+
+void Graphics::Line(const Vector2 * points, int count)
+{
+    this->Polygon(DRAW_LINE, points, count);
+}
+
+void Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height)
+{
+    Vector2 points[5] =
+    {
+        { x, y,                 },
+        { x, y + height,        },
+        { x + width, y + height },
+        { x + width, y,         },
+        { x, y,                 }
+    };
+
+    this->Polygon(mode, points, 5);
+}
+
+void Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry)
+{
+    this->Rectangle(mode, x, y, width, height, rx, ry, this->CalculateEllipsePoints(rx, ry));
+}
+
+void Graphics::Rectangle(DrawMode mode, float x, float y, float width, float height, float rx, float ry, int points)
+{
+    if (rx == 0 || ry == 0)
+    {
+        this->Rectangle(mode, x, y, width, height);
+        return;
+    }
+
+    // Radius values that are more than half the rectangle's size aren't handled
+    // correctly (for now)...
+
+    if (width >= 0.02f)
+        rx = std::min(rx, width / 2.0f - 0.01f);
+    if (height >= 0.02f)
+        ry = std::min(ry, height / 2.0f - 0.01f);
+
+    points = std::max(points / 4, 1);
+
+    int num_coords = Tessellator::GetRoundedRectangleSize(points);
+    Vector2 * coords = this->tessellator.GetScratch(num_coords);
+
+    this->tessellator.RoundedRectangle(coords, x, y, width, height, rx, ry, points);
+
+    this->Polygon(mode, coords, num_coords);
+}
+
+void Graphics::Ellipse(DrawMode mode, float x, float y, float a, float b)
+{
+    this->Ellipse(mode, x, y, a, b, this->CalculateEllipsePoints(a, b));
+}
+
+void Graphics::Ellipse(DrawMode mode, float x, float y, float a, float b, int points)
+{
+    if (points <= 0)
+        points = 1;
+
+    // 1 extra point at the end for a closed loop, and 1 extra point at the
+    // start in filled mode for the vertex in the center of the ellipse.
+    int extrapoints = 1 + (mode == DRAW_FILL ? 1 : 0);
+
+    Vector2 * coords = this->tessellator.GetScratch(points + extrapoints);
+
+    if (mode == DRAW_FILL)
+    {
+        coords[0].x = x;
+        coords[0].y = y;
+    }
+
+    this->tessellator.Ellipse(coords + extrapoints - 1, x, y, a, b, points);
+
+    // Last argument to polygon(): don't skip the last vertex in fill mode.
+    this->Polygon(mode, coords, points + extrapoints, false);
+}
+
+void Graphics::Circle(DrawMode mode, float x, float y, float radius)
+{
+    this->Ellipse(mode, x, y, radius, radius);
+}
+
+void Graphics::Circle(DrawMode mode, float x, float y, float radius, int points)
+{
+    this->Ellipse(mode, x, y, radius, radius, points);
+}
+
+void Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2)
+{
+    float points = (float)this->CalculateEllipsePoints(radius, radius);
+
+    // The amount of points is based on the fraction of the circle created by the arc.
+    float angle = fabsf(angle1 - angle2);
+    if (angle < 2.0f * (float)M_PI)
+        points *= angle / (2.0f * (float)M_PI);
+
+    this->Arc(drawmode, arcmode, x, y, radius, angle1, angle2, (int)(points + 0.5f));
+}
+
+void Graphics::Arc(DrawMode drawmode, ArcMode arcmode, float x, float y, float radius, float angle1, float angle2, int points)
+{
+    /*
+    ** Nothing to display with no points or equal angles.
+    ** (Or is there with line mode?)
+    */
+    if (points <= 0 || angle1 == angle2)
+        return;
+
+    // Oh, you want to draw a circle?
+    if (fabs(angle1 - angle2) >= 2.0f * (float)M_PI)
+    {
+        this->Circle(drawmode, x, y, radius, points);
+        return;
+    }
+
+    float angle_shift = (angle2 - angle1) / points;
+
+    // Bail on precision issues.
+    if (angle_shift == 0.0f)
+        return;
+
+    /*
+    ** Prevent the connecting line from being drawn if a closed line arc has a
+    ** small angle. Avoids some visual issues when connected lines are at sharp
+    ** angles, due to the miter line join drawing code.
+    */
+    if (drawmode == DRAW_LINE && arcmode == ARC_CLOSED && fabsf(angle1 - angle2) < LOVE_TORAD(4))
+        arcmode = ARC_OPEN;
+
+    /*
+    ** Quick fix for the last part of a filled open arc not being drawn (because
+    ** polygon(DRAW_FILL, ...) doesn't work without a closed loop of vertices.)
+    */
+    if (drawmode == DRAW_FILL && arcmode == ARC_OPEN)
+        arcmode = ARC_CLOSED;
+
+    int num_coords = 0;
+    Vector2 * coords = nullptr;
+
+    if (arcmode == ARC_PIE)
+    {
+        num_coords = points + 3;
+        coords = this->tessellator.GetScratch(num_coords);
+
+        coords[0] = coords[num_coords - 1] = Vector2(x, y);
+
+        this->tessellator.Arc(coords + 1, x, y, radius, angle1, angle2, points);
+    }
+    else if (arcmode == ARC_OPEN)
+    {
+        num_coords = points + 1;
+        coords = this->tessellator.GetScratch(num_coords);
+
+        this->tessellator.Arc(coords, x, y, radius, angle1, angle2, points);
+    }
+    else // ARC_CLOSED
+    {
+        num_coords = points + 2;
+        coords = this->tessellator.GetScratch(num_coords);
+
+        this->tessellator.Arc(coords, x, y, radius, angle1, angle2, points);
+
+        // Connect the ends of the arc.
+        coords[num_coords - 1] = coords[0];
+    }
+
+    this->Polygon(drawmode, coords, num_coords);
+}
+
+int Graphics::CalculateEllipsePoints(float rx, float ry) const
+{
+    int points = (int) sqrtf(((rx + ry) / 2.0f) * 20.0f * (float)this->pixelScaleStack.back());
+    return std::max(points, 8);
+}
+
+/* End Primitives */
+
 Image * Graphics::NewImage(Data * data)
 {
     return new Image(data);
@@ -279,6 +459,35 @@ Text * Graphics::NewText(Font * font, const std::vector<Font::ColoredString> & t
     return new Text(font, text);
 }
 
+SpriteBatch * Graphics::NewSpriteBatch(Texture * texture, int size)
+{
+    return new SpriteBatch(texture, size);
+}
+
+ParticleSystem * Graphics::NewParticleSystem(Texture * texture, uint32_t size)
+{
+    return new ParticleSystem(texture, size);
+}
+
+#if defined(__SWITCH__)
+    Mesh * Graphics::NewMesh(const std::vector<Mesh::AttribFormat> & format, const std::vector<float> & data,
+                             size_t vertexCount, Mesh::DrawMode mode, Mesh::Usage usage)
+    {
+        return new Mesh(format, data, vertexCount, mode, usage);
+    }
+
+    Mesh * Graphics::NewMesh(const std::vector<Mesh::AttribFormat> & format, size_t vertexCount,
+                             Mesh::DrawMode mode, Mesh::Usage usage)
+    {
+        return new Mesh(format, vertexCount, mode, usage);
+    }
+
+    Atlas * Graphics::NewAtlas(int pageSize)
+    {
+        return new Atlas(pageSize);
+    }
+#endif
+
 Canvas * Graphics::NewCanvas(const Canvas::Settings & settings)
 {
     return new Canvas(settings);
@@ -56,7 +56,7 @@ int Wrap_Graphics::SetActiveScreen(lua_State * L)
             if (!love::citro2d::Graphics::GetConstant(name, screen))
                 return Luax::EnumError(L, "screen", love::citro2d::Graphics::GetConstants(screen), name);
         }
-    #elif defined(__SWITCH__)
+    #elif defined(__SWITCH__) || defined(__HEADLESS__)
             if (!Graphics::GetConstant(name, screen))
                 return Luax::EnumError(L, "screen", Graphics::GetConstants(screen), name);
     #endif
@@ -788,6 +788,114 @@ int Wrap_Graphics::NewText(lua_State * L)
     return 1;
 }
 
+int Wrap_Graphics::NewSpriteBatch(lua_State * L)
+{
+    Texture * texture = Wrap_Texture::CheckTexture(L, 1);
+    int size = (int)luaL_optinteger(L, 2, 1000);
+
+    SpriteBatch * batch = nullptr;
+
+    Luax::CatchException(L, [&]() {
+        batch = instance()->NewSpriteBatch(texture, size);
+    });
+
+    Luax::PushType(L, batch);
+    batch->Release();
+
+    return 1;
+}
+
+int Wrap_Graphics::NewParticleSystem(lua_State * L)
+{
+    Texture * texture = Wrap_Texture::CheckTexture(L, 1);
+    lua_Number size = luaL_optnumber(L, 2, 1000);
+
+    if (size < 1.0 || size > ParticleSystem::MAX_PARTICLES)
+        return luaL_error(L, "Invalid ParticleSystem size");
+
+    ParticleSystem * system = nullptr;
+
+    Luax::CatchException(L, [&]() {
+        system = instance()->NewParticleSystem(texture, (uint32_t)size);
+    });
+
+    Luax::PushType(L, system);
+    system->Release();
+
+    return 1;
+}
+
+#if defined (__SWITCH__)
+    /*
+    ** newMesh(vertices | count, [mode], [usage])
+    ** newMesh(format, vertices | count, [mode], [usage])
+    */
+    int Wrap_Graphics::NewMesh(lua_State * L)
+    {
+        int start = 1;
+        std::vector<Mesh::AttribFormat> format = Mesh::GetDefaultVertexFormat();
+
+        /* A custom format is a table of tables, so is a vertex list; tell them apart by the second argument */
+        if (lua_istable(L, 1) && (lua_istable(L, 2) || lua_isnumber(L, 2)))
+        {
+            format = Wrap_Mesh::CheckVertexFormat(L, 1);
+            start = 2;
+        }
+
+        Mesh::DrawMode mode = Mesh::DRAWMODE_FAN;
+        Mesh::Usage usage = Mesh::USAGE_DYNAMIC;
+
+        const char * modeName = lua_isnoneornil(L, start + 1) ? nullptr : luaL_checkstring(L, start + 1);
+        if (modeName != nullptr && !Mesh::GetConstant(modeName, mode))
+            return Luax::EnumError(L, "mesh draw mode", Mesh::GetConstants(mode), modeName);
+
+        const char * usageName = lua_isnoneornil(L, start + 2) ? nullptr : luaL_checkstring(L, start + 2);
+        if (usageName != nullptr && !Mesh::GetConstant(usageName, usage))
+            return Luax::EnumError(L, "usage hint", Mesh::GetConstants(usage), usageName);
+
+        Mesh * mesh = nullptr;
+
+        if (lua_isnumber(L, start))
+        {
+            size_t count = (size_t)luaL_checkinteger(L, start);
+
+            Luax::CatchException(L, [&]() {
+                mesh = instance()->NewMesh(format, count, mode, usage);
+            });
+        }
+        else
+        {
+            std::vector<float> data;
+            size_t count = Wrap_Mesh::CheckVertices(L, start, format, data);
+
+            Luax::CatchException(L, [&]() {
+                mesh = instance()->NewMesh(format, data, count, mode, usage);
+            });
+        }
+
+        Luax::PushType(L, mesh);
+        mesh->Release();
+
+        return 1;
+    }
+
+    int Wrap_Graphics::NewAtlas(lua_State * L)
+    {
+        int pageSize = (int)luaL_optinteger(L, 1, 1024);
+
+        Atlas * atlas = nullptr;
+
+        Luax::CatchException(L, [&]() {
+            atlas = instance()->NewAtlas(pageSize);
+        });
+
+        Luax::PushType(L, atlas);
+        atlas->Release();
+
+        return 1;
+    }
+#endif
+
 int Wrap_Graphics::NewCanvas(lua_State * L)
 {
     Canvas::Settings settings;
@@ -859,7 +967,7 @@ int Wrap_Graphics::NewFont(lua_State * L)
         Luax::CatchException(L, [&]() {
             font = instance()->NewFont(rasterizer, instance()->GetDefaultFilter());
         });
-    #elif defined (_3DS)
+    #elif defined (_3DS) || defined (__HEADLESS__)
         int size;
         if (lua_type(L, 1) == LUA_TNUMBER || lua_isnone(L, 1))
         {
@@ -1256,6 +1364,28 @@ int Wrap_Graphics::GetRendererInfo(lua_State * L)
     return 4;
 }
 
+/* Fills in the table given, if any, like LÖVE */
+int Wrap_Graphics::GetStats(lua_State * L)
+{
+    Graphics::Stats stats = instance()->GetStats();
+
+    if (lua_istable(L, 1))
+        lua_pushvalue(L, 1);
+    else
+        lua_createtable(L, 0, 3);
+
+    lua_pushinteger(L, stats.drawCalls);
+    lua_setfield(L, -2, "drawcalls");
+
+    lua_pushinteger(L, stats.drawCallsBatched);
+    lua_setfield(L, -2, "drawcallsbatched");
+
+    lua_pushinteger(L, stats.vertexOverflows);
+    lua_setfield(L, -2, "vertexoverflows");
+
+    return 1;
+}
+
 int Wrap_Graphics::Register(lua_State * L)
 {
     luaL_Reg funcs[] =
@@ -1278,6 +1408,7 @@ int Wrap_Graphics::Register(lua_State * L)
         { "getRendererInfo",         GetRendererInfo       },
         { "getScissor",              GetScissor            },
         { "getScreens",              GetScreens            },
+        { "getStats",                GetStats              },
         { "getWidth",                GetWidth              },
         { "instersectScissor",       IntersectScissor      },
         { "inverseTransformPoint",   InverseTransformPoint },
@@ -1285,6 +1416,12 @@ int Wrap_Graphics::Register(lua_State * L)
         { "newCanvas",               NewCanvas             },
         { "newFont",                 NewFont               },
         { "newImage",                NewImage              },
+        { "newParticleSystem",       NewParticleSystem     },
+        #if defined (__SWITCH__)
+            { "newAtlas",            NewAtlas              },
+            { "newMesh",             NewMesh               },
+        #endif
+        { "newSpriteBatch",          NewSpriteBatch        },
         { "newText",                 NewText               },
         { "newQuad",                 NewQuad               },
         { "origin",                  Origin                },
@@ -1342,8 +1479,12 @@ int Wrap_Graphics::Register(lua_State * L)
         Wrap_Quad::Register,
         Wrap_Canvas::Register,
         Wrap_Text::Register,
+        Wrap_SpriteBatch::Register,
+        Wrap_ParticleSystem::Register,
         #if defined (__SWITCH__)
             Wrap_Shader::Register,
+            Wrap_Mesh::Register,
+            Wrap_Atlas::Register,
         #endif
         0
     };
@@ -1359,6 +1500,10 @@ int Wrap_Graphics::Register(lua_State * L)
             Luax::CatchException(L, [&]() {
                 instance = new love::deko3d::Graphics();
             });
+        #elif defined (__HEADLESS__)
+            Luax::CatchException(L, [&]() {
+                instance = new love::recorder::Graphics();
+            });
         #endif
     else
         instance->Retain();
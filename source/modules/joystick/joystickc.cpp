@@ -1,11 +1,15 @@
 #include "modules/joystick/joystickc.h"
 
+#include <algorithm>
+
 using namespace love::common;
 
 #if defined (_3DS)
     static const size_t MAX_GAMEPADS = 1;
 #elif defined(__SWITCH__)
     static const size_t MAX_GAMEPADS = 4;
+#elif defined(__HEADLESS__)
+    static const size_t MAX_GAMEPADS = 0;
 #endif
 
 Joystick::Joystick()
@@ -3,7 +3,10 @@
 #include "common/version.h"
 #include "modules/love.h"
 
-#include "modules/audio/wrap_audio.h"
+#if !defined (__HEADLESS__)
+    #include "modules/audio/wrap_audio.h"
+#endif
+
 #include "modules/data/wrap_datamodule.h"
 #include "modules/event/wrap_event.h"
 #include "modules/filesystem/wrap_filesystem.h"
@@ -16,7 +19,11 @@
 #include "modules/joystick/wrap_joystick.h"
 #include "modules/keyboard/wrap_keyboard.h"
 #include "modules/math/wrap_mathmodule.h"
-#include "modules/sound/wrap_sound.h"
+
+#if !defined (__HEADLESS__)
+    #include "modules/sound/wrap_sound.h"
+#endif
+
 #include "modules/system/wrap_system.h"
 #include "modules/thread/wrap_threadmodule.h"
 #include "modules/timer/wrap_timer.h"
@@ -30,7 +37,9 @@
 
 static const luaL_Reg modules[] =
 {
-    { "love.audio",       Wrap_Audio::Register        },
+    #if !defined (__HEADLESS__)
+     { "love.audio",      Wrap_Audio::Register        },
+    #endif
     { "love.data",        Wrap_DataModule::Register   },
     { "love.event",       Wrap_Event::Register,       },
     { "love.graphics",    Wrap_Graphics::Register,    },
@@ -41,7 +50,9 @@ static const luaL_Reg modules[] =
     { "love.joystick",    Wrap_Joystick::Register,    },
     { "love.keyboard",    Wrap_Keyboard::Register     },
     { "love.math",        Wrap_Math::Register         },
-    { "love.sound",       Wrap_Sound::Register        },
+    #if !defined (__HEADLESS__)
+     { "love.sound",      Wrap_Sound::Register        },
+    #endif
     { "love.system",      Wrap_System::Register       },
     { "love.thread",      Wrap_ThreadModule::Register },
     { "love.timer",       Wrap_Timer::Register,       },
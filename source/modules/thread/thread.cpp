@@ -65,14 +65,16 @@ bool LOVE_Thread::Start()
     if (this->hasThread)
         LOVE_WaitThread(this->thread);
 
-    s32 priority = 0;
-    svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+    #if !defined (__HEADLESS__)
+        s32 priority = 0;
+        svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+    #endif
 
     #if defined (_3DS)
-        this->thread = threadCreate(Runner, this, 0x1000, priority - 1, 1, false);
+        this->thread = threadCreate(Runner, this, this->t->stackSize, priority - 1, 1, false);
         this->hasThread = (this->thread != NULL);
     #elif defined (__SWITCH__)
-        Result created = threadCreate(&this->thread, Runner, this, NULL, 0x1000, 0x3B, 0);
+        Result created = threadCreate(&this->thread, Runner, this, NULL, this->t->stackSize, 0x3B, 0);
 
         if (R_SUCCEEDED(created))
         {
@@ -81,6 +83,16 @@ bool LOVE_Thread::Start()
         }
         else
             throw love::Exception("Failed to spawn thread");
+    #elif defined (__HEADLESS__)
+        auto runner = [](void * data) -> void * {
+            Runner(data);
+            return nullptr;
+        };
+
+        if (pthread_create(&this->thread.handle, nullptr, runner, this) == 0)
+            this->hasThread = this->thread.joinable = true;
+        else
+            throw love::Exception("Failed to spawn thread");
     #endif
 
     this->running = this->hasThread;
@@ -13,6 +13,11 @@ Channel * ThreadModule::NewChannel()
     return new Channel();
 }
 
+Channel * ThreadModule::NewChannel(Channel::Mode mode, size_t capacity)
+{
+    return new Channel(mode, capacity);
+}
+
 Channel * ThreadModule::GetChannel(const std::string & name)
 {
     thread::Lock lock(this->namedChannelMutex);
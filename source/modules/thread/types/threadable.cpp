@@ -5,7 +5,7 @@ using namespace love;
 
 love::Type Threadable::type("Threadable", &Object::type);
 
-Threadable::Threadable()
+Threadable::Threadable() : stackSize(0x1000)
 {
     this->owner = newThread(this);
 }
@@ -53,9 +53,41 @@ int Wrap_ThreadModule::NewThread(lua_State * L)
     return 1;
 }
 
+/* Takes an optional table, { capacity = N, mode = "spsc" | "mpmc" }, for a lock-free Channel */
 int Wrap_ThreadModule::NewChannel(lua_State * L)
 {
-    Channel * channel = instance()->NewChannel();
+    Channel * channel = nullptr;
+
+    if (lua_istable(L, 1))
+    {
+        lua_getfield(L, 1, "capacity");
+        lua_Integer capacity = luaL_checkinteger(L, -1);
+        lua_pop(L, 1);
+
+        if (capacity <= 0)
+            return luaL_error(L, "Channel capacity must be greater than zero.");
+
+        Channel::Mode mode = Channel::MODE_MPMC;
+
+        lua_getfield(L, 1, "mode");
+
+        if (!lua_isnoneornil(L, -1))
+        {
+            const char * name = luaL_checkstring(L, -1);
+
+            if (!Channel::GetConstant(name, mode))
+                return Luax::EnumError(L, "channel mode", Channel::GetConstants(mode), name);
+        }
+
+        lua_pop(L, 1);
+
+        Luax::CatchException(L, [&]() {
+            channel = instance()->NewChannel(mode, (size_t)capacity);
+        });
+    }
+    else
+        channel = instance()->NewChannel();
+
     Luax::PushType(L, channel);
 
     channel->Release();
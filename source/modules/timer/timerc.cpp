@@ -10,6 +10,8 @@ static constexpr auto SLEEP_DURATION = 1000000ULL;
     #include <3ds.h>
 #elif defined (__SWITCH__)
     #include <switch.h>
+#elif defined (__HEADLESS__)
+    #include "headless.h"
 #endif
 
 uint64_t Timer::reference = 0;
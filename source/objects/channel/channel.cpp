@@ -2,14 +2,34 @@
 
 #include "modules/timer/timer.h"
 
+#include <algorithm>
+
 using namespace love;
 
 love::Type Channel::type("Channel", &Object::type);
 
 Channel::Channel() : sent(0),
-                     received(0)
+                     received(0),
+                     mode(MODE_LOCKED),
+                     producer(nullptr),
+                     consumer(nullptr)
 {}
 
+Channel::Channel(Mode mode, size_t capacity) : sent(0),
+                                               received(0),
+                                               mode(mode),
+                                               producer(nullptr),
+                                               consumer(nullptr)
+{
+    if (mode == MODE_LOCKED)
+        return;
+
+    if (capacity == 0)
+        throw love::Exception("Channel capacity must be greater than zero.");
+
+    this->ring = std::make_unique<BoundedQueue<Variant>>(capacity, mode == MODE_MPMC);
+}
+
 Channel::~Channel()
 {}
 
@@ -21,15 +41,197 @@ uint64_t Channel::_Push(const Variant & variant)
     return ++sent;
 }
 
+/* LOCK-FREE MODES */
+
+/*
+** Wait on @waiters for @attempt to succeed, for up to @timeout seconds,
+** or for good when it's negative; the count is raised before the last
+** try, so anything that changes the ring after it sees us and wakes us
+*/
+template <typename T>
+bool Channel::Park(Waiters & waiters, T attempt, double timeout)
+{
+    if (attempt())
+        return true;
+
+    /*
+    ** Give the other side a few turns first, it usually gets there within
+    ** one; a parked thread costs a wake-up for every value until it runs
+    */
+    for (int spin = 0; spin < PARK_SPINS && timeout != 0; spin++)
+    {
+        svcSleepThread(0);
+
+        if (attempt())
+            return true;
+    }
+
+    thread::Lock lock(this->mutex);
+
+    waiters.count.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool done = attempt();
+
+    while (!done && timeout != 0)
+    {
+        if (timeout < 0)
+            waiters.condition->Wait(this->mutex);
+        else
+        {
+            double start = love::Timer::GetTime();
+            waiters.condition->Wait(this->mutex, (s64)(timeout * 1000000000.0));
+            double stop  = love::Timer::GetTime();
+
+            timeout = std::max(timeout - (stop - start), 0.0);
+        }
+
+        done = attempt();
+    }
+
+    waiters.count.fetch_sub(1);
+
+    return done;
+}
+
+/*
+** Takes the lock only when someone is parked on @waiters, and
+** wakes one of them unless @all; a waiter that loses the race
+** for the value just parks again, so one wake per value is enough
+*/
+void Channel::Wake(Waiters & waiters, bool all)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (waiters.count.load(std::memory_order_relaxed) == 0)
+        return;
+
+    thread::Lock lock(this->mutex);
+
+    if (all)
+        waiters.condition->Broadcast();
+    else
+        waiters.condition->Signal();
+}
+
+void Channel::Pushed(bool many)
+{
+    this->Wake(this->notEmpty, many);
+}
+
+/* Supply waits on its own id, so all of those have to look */
+void Channel::Popped(bool many)
+{
+    this->Wake(this->notFull, many);
+    this->Wake(this->read, true);
+}
+
+/* Waits for room when full, 0 if @timeout ran out first */
+uint64_t Channel::RingPush(const Variant & variant, double timeout)
+{
+    uint64_t ticket = 0;
+
+    if (!this->Park(this->notFull, [&]() { return this->ring->TryPush(variant, ticket); }, timeout))
+        return 0;
+
+    this->Pushed(false);
+
+    return ticket + 1;
+}
+
+/* Doesn't wake anyone, it's used from Park with the lock held */
+bool Channel::RingPop(Variant * variant)
+{
+    if (!this->ring->TryPop(*variant))
+        return false;
+
+    this->received.fetch_add(1);
+
+    return true;
+}
+
+/*
+** SPSC rings move their positions without compare-and-swap, so each
+** side sticks to the first thread that uses it
+*/
+void Channel::Claim(std::atomic<const void *> & side, const char * action)
+{
+    if (this->mode != MODE_SPSC)
+        return;
+
+    static thread_local const char self = 0;
+    const void * owner = nullptr;
+
+    if (side.compare_exchange_strong(owner, &self) || owner == &self)
+        return;
+
+    throw love::Exception("Only one thread can %s an spsc Channel.", action);
+}
+
+/* END LOCK-FREE MODES */
+
 uint64_t Channel::Push(const Variant & variant)
 {
+    if (this->ring)
+    {
+        this->Claim(this->producer, "push to");
+        return this->RingPush(variant, -1.0);
+    }
+
     thread::Lock lock(this->mutex);
 
     return this->_Push(variant);
 }
 
+/* One lock and one wake-up for all of them */
+uint64_t Channel::Push(const Variant * variants, size_t count)
+{
+    if (count == 0)
+        return 0;
+
+    if (this->ring)
+    {
+        this->Claim(this->producer, "push to");
+        uint64_t ticket = 0;
+
+        for (size_t index = 0; index < count; index++)
+        {
+            const Variant & variant = variants[index];
+
+            if (this->ring->TryPush(variant, ticket))
+                continue;
+
+            /* Full, so whoever empties it has to hear about what's there so far */
+            this->Pushed(true);
+            this->Park(this->notFull, [&]() { return this->ring->TryPush(variant, ticket); }, -1.0);
+        }
+
+        this->Pushed(true);
+
+        return ticket + 1;
+    }
+
+    thread::Lock lock(this->mutex);
+
+    for (size_t index = 0; index < count; index++)
+        this->queue.push(variants[index]);
+
+    this->sent += count;
+    this->condition->Broadcast();
+
+    return this->sent;
+}
+
 bool Channel::Supply(const Variant & variant)
 {
+    if (this->ring)
+    {
+        this->Claim(this->producer, "push to");
+        uint64_t id = this->RingPush(variant, -1.0);
+
+        return this->Park(this->read, [&]() { return this->received.load() >= id; }, -1.0);
+    }
+
     thread::Lock lock(this->mutex);
     uint64_t id = this->_Push(variant);
 
@@ -43,6 +245,21 @@ bool Channel::Supply(const Variant & variant)
 
 bool Channel::Supply(const Variant & variant, double timeout)
 {
+    if (this->ring)
+    {
+        this->Claim(this->producer, "push to");
+
+        double start = love::Timer::GetTime();
+        uint64_t id = this->RingPush(variant, std::max(timeout, 0.0));
+
+        if (id == 0)
+            return false;
+
+        timeout = std::max(timeout - (love::Timer::GetTime() - start), 0.0);
+
+        return this->Park(this->read, [&]() { return this->received.load() >= id; }, timeout);
+    }
+
     thread::Lock lock(this->mutex);
     uint64_t id = this->_Push(variant);
 
@@ -63,11 +280,57 @@ bool Channel::Supply(const Variant & variant, double timeout)
 
 bool Channel::Pop(Variant * variant)
 {
+    if (this->ring)
+    {
+        this->Claim(this->consumer, "pop from");
+
+        if (!this->RingPop(variant))
+            return false;
+
+        this->Popped(false);
+
+        return true;
+    }
+
     thread::Lock lock(this->mutex);
 
     return this->_Pop(variant);
 }
 
+size_t Channel::Pop(Variant * variants, size_t max)
+{
+    size_t count = 0;
+
+    if (this->ring)
+    {
+        this->Claim(this->consumer, "pop from");
+
+        while (count < max && this->RingPop(&variants[count]))
+            count++;
+
+        if (count > 0)
+            this->Popped(true);
+
+        return count;
+    }
+
+    thread::Lock lock(this->mutex);
+
+    while (count < max && !this->queue.empty())
+    {
+        variants[count++] = this->queue.front();
+        this->queue.pop();
+    }
+
+    if (count > 0)
+    {
+        this->received += count;
+        this->condition->Broadcast();
+    }
+
+    return count;
+}
+
 bool Channel::_Pop(Variant * variant)
 {
     if (this->queue.empty())
@@ -84,6 +347,16 @@ bool Channel::_Pop(Variant * variant)
 
 bool Channel::Demand(Variant * variant)
 {
+    if (this->ring)
+    {
+        this->Claim(this->consumer, "pop from");
+
+        this->Park(this->notEmpty, [&]() { return this->RingPop(variant); }, -1.0);
+        this->Popped(false);
+
+        return true;
+    }
+
     thread::Lock lock(this->mutex);
 
     while (!this->_Pop(variant))
@@ -94,6 +367,18 @@ bool Channel::Demand(Variant * variant)
 
 bool Channel::Demand(Variant * variant, double timeout)
 {
+    if (this->ring)
+    {
+        this->Claim(this->consumer, "pop from");
+
+        if (!this->Park(this->notEmpty, [&]() { return this->RingPop(variant); }, std::max(timeout, 0.0)))
+            return false;
+
+        this->Popped(false);
+
+        return true;
+    }
+
     thread::Lock lock(this->mutex);
 
     while (timeout >= 0)
@@ -113,6 +398,9 @@ bool Channel::Demand(Variant * variant, double timeout)
 
 bool Channel::Peek(Variant * variant)
 {
+    if (this->ring)
+        throw love::Exception("Channel:peek is not available for lock-free Channels.");
+
     thread::Lock lock(this->mutex);
 
     if (this->queue.empty())
@@ -125,6 +413,9 @@ bool Channel::Peek(Variant * variant)
 
 int Channel::GetCount() const
 {
+    if (this->ring)
+        return (int)this->ring->GetSize();
+
     thread::Lock lock(this->mutex);
 
     return (int)this->queue.size();
@@ -132,6 +423,9 @@ int Channel::GetCount() const
 
 bool Channel::HasRead(uint64_t id) const
 {
+    if (this->ring)
+        return this->received.load() >= id;
+
     thread::Lock lock(this->mutex);
 
     return this->received >= id;
@@ -139,6 +433,18 @@ bool Channel::HasRead(uint64_t id) const
 
 void Channel::Clear()
 {
+    if (this->ring)
+    {
+        this->Claim(this->consumer, "pop from");
+
+        Variant discard;
+        while (this->RingPop(&discard));
+
+        this->Popped(true);
+
+        return;
+    }
+
     thread::Lock lock(this->mutex);
 
     if (this->queue.empty())
@@ -160,3 +466,36 @@ void Channel::UnlockMutex()
 {
     this->mutex->Unlock();
 }
+
+Channel::Mode Channel::GetMode() const
+{
+    return this->mode;
+}
+
+bool Channel::IsLockFree() const
+{
+    return this->ring != nullptr;
+}
+
+bool Channel::GetConstant(const char * in, Mode & out)
+{
+    return modes.Find(in, out);
+}
+
+bool Channel::GetConstant(Mode in, const char *& out)
+{
+    return modes.Find(in, out);
+}
+
+std::vector<std::string> Channel::GetConstants(Mode)
+{
+    return modes.GetNames();
+}
+
+StringMap<Channel::Mode, Channel::MODE_MAX_ENUM>::Entry Channel::modeEntries[] =
+{
+    { "spsc", MODE_SPSC },
+    { "mpmc", MODE_MPMC }
+};
+
+StringMap<Channel::Mode, Channel::MODE_MAX_ENUM> Channel::modes(Channel::modeEntries, sizeof(Channel::modeEntries));
@@ -21,6 +21,33 @@ int Wrap_Channel::Push(lua_State * L)
     return 1;
 }
 
+int Wrap_Channel::PushMany(lua_State * L)
+{
+    Channel * self = Wrap_Channel::CheckChannel(L, 1);
+    int count = lua_gettop(L) - 1;
+
+    std::vector<Variant> variants;
+    variants.reserve(count);
+
+    Luax::CatchException(L, [&]() {
+        for (int index = 2; index <= count + 1; index++)
+        {
+            Variant var = Variant::FromLua(L, index);
+
+            if (var.GetType() == Variant::UNKNOWN)
+                luaL_argerror(L, index, "boolean, number, string, love type, or table expected");
+
+            variants.push_back(std::move(var));
+        }
+
+        uint64_t id = self->Push(variants.data(), variants.size());
+
+        lua_pushnumber(L, (lua_Number)id);
+    });
+
+    return 1;
+}
+
 int Wrap_Channel::Supply(lua_State * L)
 {
     Channel * self = Wrap_Channel::CheckChannel(L, 1);
@@ -47,8 +74,13 @@ int Wrap_Channel::Pop(lua_State * L)
 {
     Channel * self = Wrap_Channel::CheckChannel(L, 1);
     Variant var;
+    bool result = false;
+
+    Luax::CatchException(L, [&]() {
+        result = self->Pop(&var);
+    });
 
-    if (self->Pop(&var))
+    if (result)
         var.ToLua(L);
     else
         lua_pushnil(L);
@@ -56,16 +88,61 @@ int Wrap_Channel::Pop(lua_State * L)
     return 1;
 }
 
+/* Up to @max values, as multiple returns or in a table when the second argument is true */
+int Wrap_Channel::PopMany(lua_State * L)
+{
+    Channel * self = Wrap_Channel::CheckChannel(L, 1);
+
+    lua_Integer max = luaL_checkinteger(L, 2);
+    bool asTable = lua_toboolean(L, 3);
+
+    if (max <= 0)
+        return luaL_error(L, "Invalid number of values to pop: %d", (int)max);
+
+    /* Anything pushed after this waits for the next call */
+    size_t available = std::min((size_t)max, (size_t)std::max(self->GetCount(), 0));
+
+    if (!asTable && !lua_checkstack(L, (int)available))
+        return luaL_error(L, "Too many values to return, pop them into a table instead.");
+
+    std::vector<Variant> variants(available);
+    size_t count = 0;
+
+    Luax::CatchException(L, [&]() {
+        count = self->Pop(variants.data(), variants.size());
+    });
+
+    if (asTable)
+    {
+        lua_createtable(L, (int)count, 0);
+
+        for (size_t index = 0; index < count; index++)
+        {
+            variants[index].ToLua(L);
+            lua_rawseti(L, -2, index + 1);
+        }
+
+        return 1;
+    }
+
+    for (size_t index = 0; index < count; index++)
+        variants[index].ToLua(L);
+
+    return (int)count;
+}
+
 int Wrap_Channel::Demand(lua_State * L)
 {
     Channel * self = Wrap_Channel::CheckChannel(L, 1);
     Variant var;
     bool result = false;
 
-    if (lua_isnumber(L, 2))
-        result = self->Demand(&var, lua_tonumber(L, 2));
-    else
-        result = self->Demand(&var);
+    Luax::CatchException(L, [&]() {
+        if (lua_isnumber(L, 2))
+            result = self->Demand(&var, lua_tonumber(L, 2));
+        else
+            result = self->Demand(&var);
+    });
 
     if (result)
         var.ToLua(L);
@@ -79,8 +156,13 @@ int Wrap_Channel::Peek(lua_State * L)
 {
     Channel * self = Wrap_Channel::CheckChannel(L, 1);
     Variant var;
+    bool result = false;
+
+    Luax::CatchException(L, [&]() {
+        result = self->Peek(&var);
+    });
 
-    if (self->Peek(&var))
+    if (result)
         var.ToLua(L);
     else
         lua_pushnil(L);
@@ -111,7 +193,9 @@ int Wrap_Channel::Clear(lua_State * L)
 {
     Channel * self = Wrap_Channel::CheckChannel(L, 1);
 
-    self->Clear();
+    Luax::CatchException(L, [&]() {
+        self->Clear();
+    });
 
     return 0;
 }
@@ -121,6 +205,9 @@ int love::Wrap_Channel_PerformAtomic(lua_State * L)
     Channel * self = Wrap_Channel::CheckChannel(L, 1);
     luaL_checktype(L, 2, LUA_TFUNCTION);
 
+    if (self->IsLockFree())
+        return luaL_error(L, "Channel:performAtomic is not available for lock-free Channels.");
+
     // Pass our channel to function arg
     lua_pushvalue(L, 1);
     lua_insert(L, 3);
@@ -149,8 +236,10 @@ int Wrap_Channel::Register(lua_State * L)
     luaL_Reg reg[] =
     {
         { "push",          Push                             },
+        { "pushMany",      PushMany                         },
         { "supply",        Supply                           },
         { "pop",           Pop                              },
+        { "popMany",       PopMany                          },
         { "demand",        Demand                           },
         { "peek",          Peek                             },
         { "getCount",      GetCount                         },
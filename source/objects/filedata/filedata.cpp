@@ -1,5 +1,7 @@
 #include "objects/filedata/filedata.h"
 
+#include <limits>
+
 using namespace love;
 
 love::Type FileData::type("FileData", &Data::type);
@@ -1,6 +1,6 @@
 #include "objects/font/fontc.h"
 
-#include "utf8/utf8.h"
+#include "common/utf8decode.h"
 
 using namespace love::common;
 
@@ -23,46 +23,73 @@ float Font::GetLineHeight() const
     return this->lineHeight;
 }
 
-int Font::GetWidth(const std::string & string)
+void Font::Preload(const std::vector<uint32_t> & /* codepoints */)
+{}
+
+void Font::SetAutoPreload(bool /* enable */)
+{}
+
+bool Font::GetAutoPreload() const
 {
-    if (string.size() == 0)
-        return 0;
+    return false;
+}
 
-    int maxWidth = 0;
+template <typename T>
+static inline void AppendBytes(std::string & out, const T & value)
+{
+    out.append((const char *)&value, sizeof(T));
+}
 
-    try
+void Font::GetLayoutKey(std::string & out, const std::vector<ColoredString> & text, const Colorf & color,
+                        bool formatted, float wrap, AlignMode align)
+{
+    out.clear();
+
+    AppendBytes(out, formatted);
+    AppendBytes(out, color);
+
+    if (formatted)
     {
-        utf8::iterator<std::string::const_iterator> i(string.begin(), string.begin(), string.end());
-        utf8::iterator<std::string::const_iterator> end(string.end(), string.begin(), string.end());
+        AppendBytes(out, wrap);
+        AppendBytes(out, align);
+    }
 
-        while (i != end)
-        {
-            uint32_t prevGlyph = 0;
-            int width = 0;
+    for (const ColoredString & piece : text)
+    {
+        AppendBytes(out, piece.color);
+        AppendBytes(out, piece.string.size());
 
-            for (; i != end && *i != '\n'; ++i)
-            {
-                uint32_t current = *i;
+        out.append(piece.string);
+    }
+}
 
-                if (current == '\r')
-                    continue;
+int Font::GetWidth(const std::string & string)
+{
+    int maxWidth = 0;
 
-                width += this->GetWidth(prevGlyph, current);
-                prevGlyph = current;
-            }
+    int width = 0;
+    uint32_t prevGlyph = 0;
 
+    UTF8::ForEach(string.data(), string.size(), [&](uint32_t current)
+    {
+        if (current == '\n')
+        {
             maxWidth = std::max(maxWidth, width);
 
-            if (i != end)
-                ++i;
+            width = 0;
+            prevGlyph = 0;
+
+            return;
         }
-    }
-    catch (utf8::exception & e)
-    {
-        throw love::Exception("UTF-8 decoding error: %s", e.what());
-    }
 
-    return maxWidth;
+        if (current == '\r')
+            return;
+
+        width += this->GetWidth(prevGlyph, current);
+        prevGlyph = current;
+    });
+
+    return std::max(maxWidth, width);
 }
 
 bool Font::GetConstant(const char * in, AlignMode & out)
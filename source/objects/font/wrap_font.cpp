@@ -2,6 +2,8 @@
 #include "objects/font/wrap_font.h"
 #include "modules/graphics/graphics.h"
 
+#include "common/utf8decode.h"
+
 using namespace love;
 
 int Wrap_Font::GetWidth(lua_State * L)
@@ -25,6 +27,68 @@ int Wrap_Font::GetHeight(lua_State * L)
     return 1;
 }
 
+/*
+** font:preload(text) or font:preload(first, last)
+** With no arguments it takes printable ASCII and Latin-1
+*/
+int Wrap_Font::Preload(lua_State * L)
+{
+    love::Font * self = Wrap_Font::CheckFont(L, 1);
+    std::vector<uint32_t> codepoints;
+
+    if (lua_isnoneornil(L, 2))
+    {
+        for (uint32_t codepoint = 32; codepoint < 256; codepoint++)
+        {
+            if (codepoint < 127 || codepoint >= 160)
+                codepoints.push_back(codepoint);
+        }
+    }
+    else if (lua_type(L, 2) == LUA_TSTRING)
+    {
+        size_t length = 0;
+        const char * text = lua_tolstring(L, 2, &length);
+
+        Luax::CatchException(L, [&]() {
+            UTF8::Decode(text, length, codepoints);
+        });
+    }
+    else
+    {
+        lua_Integer first = luaL_checkinteger(L, 2);
+        lua_Integer last  = luaL_checkinteger(L, 3);
+
+        luaL_argcheck(L, first >= 0 && first <= 0x10FFFF, 2, "invalid codepoint");
+        luaL_argcheck(L, last >= 0 && last <= 0x10FFFF, 3, "invalid codepoint");
+
+        for (uint32_t codepoint = first; codepoint <= (uint32_t)last; codepoint++)
+            codepoints.push_back(codepoint);
+    }
+
+    Luax::CatchException(L, [&]() { self->Preload(codepoints); });
+
+    return 0;
+}
+
+int Wrap_Font::SetAutoPreload(lua_State * L)
+{
+    love::Font * self = Wrap_Font::CheckFont(L, 1);
+    bool enable = Luax::CheckBoolean(L, 2);
+
+    self->SetAutoPreload(enable);
+
+    return 0;
+}
+
+int Wrap_Font::GetAutoPreload(lua_State * L)
+{
+    love::Font * self = Wrap_Font::CheckFont(L, 1);
+
+    lua_pushboolean(L, self->GetAutoPreload());
+
+    return 1;
+}
+
 Font * Wrap_Font::CheckFont(lua_State * L, int index)
 {
     return Luax::CheckType<Font>(L, index);
@@ -74,8 +138,11 @@ void Wrap_Font::CheckColoredString(lua_State * L, int index, std::vector<Font::C
 int Wrap_Font::Register(lua_State * L)
 {
     luaL_Reg reg[] = {
-        { "getHeight",     GetHeight },
-        { "getWidth",      GetWidth  },
+        { "getAutoPreload", GetAutoPreload },
+        { "getHeight",      GetHeight      },
+        { "getWidth",       GetWidth       },
+        { "preload",        Preload        },
+        { "setAutoPreload", SetAutoPreload },
         { 0, 0 }
     };
 
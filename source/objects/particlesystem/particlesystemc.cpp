@@ -0,0 +1,641 @@
+#include "objects/particlesystem/particlesystemc.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace love::common;
+
+love::Type ParticleSystem::type("ParticleSystem", &Drawable::type);
+
+/* Keep every field array 16-byte aligned for NEON/SSE loads */
+static uint32_t GetStride(uint32_t size)
+{
+    return (size + 3) & ~3U;
+}
+
+/* Normalized age, 0 at spawn and 1 at death */
+static float GetAge(float life, float lifetime)
+{
+    if (lifetime <= 0.0f)
+        return 1.0f;
+
+    return 1.0f - life / lifetime;
+}
+
+/*
+** Pick a value between @inner +/- (@outer / 2) * @variation
+** Used for the start and end spin of each particle
+*/
+static float CalculateVariation(love::RandomGenerator & rng, float inner, float outer, float variation)
+{
+    float low  = inner - (outer / 2.0f) * variation;
+    float high = inner + (outer / 2.0f) * variation;
+    float r    = (float)rng.Random();
+
+    return low * (1.0f - r) + high * r;
+}
+
+ParticleSystem::ParticleSystem(love::Texture * texture, uint32_t size) : texture(texture),
+                                                                         stride(0),
+                                                                         fields{},
+                                                                         bufferSize(0),
+                                                                         count(0),
+                                                                         offset(texture->GetWidth() * 0.5f, texture->GetHeight() * 0.5f),
+                                                                         active(true),
+                                                                         paused(false),
+                                                                         emissionRate(0.0f),
+                                                                         emitCounter(0.0f),
+                                                                         emitterLifetime(-1.0f),
+                                                                         life(0.0f),
+                                                                         particleLifeMin(0.0f),
+                                                                         particleLifeMax(0.0f),
+                                                                         direction(0.0f),
+                                                                         spread(0.0f),
+                                                                         speedMin(0.0f),
+                                                                         speedMax(0.0f),
+                                                                         radialAccelMin(0.0f),
+                                                                         radialAccelMax(0.0f),
+                                                                         tangentialAccelMin(0.0f),
+                                                                         tangentialAccelMax(0.0f),
+                                                                         dampingMin(0.0f),
+                                                                         dampingMax(0.0f),
+                                                                         sizes{ 1.0f },
+                                                                         sizeVariation(0.0f),
+                                                                         rotationMin(0.0f),
+                                                                         rotationMax(0.0f),
+                                                                         spinStart(0.0f),
+                                                                         spinEnd(0.0f),
+                                                                         spinVariation(0.0f),
+                                                                         relativeRotation(false),
+                                                                         colors{ Colorf(1.0f, 1.0f, 1.0f, 1.0f) }
+{
+    if (size == 0 || size > MAX_PARTICLES)
+        throw love::Exception("Invalid ParticleSystem size.");
+
+    this->SetBufferSize(size);
+}
+
+ParticleSystem::~ParticleSystem()
+{}
+
+void ParticleSystem::SetTexture(love::Texture * texture)
+{
+    this->texture.Set(texture);
+}
+
+love::Texture * ParticleSystem::GetTexture() const
+{
+    return this->texture.Get();
+}
+
+/*
+** Each field moves to its new offset, so live
+** particles survive the resize (up to @size of them)
+*/
+void ParticleSystem::SetBufferSize(uint32_t size)
+{
+    if (size == 0 || size > MAX_PARTICLES)
+        throw love::Exception("Invalid buffer size.");
+
+    uint32_t stride = GetStride(size);
+    std::vector<float> storage(stride * FIELD_MAX_ENUM);
+
+    uint32_t count = std::min(this->count, size);
+
+    for (size_t field = 0; field < FIELD_MAX_ENUM && count > 0; field++)
+    {
+        const float * from = this->GetField(Field(field));
+        memcpy(storage.data() + field * stride, from, count * sizeof(float));
+    }
+
+    this->storage.swap(storage);
+
+    for (size_t field = 0; field < FIELD_MAX_ENUM; field++)
+        this->fields[field] = this->storage.data() + field * stride;
+
+    this->stride = stride;
+    this->bufferSize = size;
+    this->count = count;
+}
+
+uint32_t ParticleSystem::GetBufferSize() const
+{
+    return this->bufferSize;
+}
+
+void ParticleSystem::SetEmissionRate(float rate)
+{
+    if (rate < 0.0f)
+        throw love::Exception("Invalid emission rate");
+
+    this->emissionRate = rate;
+
+    /* Prevent an explosion when dramatically increasing the rate */
+    this->emitCounter = std::min(this->emitCounter, 1.0f / rate);
+}
+
+float ParticleSystem::GetEmissionRate() const
+{
+    return this->emissionRate;
+}
+
+void ParticleSystem::SetEmitterLifetime(float lifetime)
+{
+    this->life = this->emitterLifetime = lifetime;
+}
+
+float ParticleSystem::GetEmitterLifetime() const
+{
+    return this->emitterLifetime;
+}
+
+void ParticleSystem::SetParticleLifetime(float min, float max)
+{
+    this->particleLifeMin = min;
+    this->particleLifeMax = max;
+}
+
+void ParticleSystem::GetParticleLifetime(float & min, float & max) const
+{
+    min = this->particleLifeMin;
+    max = this->particleLifeMax;
+}
+
+void ParticleSystem::SetPosition(float x, float y)
+{
+    this->position = Vector2(x, y);
+    this->prevPosition = this->position;
+}
+
+const love::Vector2 & ParticleSystem::GetPosition() const
+{
+    return this->position;
+}
+
+void ParticleSystem::MoveTo(float x, float y)
+{
+    this->position = Vector2(x, y);
+}
+
+void ParticleSystem::SetDirection(float direction)
+{
+    this->direction = direction;
+}
+
+float ParticleSystem::GetDirection() const
+{
+    return this->direction;
+}
+
+void ParticleSystem::SetSpread(float spread)
+{
+    this->spread = spread;
+}
+
+float ParticleSystem::GetSpread() const
+{
+    return this->spread;
+}
+
+void ParticleSystem::SetSpeed(float min, float max)
+{
+    this->speedMin = min;
+    this->speedMax = max;
+}
+
+void ParticleSystem::GetSpeed(float & min, float & max) const
+{
+    min = this->speedMin;
+    max = this->speedMax;
+}
+
+void ParticleSystem::SetLinearAcceleration(float xmin, float ymin, float xmax, float ymax)
+{
+    this->linearAccelMin = Vector2(xmin, ymin);
+    this->linearAccelMax = Vector2(xmax, ymax);
+}
+
+void ParticleSystem::GetLinearAcceleration(Vector2 & min, Vector2 & max) const
+{
+    min = this->linearAccelMin;
+    max = this->linearAccelMax;
+}
+
+void ParticleSystem::SetRadialAcceleration(float min, float max)
+{
+    this->radialAccelMin = min;
+    this->radialAccelMax = max;
+}
+
+void ParticleSystem::GetRadialAcceleration(float & min, float & max) const
+{
+    min = this->radialAccelMin;
+    max = this->radialAccelMax;
+}
+
+void ParticleSystem::SetTangentialAcceleration(float min, float max)
+{
+    this->tangentialAccelMin = min;
+    this->tangentialAccelMax = max;
+}
+
+void ParticleSystem::GetTangentialAcceleration(float & min, float & max) const
+{
+    min = this->tangentialAccelMin;
+    max = this->tangentialAccelMax;
+}
+
+void ParticleSystem::SetLinearDamping(float min, float max)
+{
+    this->dampingMin = min;
+    this->dampingMax = max;
+}
+
+void ParticleSystem::GetLinearDamping(float & min, float & max) const
+{
+    min = this->dampingMin;
+    max = this->dampingMax;
+}
+
+void ParticleSystem::SetSizes(const std::vector<float> & sizes)
+{
+    if (sizes.empty() || sizes.size() > MAX_GRADIENT)
+        throw love::Exception("At most %zu sizes may be used.", MAX_GRADIENT);
+
+    this->sizes = sizes;
+}
+
+const std::vector<float> & ParticleSystem::GetSizes() const
+{
+    return this->sizes;
+}
+
+void ParticleSystem::SetSizeVariation(float variation)
+{
+    this->sizeVariation = variation;
+}
+
+float ParticleSystem::GetSizeVariation() const
+{
+    return this->sizeVariation;
+}
+
+void ParticleSystem::SetRotation(float min, float max)
+{
+    this->rotationMin = min;
+    this->rotationMax = max;
+}
+
+void ParticleSystem::GetRotation(float & min, float & max) const
+{
+    min = this->rotationMin;
+    max = this->rotationMax;
+}
+
+void ParticleSystem::SetSpin(float start, float end)
+{
+    this->spinStart = start;
+    this->spinEnd = end;
+}
+
+void ParticleSystem::GetSpin(float & start, float & end) const
+{
+    start = this->spinStart;
+    end = this->spinEnd;
+}
+
+void ParticleSystem::SetSpinVariation(float variation)
+{
+    this->spinVariation = variation;
+}
+
+float ParticleSystem::GetSpinVariation() const
+{
+    return this->spinVariation;
+}
+
+void ParticleSystem::SetRelativeRotation(bool enable)
+{
+    this->relativeRotation = enable;
+}
+
+bool ParticleSystem::HasRelativeRotation() const
+{
+    return this->relativeRotation;
+}
+
+void ParticleSystem::SetOffset(float x, float y)
+{
+    this->offset = Vector2(x, y);
+}
+
+const love::Vector2 & ParticleSystem::GetOffset() const
+{
+    return this->offset;
+}
+
+void ParticleSystem::SetColors(const std::vector<Colorf> & colors)
+{
+    if (colors.empty() || colors.size() > MAX_GRADIENT)
+        throw love::Exception("At most %zu colors may be used.", MAX_GRADIENT);
+
+    this->colors = colors;
+}
+
+const std::vector<Colorf> & ParticleSystem::GetColors() const
+{
+    return this->colors;
+}
+
+uint32_t ParticleSystem::GetCount() const
+{
+    return this->count;
+}
+
+void ParticleSystem::Start()
+{
+    this->active = true;
+    this->paused = false;
+}
+
+void ParticleSystem::Stop()
+{
+    this->active = false;
+    this->paused = false;
+
+    this->life = this->emitterLifetime;
+    this->emitCounter = 0.0f;
+}
+
+void ParticleSystem::Pause()
+{
+    if (this->active)
+        this->paused = true;
+}
+
+void ParticleSystem::Reset()
+{
+    this->count = 0;
+
+    this->life = this->emitterLifetime;
+    this->emitCounter = 0.0f;
+}
+
+void ParticleSystem::Emit(uint32_t count)
+{
+    if (!this->active)
+        return;
+
+    count = std::min(count, this->bufferSize - this->count);
+
+    for (uint32_t index = 0; index < count; index++)
+        this->AddParticle(1.0f);
+}
+
+bool ParticleSystem::IsActive() const
+{
+    return this->active && !this->paused;
+}
+
+bool ParticleSystem::IsPaused() const
+{
+    return this->paused;
+}
+
+bool ParticleSystem::IsStopped() const
+{
+    return !this->active && !this->paused;
+}
+
+bool ParticleSystem::IsEmpty() const
+{
+    return this->count == 0;
+}
+
+bool ParticleSystem::IsFull() const
+{
+    return this->count == this->bufferSize;
+}
+
+/*
+** @t is how far along the emitter's movement
+** this frame the particle was spawned
+*/
+void ParticleSystem::AddParticle(float t)
+{
+    if (this->count >= this->bufferSize)
+        return;
+
+    uint32_t index = this->count++;
+
+    float lifetime = this->particleLifeMin;
+    if (this->particleLifeMin != this->particleLifeMax)
+        lifetime = (float)this->rng.Random(this->particleLifeMin, this->particleLifeMax);
+
+    float x = this->prevPosition.x + (this->position.x - this->prevPosition.x) * t;
+    float y = this->prevPosition.y + (this->position.y - this->prevPosition.y) * t;
+
+    float direction = this->direction + (float)this->rng.Random(-this->spread * 0.5f, this->spread * 0.5f);
+    float speed = (float)this->rng.Random(this->speedMin, this->speedMax);
+
+    float sizeOffset = (float)this->rng.Random(this->sizeVariation);
+    float sizeInterval = (1.0f - (float)this->rng.Random(this->sizeVariation)) - sizeOffset;
+
+    const float values[FIELD_MAX_ENUM] =
+    {
+        x,
+        y,
+        x,
+        y,
+        cosf(direction) * speed,
+        sinf(direction) * speed,
+        (float)this->rng.Random(this->linearAccelMin.x, this->linearAccelMax.x),
+        (float)this->rng.Random(this->linearAccelMin.y, this->linearAccelMax.y),
+        (float)this->rng.Random(this->radialAccelMin, this->radialAccelMax),
+        (float)this->rng.Random(this->tangentialAccelMin, this->tangentialAccelMax),
+        (float)this->rng.Random(this->dampingMin, this->dampingMax),
+        lifetime,
+        lifetime,
+        (float)this->rng.Random(this->rotationMin, this->rotationMax),
+        CalculateVariation(this->rng, this->spinStart, this->spinEnd, this->spinVariation),
+        CalculateVariation(this->rng, this->spinEnd, this->spinStart, this->spinVariation),
+        sizeOffset,
+        sizeInterval
+    };
+
+    for (size_t field = 0; field < FIELD_MAX_ENUM; field++)
+        this->GetField(Field(field))[index] = values[field];
+}
+
+/*
+** Every particle gets the same arithmetic with no branches.
+** The arrays are restrict parameters rather than locals,
+** which is what lets GCC drop its alias checks and emit SIMD.
+** sqrtf only vectorizes once errno is off (-fno-math-errno).
+*/
+static void IntegrateMotion(uint32_t count, float dt, float * __restrict x, float * __restrict y,
+                            float * __restrict vx, float * __restrict vy,
+                            const float * __restrict originX, const float * __restrict originY,
+                            const float * __restrict accelX, const float * __restrict accelY,
+                            const float * __restrict radial, const float * __restrict tangential,
+                            const float * __restrict damping)
+{
+    for (uint32_t index = 0; index < count; index++)
+    {
+        float dx = x[index] - originX[index];
+        float dy = y[index] - originY[index];
+
+        /* A particle sitting on its origin has dx = dy = 0, so the epsilon never shows */
+        float inverse = 1.0f / sqrtf(dx * dx + dy * dy + 1e-12f);
+
+        float rx = dx * inverse;
+        float ry = dy * inverse;
+
+        float ax = accelX[index] + rx * radial[index] - ry * tangential[index];
+        float ay = accelY[index] + ry * radial[index] + rx * tangential[index];
+
+        float drag = 1.0f / (1.0f + damping[index] * dt);
+
+        float velocityX = (vx[index] + ax * dt) * drag;
+        float velocityY = (vy[index] + ay * dt) * drag;
+
+        vx[index] = velocityX;
+        vy[index] = velocityY;
+
+        x[index] += velocityX * dt;
+        y[index] += velocityY * dt;
+    }
+}
+
+static void IntegrateAge(uint32_t count, float dt, float * __restrict life, float * __restrict rotation,
+                         const float * __restrict lifetime, const float * __restrict spinStart,
+                         const float * __restrict spinEnd)
+{
+    for (uint32_t index = 0; index < count; index++)
+    {
+        float remaining = life[index] - dt;
+        life[index] = remaining;
+
+        float t = 1.0f - remaining / lifetime[index];
+        rotation[index] += (spinStart[index] * (1.0f - t) + spinEnd[index] * t) * dt;
+    }
+}
+
+void ParticleSystem::Integrate(float dt)
+{
+    IntegrateMotion(this->count, dt, this->GetField(FIELD_X), this->GetField(FIELD_Y),
+                    this->GetField(FIELD_VELOCITY_X), this->GetField(FIELD_VELOCITY_Y),
+                    this->GetField(FIELD_ORIGIN_X), this->GetField(FIELD_ORIGIN_Y),
+                    this->GetField(FIELD_LINEAR_ACCEL_X), this->GetField(FIELD_LINEAR_ACCEL_Y),
+                    this->GetField(FIELD_RADIAL_ACCEL), this->GetField(FIELD_TANGENTIAL_ACCEL),
+                    this->GetField(FIELD_DAMPING));
+
+    IntegrateAge(this->count, dt, this->GetField(FIELD_LIFE), this->GetField(FIELD_ROTATION),
+                 this->GetField(FIELD_LIFETIME), this->GetField(FIELD_SPIN_START),
+                 this->GetField(FIELD_SPIN_END));
+}
+
+/* Swap dead particles with the last live one, one field at a time */
+void ParticleSystem::RemoveDead()
+{
+    float * life = this->GetField(FIELD_LIFE);
+    uint32_t index = 0;
+
+    while (index < this->count)
+    {
+        if (life[index] > 0.0f)
+        {
+            index++;
+            continue;
+        }
+
+        uint32_t last = --this->count;
+
+        if (index == last)
+            break;
+
+        for (size_t field = 0; field < FIELD_MAX_ENUM; field++)
+        {
+            float * values = this->GetField(Field(field));
+            values[index] = values[last];
+        }
+    }
+}
+
+void ParticleSystem::Update(float dt)
+{
+    if (dt == 0.0f || this->paused)
+        return;
+
+    this->Integrate(dt);
+    this->RemoveDead();
+
+    if (this->active)
+    {
+        if (this->emissionRate > 0.0f)
+        {
+            float rate = 1.0f / this->emissionRate;
+            this->emitCounter += dt;
+
+            float total = this->emitCounter - rate;
+
+            while (this->emitCounter > rate)
+            {
+                this->AddParticle(1.0f - (this->emitCounter - rate) / total);
+                this->emitCounter -= rate;
+            }
+        }
+
+        this->life -= dt;
+
+        if (this->emitterLifetime != -1.0f && this->life < 0.0f)
+            this->Stop();
+    }
+
+    this->prevPosition = this->position;
+}
+
+float ParticleSystem::GetParticleAngle(uint32_t index) const
+{
+    float angle = this->GetField(FIELD_ROTATION)[index];
+
+    if (this->relativeRotation)
+        angle += atan2f(this->GetField(FIELD_VELOCITY_Y)[index], this->GetField(FIELD_VELOCITY_X)[index]);
+
+    return angle;
+}
+
+float ParticleSystem::GetParticleSize(uint32_t index) const
+{
+    if (this->sizes.size() == 1)
+        return this->sizes[0];
+
+    float t = GetAge(this->GetField(FIELD_LIFE)[index], this->GetField(FIELD_LIFETIME)[index]);
+
+    float s = (this->GetField(FIELD_SIZE_OFFSET)[index] + t * this->GetField(FIELD_SIZE_INTERVAL)[index]);
+    s = std::clamp(s, 0.0f, 1.0f) * (this->sizes.size() - 1);
+
+    size_t k = std::min((size_t)s, this->sizes.size() - 2);
+    s -= k;
+
+    return this->sizes[k] * (1.0f - s) + this->sizes[k + 1] * s;
+}
+
+Colorf ParticleSystem::GetParticleColor(uint32_t index) const
+{
+    if (this->colors.size() == 1)
+        return this->colors[0];
+
+    float t = GetAge(this->GetField(FIELD_LIFE)[index], this->GetField(FIELD_LIFETIME)[index]);
+
+    float s = std::clamp(t, 0.0f, 1.0f) * (this->colors.size() - 1);
+
+    size_t k = std::min((size_t)s, this->colors.size() - 2);
+    s -= k;
+
+    const Colorf & from = this->colors[k];
+    const Colorf & to   = this->colors[k + 1];
+
+    return Colorf(from.r * (1.0f - s) + to.r * s, from.g * (1.0f - s) + to.g * s,
+                  from.b * (1.0f - s) + to.b * s, from.a * (1.0f - s) + to.a * s);
+}
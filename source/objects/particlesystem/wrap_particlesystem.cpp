@@ -0,0 +1,749 @@
+#include "common/luax.h"
+#include "objects/particlesystem/wrap_particlesystem.h"
+
+using namespace love;
+
+int Wrap_ParticleSystem::SetTexture(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    Texture * texture = Wrap_Texture::CheckTexture(L, 2);
+
+    self->SetTexture(texture);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetTexture(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    Texture * texture = self->GetTexture();
+
+    Luax::PushType(L, texture);
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetBufferSize(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    lua_Number size = luaL_checknumber(L, 2);
+
+    if (size < 1.0 || size > ParticleSystem::MAX_PARTICLES)
+        return luaL_error(L, "Invalid buffer size");
+
+    Luax::CatchException(L, [&]() {
+        self->SetBufferSize((uint32_t)size);
+    });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetBufferSize(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushinteger(L, self->GetBufferSize());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetEmissionRate(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    float rate = luaL_checknumber(L, 2);
+
+    Luax::CatchException(L, [&]() {
+        self->SetEmissionRate(rate);
+    });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetEmissionRate(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetEmissionRate());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetEmitterLifetime(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetEmitterLifetime(luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetEmitterLifetime(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetEmitterLifetime());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetParticleLifetime(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = luaL_checknumber(L, 2);
+    float max = luaL_optnumber(L, 3, min);
+
+    if (min < 0.0f || max < 0.0f)
+        return luaL_error(L, "Invalid particle lifetime (min = %f, max = %f)", min, max);
+
+    self->SetParticleLifetime(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetParticleLifetime(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetParticleLifetime(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetPosition(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float x = luaL_checknumber(L, 2);
+    float y = luaL_checknumber(L, 3);
+
+    self->SetPosition(x, y);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetPosition(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    const Vector2 & position = self->GetPosition();
+
+    lua_pushnumber(L, position.x);
+    lua_pushnumber(L, position.y);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::MoveTo(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float x = luaL_checknumber(L, 2);
+    float y = luaL_checknumber(L, 3);
+
+    self->MoveTo(x, y);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::SetDirection(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetDirection(luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetDirection(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetDirection());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetSpread(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetSpread(luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpread(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetSpread());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetSpeed(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = luaL_checknumber(L, 2);
+    float max = luaL_optnumber(L, 3, min);
+
+    self->SetSpeed(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpeed(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetSpeed(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetLinearAcceleration(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float xmin = luaL_checknumber(L, 2);
+    float ymin = luaL_optnumber(L, 3, 0.0f);
+    float xmax = luaL_optnumber(L, 4, xmin);
+    float ymax = luaL_optnumber(L, 5, ymin);
+
+    self->SetLinearAcceleration(xmin, ymin, xmax, ymax);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetLinearAcceleration(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    Vector2 min, max;
+    self->GetLinearAcceleration(min, max);
+
+    lua_pushnumber(L, min.x);
+    lua_pushnumber(L, min.y);
+    lua_pushnumber(L, max.x);
+    lua_pushnumber(L, max.y);
+
+    return 4;
+}
+
+int Wrap_ParticleSystem::SetRadialAcceleration(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = luaL_checknumber(L, 2);
+    float max = luaL_optnumber(L, 3, min);
+
+    self->SetRadialAcceleration(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetRadialAcceleration(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetRadialAcceleration(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetTangentialAcceleration(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = luaL_checknumber(L, 2);
+    float max = luaL_optnumber(L, 3, min);
+
+    self->SetTangentialAcceleration(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetTangentialAcceleration(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetTangentialAcceleration(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetLinearDamping(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = luaL_checknumber(L, 2);
+    float max = luaL_optnumber(L, 3, min);
+
+    self->SetLinearDamping(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetLinearDamping(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetLinearDamping(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetSizes(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    size_t count = lua_gettop(L) - 1;
+
+    if (count > ParticleSystem::MAX_GRADIENT)
+        return luaL_error(L, "At most %d sizes may be used.", (int)ParticleSystem::MAX_GRADIENT);
+
+    std::vector<float> sizes(count);
+
+    for (size_t index = 0; index < count; index++)
+        sizes[index] = luaL_checknumber(L, index + 2);
+
+    Luax::CatchException(L, [&]() {
+        self->SetSizes(sizes);
+    });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSizes(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    const std::vector<float> & sizes = self->GetSizes();
+
+    for (float size : sizes)
+        lua_pushnumber(L, size);
+
+    return sizes.size();
+}
+
+int Wrap_ParticleSystem::SetSizeVariation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    float variation = luaL_checknumber(L, 2);
+
+    if (variation < 0.0f || variation > 1.0f)
+        return luaL_error(L, "Size variation has to be between 0 and 1, inclusive.");
+
+    self->SetSizeVariation(variation);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSizeVariation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetSizeVariation());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetRotation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = luaL_checknumber(L, 2);
+    float max = luaL_optnumber(L, 3, min);
+
+    self->SetRotation(min, max);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetRotation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float min = 0.0f, max = 0.0f;
+    self->GetRotation(min, max);
+
+    lua_pushnumber(L, min);
+    lua_pushnumber(L, max);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetSpin(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float start = luaL_checknumber(L, 2);
+    float end = luaL_optnumber(L, 3, start);
+
+    self->SetSpin(start, end);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpin(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float start = 0.0f, end = 0.0f;
+    self->GetSpin(start, end);
+
+    lua_pushnumber(L, start);
+    lua_pushnumber(L, end);
+
+    return 2;
+}
+
+int Wrap_ParticleSystem::SetSpinVariation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetSpinVariation(luaL_checknumber(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetSpinVariation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushnumber(L, self->GetSpinVariation());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetRelativeRotation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->SetRelativeRotation(lua_toboolean(L, 2));
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::HasRelativeRotation(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushboolean(L, self->HasRelativeRotation());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::SetOffset(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    float x = luaL_checknumber(L, 2);
+    float y = luaL_checknumber(L, 3);
+
+    self->SetOffset(x, y);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetOffset(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    const Vector2 & offset = self->GetOffset();
+
+    lua_pushnumber(L, offset.x);
+    lua_pushnumber(L, offset.y);
+
+    return 2;
+}
+
+/*
+** Either a list of {r, g, b, a} tables,
+** or r, g, b, a repeated for each color
+*/
+int Wrap_ParticleSystem::SetColors(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    std::vector<Colorf> colors;
+
+    if (lua_istable(L, 2))
+    {
+        size_t count = lua_gettop(L) - 1;
+
+        for (size_t index = 0; index < count; index++)
+        {
+            int arg = index + 2;
+            luaL_checktype(L, arg, LUA_TTABLE);
+
+            for (int component = 1; component <= 4; component++)
+                lua_rawgeti(L, arg, component);
+
+            Colorf color;
+
+            color.r = luaL_checknumber(L, -4);
+            color.g = luaL_checknumber(L, -3);
+            color.b = luaL_checknumber(L, -2);
+            color.a = luaL_optnumber(L, -1, 1.0f);
+
+            lua_pop(L, 4);
+
+            colors.push_back(color);
+        }
+    }
+    else
+    {
+        int components = lua_gettop(L) - 1;
+
+        if (components % 4 != 0 || components == 0)
+            return luaL_error(L, "Expected red, green, blue, and alpha. Only got %d of 4 components.",
+                              components % 4);
+
+        for (int arg = 2; arg < components + 2; arg += 4)
+        {
+            Colorf color;
+
+            color.r = luaL_checknumber(L, arg);
+            color.g = luaL_checknumber(L, arg + 1);
+            color.b = luaL_checknumber(L, arg + 2);
+            color.a = luaL_checknumber(L, arg + 3);
+
+            colors.push_back(color);
+        }
+    }
+
+    if (colors.size() > ParticleSystem::MAX_GRADIENT)
+        return luaL_error(L, "At most %d colors may be used.", (int)ParticleSystem::MAX_GRADIENT);
+
+    Luax::CatchException(L, [&]() {
+        self->SetColors(colors);
+    });
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::GetColors(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    const std::vector<Colorf> & colors = self->GetColors();
+
+    for (const Colorf & color : colors)
+    {
+        lua_createtable(L, 4, 0);
+
+        lua_pushnumber(L, color.r);
+        lua_rawseti(L, -2, 1);
+
+        lua_pushnumber(L, color.g);
+        lua_rawseti(L, -2, 2);
+
+        lua_pushnumber(L, color.b);
+        lua_rawseti(L, -2, 3);
+
+        lua_pushnumber(L, color.a);
+        lua_rawseti(L, -2, 4);
+    }
+
+    return colors.size();
+}
+
+int Wrap_ParticleSystem::GetCount(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushinteger(L, self->GetCount());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::Start(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Start();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Stop(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Stop();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Pause(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Pause();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Reset(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    self->Reset();
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::Emit(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    int count = (int)luaL_checkinteger(L, 2);
+
+    if (count > 0)
+        self->Emit(count);
+
+    return 0;
+}
+
+int Wrap_ParticleSystem::IsActive(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushboolean(L, self->IsActive());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::IsPaused(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushboolean(L, self->IsPaused());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::IsStopped(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushboolean(L, self->IsStopped());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::IsEmpty(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushboolean(L, self->IsEmpty());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::IsFull(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+
+    lua_pushboolean(L, self->IsFull());
+
+    return 1;
+}
+
+int Wrap_ParticleSystem::Update(lua_State * L)
+{
+    ParticleSystem * self = Wrap_ParticleSystem::CheckParticleSystem(L, 1);
+    float dt = luaL_checknumber(L, 2);
+
+    self->Update(dt);
+
+    return 0;
+}
+
+ParticleSystem * Wrap_ParticleSystem::CheckParticleSystem(lua_State * L, int index)
+{
+    return Luax::CheckType<ParticleSystem>(L, index);
+}
+
+int Wrap_ParticleSystem::Register(lua_State * L)
+{
+    luaL_Reg reg[] =
+    {
+        { "emit",                      Emit                      },
+        { "getBufferSize",             GetBufferSize             },
+        { "getColors",                 GetColors                 },
+        { "getCount",                  GetCount                  },
+        { "getDirection",              GetDirection              },
+        { "getEmissionRate",           GetEmissionRate           },
+        { "getEmitterLifetime",        GetEmitterLifetime        },
+        { "getLinearAcceleration",     GetLinearAcceleration     },
+        { "getLinearDamping",          GetLinearDamping          },
+        { "getOffset",                 GetOffset                 },
+        { "getParticleLifetime",       GetParticleLifetime       },
+        { "getPosition",               GetPosition               },
+        { "getRadialAcceleration",     GetRadialAcceleration     },
+        { "getRotation",               GetRotation               },
+        { "getSizes",                  GetSizes                  },
+        { "getSizeVariation",          GetSizeVariation          },
+        { "getSpeed",                  GetSpeed                  },
+        { "getSpin",                   GetSpin                   },
+        { "getSpinVariation",          GetSpinVariation          },
+        { "getSpread",                 GetSpread                 },
+        { "getTangentialAcceleration", GetTangentialAcceleration },
+        { "getTexture",                GetTexture                },
+        { "hasRelativeRotation",       HasRelativeRotation       },
+        { "isActive",                  IsActive                  },
+        { "isEmpty",                   IsEmpty                   },
+        { "isFull",                    IsFull                    },
+        { "isPaused",                  IsPaused                  },
+        { "isStopped",                 IsStopped                 },
+        { "moveTo",                    MoveTo                    },
+        { "pause",                     Pause                     },
+        { "reset",                     Reset                     },
+        { "setBufferSize",             SetBufferSize             },
+        { "setColors",                 SetColors                 },
+        { "setDirection",              SetDirection              },
+        { "setEmissionRate",           SetEmissionRate           },
+        { "setEmitterLifetime",        SetEmitterLifetime        },
+        { "setLinearAcceleration",     SetLinearAcceleration     },
+        { "setLinearDamping",          SetLinearDamping          },
+        { "setOffset",                 SetOffset                 },
+        { "setParticleLifetime",       SetParticleLifetime       },
+        { "setPosition",               SetPosition               },
+        { "setRadialAcceleration",     SetRadialAcceleration     },
+        { "setRelativeRotation",       SetRelativeRotation       },
+        { "setRotation",               SetRotation               },
+        { "setSizes",                  SetSizes                  },
+        { "setSizeVariation",          SetSizeVariation          },
+        { "setSpeed",                  SetSpeed                  },
+        { "setSpin",                   SetSpin                   },
+        { "setSpinVariation",          SetSpinVariation          },
+        { "setSpread",                 SetSpread                 },
+        { "setTangentialAcceleration", SetTangentialAcceleration },
+        { "setTexture",                SetTexture                },
+        { "start",                     Start                     },
+        { "stop",                      Stop                      },
+        { "update",                    Update                    },
+        { 0,                           0                         }
+    };
+
+    return Luax::RegisterType(L, &ParticleSystem::type, reg, nullptr);
+}
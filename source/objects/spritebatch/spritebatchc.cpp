@@ -0,0 +1,149 @@
+#include "objects/spritebatch/spritebatchc.h"
+
+using namespace love::common;
+
+love::Type SpriteBatch::type("SpriteBatch", &Drawable::type);
+
+SpriteBatch::SpriteBatch(love::Texture * texture, int size) : texture(texture),
+                                                              size(size),
+                                                              next(0),
+                                                              color(1.0f, 1.0f, 1.0f, 1.0f),
+                                                              colorActive(false),
+                                                              rangeStart(-1),
+                                                              rangeCount(-1)
+{
+    if (size <= 0)
+        throw love::Exception("Invalid SpriteBatch size.");
+}
+
+SpriteBatch::~SpriteBatch()
+{}
+
+int SpriteBatch::Add(const Matrix4 & m, int index)
+{
+    return this->Add(this->texture->GetQuad(), m, index);
+}
+
+int SpriteBatch::Add(love::Quad * quad, const Matrix4 & m, int index)
+{
+    /* Only sprites already added can be replaced */
+    if (index < -1 || index >= this->next)
+        throw love::Exception("Invalid sprite index: %d", index + 1);
+
+    /* Grow the same way LÖVE does, instead of refusing the sprite */
+    if (index == -1 && this->next >= this->size)
+        this->SetBufferSize(this->size * 2);
+
+    Colorf color = (this->colorActive) ? this->color : Colorf(1.0f, 1.0f, 1.0f, 1.0f);
+
+    int spriteIndex = (index == -1) ? this->next : index;
+    this->SetSprite(spriteIndex, quad, m, color);
+
+    if (index == -1)
+        return this->next++;
+
+    return index;
+}
+
+void SpriteBatch::Clear()
+{
+    this->next = 0;
+}
+
+/*
+** Sprite data is already where the draw reads it from,
+** so there is never anything left to send
+*/
+void SpriteBatch::Flush()
+{}
+
+void SpriteBatch::SetTexture(love::Texture * texture)
+{
+    this->texture.Set(texture);
+}
+
+love::Texture * SpriteBatch::GetTexture() const
+{
+    return this->texture.Get();
+}
+
+void SpriteBatch::SetColor(const Colorf & color)
+{
+    this->colorActive = true;
+    this->color = color;
+}
+
+void SpriteBatch::SetColor()
+{
+    this->colorActive = false;
+    this->color = Colorf(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+Colorf SpriteBatch::GetColor(bool & active) const
+{
+    active = this->colorActive;
+    return this->color;
+}
+
+int SpriteBatch::GetCount() const
+{
+    return this->next;
+}
+
+int SpriteBatch::GetBufferSize() const
+{
+    return this->size;
+}
+
+void SpriteBatch::SetBufferSize(int size)
+{
+    if (size <= 0)
+        throw love::Exception("Invalid SpriteBatch size.");
+
+    if (size == this->size)
+        return;
+
+    this->Resize(size);
+
+    this->size = size;
+    this->next = std::min(this->next, size);
+}
+
+void SpriteBatch::SetDrawRange(int start, int count)
+{
+    if (start < 0 || count <= 0)
+        throw love::Exception("Invalid draw range.");
+
+    this->rangeStart = start;
+    this->rangeCount = count;
+}
+
+void SpriteBatch::SetDrawRange()
+{
+    this->rangeStart = this->rangeCount = -1;
+}
+
+bool SpriteBatch::GetDrawRange(int & start, int & count) const
+{
+    if (this->rangeStart < 0 || this->rangeCount <= 0)
+        return false;
+
+    start = this->rangeStart;
+    count = this->rangeCount;
+
+    return true;
+}
+
+bool SpriteBatch::GetDrawSprites(int & start, int & count) const
+{
+    start = 0;
+    count = this->next;
+
+    if (this->rangeStart >= 0 && this->rangeCount > 0)
+    {
+        start = std::min(this->rangeStart, this->next);
+        count = std::min(this->rangeCount, this->next - start);
+    }
+
+    return count > 0;
+}
@@ -0,0 +1,240 @@
+#include "common/luax.h"
+#include "objects/spritebatch/wrap_spritebatch.h"
+
+#include "objects/transform/wrap_transform.h"
+#include "modules/graphics/graphics.h"
+
+using namespace love;
+
+/*
+** Shared by add and set
+** [quad,] x, y, r, sx, sy, ox, oy, kx, ky
+** or [quad,] transform
+*/
+static int AddOrSet(lua_State * L, SpriteBatch * self, int start, int index)
+{
+    Quad * quad = nullptr;
+
+    if (Luax::IsType(L, start, Quad::type))
+    {
+        quad = Luax::ToType<Quad>(L, start);
+        start++;
+    }
+    else if (lua_isnil(L, start) && !lua_isnoneornil(L, start + 1))
+        return Luax::TypeErrror(L, start, "Quad");
+
+    const auto addSprite = [&](const Matrix4 & m) {
+        Luax::CatchException(L, [&]() {
+            if (quad)
+                index = self->Add(quad, m, index);
+            else
+                index = self->Add(m, index);
+        });
+    };
+
+    if (Luax::IsType(L, start, Transform::type))
+    {
+        Transform * transform = Luax::ToType<Transform>(L, start);
+        addSprite(transform->GetMatrix());
+    }
+    else
+        Graphics::CheckStandardTransform(L, start, addSprite);
+
+    return index;
+}
+
+int Wrap_SpriteBatch::Add(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    int index = AddOrSet(L, self, 2, -1);
+
+    lua_pushinteger(L, index + 1);
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::Set(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+    int index = (int)luaL_checkinteger(L, 2) - 1;
+
+    AddOrSet(L, self, 3, index);
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::Clear(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    self->Clear();
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::Flush(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    Luax::CatchException(L, [&]() {
+        self->Flush();
+    });
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::SetTexture(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+    Texture * texture = Wrap_Texture::CheckTexture(L, 2);
+
+    Luax::CatchException(L, [&]() {
+        self->SetTexture(texture);
+    });
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::GetTexture(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+    Texture * texture = self->GetTexture();
+
+    Luax::PushType(L, texture);
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::SetColor(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+    Colorf color;
+
+    if (lua_gettop(L) <= 1)
+    {
+        self->SetColor();
+        return 0;
+    }
+    else if (lua_istable(L, 2))
+    {
+        for (int i = 1; i <= 4; i++)
+            lua_rawgeti(L, 2, i);
+
+        color.r = luaL_checknumber(L, -4);
+        color.g = luaL_checknumber(L, -3);
+        color.b = luaL_checknumber(L, -2);
+        color.a = luaL_optnumber(L, -1, 1.0f);
+
+        lua_pop(L, 4);
+    }
+    else
+    {
+        color.r = luaL_checknumber(L, 2);
+        color.g = luaL_checknumber(L, 3);
+        color.b = luaL_checknumber(L, 4);
+        color.a = luaL_optnumber(L, 5, 1.0f);
+    }
+
+    self->SetColor(color);
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::GetColor(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    bool active = false;
+    Colorf color = self->GetColor(active);
+
+    if (!active)
+        return 0;
+
+    lua_pushnumber(L, color.r);
+    lua_pushnumber(L, color.g);
+    lua_pushnumber(L, color.b);
+    lua_pushnumber(L, color.a);
+
+    return 4;
+}
+
+int Wrap_SpriteBatch::GetCount(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    lua_pushinteger(L, self->GetCount());
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::GetBufferSize(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    lua_pushinteger(L, self->GetBufferSize());
+
+    return 1;
+}
+
+int Wrap_SpriteBatch::SetDrawRange(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    if (lua_isnoneornil(L, 2))
+        self->SetDrawRange();
+    else
+    {
+        int start = (int)luaL_checkinteger(L, 2) - 1;
+        int count = (int)luaL_checkinteger(L, 3);
+
+        Luax::CatchException(L, [&]() {
+            self->SetDrawRange(start, count);
+        });
+    }
+
+    return 0;
+}
+
+int Wrap_SpriteBatch::GetDrawRange(lua_State * L)
+{
+    SpriteBatch * self = Wrap_SpriteBatch::CheckSpriteBatch(L, 1);
+
+    int start = 0;
+    int count = 1;
+
+    if (!self->GetDrawRange(start, count))
+        return 0;
+
+    lua_pushinteger(L, start + 1);
+    lua_pushinteger(L, count);
+
+    return 2;
+}
+
+SpriteBatch * Wrap_SpriteBatch::CheckSpriteBatch(lua_State * L, int index)
+{
+    return Luax::CheckType<SpriteBatch>(L, index);
+}
+
+int Wrap_SpriteBatch::Register(lua_State * L)
+{
+    luaL_Reg reg[] =
+    {
+        { "add",           Add           },
+        { "clear",         Clear         },
+        { "flush",         Flush         },
+        { "getBufferSize", GetBufferSize },
+        { "getColor",      GetColor      },
+        { "getCount",      GetCount      },
+        { "getDrawRange",  GetDrawRange  },
+        { "getTexture",    GetTexture    },
+        { "set",           Set           },
+        { "setColor",      SetColor      },
+        { "setDrawRange",  SetDrawRange  },
+        { "setTexture",    SetTexture    },
+        { 0,               0             }
+    };
+
+    return Luax::RegisterType(L, &SpriteBatch::type, reg, nullptr);
+}
@@ -133,7 +133,7 @@ int Wrap_Transform::SetTransformation(lua_State *L)
 int Wrap_Transform::SetMatrix(lua_State * L)
 {
 
-    #if defined (__SWITCH__)
+    #if defined (__SWITCH__) || defined (__HEADLESS__)
         Transform * self = Wrap_Transform::CheckTransform(L, 1);
 
         bool columnmajor = false;
@@ -250,7 +250,7 @@ int Wrap_Transform::SetMatrix(lua_State * L)
 
 int Wrap_Transform::GetMatrix(lua_State * L)
 {
-    #if defined (__SWITCH__)
+    #if defined (__SWITCH__) || defined (__HEADLESS__)
         Transform * self = Wrap_Transform::CheckTransform(L, 1);
         const Elements & elements = self->GetMatrix().GetElements();
 
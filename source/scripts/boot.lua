@@ -346,6 +346,11 @@ function love.errorhandler(message)
 
     error_printer(message, 2)
 
+    -- nothing can dismiss the error screen on a headless host
+    if love._console_name == "Headless" then
+        return
+    end
+
     if not love.window or not love.event then
         return
     end
@@ -0,0 +1,102 @@
+#include "test.h"
+
+#include "common/atlaspacker.h"
+
+#include <random>
+
+using namespace love;
+
+namespace
+{
+    bool Overlaps(const Rect & a, const Rect & b)
+    {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    /* Pack sprites between @min and @max pixels square until the page is full */
+    std::vector<Rect> Fill(AtlasPacker & packer, int min, int max, unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> size(min, max);
+
+        std::vector<Rect> packed;
+        Rect rect;
+
+        /* the page counts as full after a run of misses */
+        for (int misses = 0; misses < 32;)
+        {
+            if (packer.Pack(size(random), size(random), rect))
+                packed.push_back(rect);
+            else
+                misses++;
+        }
+
+        return packed;
+    }
+}
+
+TEST(atlaspacker_never_overlaps)
+{
+    AtlasPacker packer(512, 512);
+    std::vector<Rect> packed = Fill(packer, 4, 64, 1);
+
+    CHECK(!packed.empty());
+
+    for (size_t index = 0; index < packed.size(); index++)
+    {
+        const Rect & rect = packed[index];
+
+        CHECK(rect.x >= 0 && rect.y >= 0);
+        CHECK(rect.x + rect.w <= 512 && rect.y + rect.h <= 512);
+
+        for (size_t other = index + 1; other < packed.size(); other++)
+            CHECK(!Overlaps(rect, packed[other]));
+    }
+}
+
+TEST(atlaspacker_fills_pages)
+{
+    AtlasPacker packer(1024, 1024);
+    Fill(packer, 8, 48, 2);
+
+    /* a skyline packer should leave well under a quarter of the page */
+    CHECK(packer.GetOccupancy() > 0.75f);
+
+    Rect rect;
+    CHECK(!packer.Pack(2048, 8, rect));
+
+    packer.Reset();
+    CHECK_EQ(packer.GetOccupancy(), 0.0f);
+    CHECK(packer.Pack(1024, 1024, rect));
+}
+
+TEST(atlaspacker_resize_keeps_placements)
+{
+    AtlasPacker packer(64, 64);
+    Rect first, second;
+
+    CHECK(packer.Pack(64, 64, first));
+    CHECK(!packer.Pack(32, 32, second));
+
+    packer.Resize(128, 128);
+
+    CHECK(packer.Pack(32, 32, second));
+    CHECK(!Overlaps(first, second));
+    CHECK_EQ(packer.GetWidth(), 128);
+}
+
+BENCH(atlaspacker_pages)
+{
+    for (int max : { 16, 32, 64 })
+    {
+        AtlasPacker packer(1024, 1024);
+        size_t rects = Fill(packer, 4, max, 3).size();
+
+        printf("    4-%dpx sprites: %zu on a 1024 page, %.1f%% covered\n", max, rects, packer.GetOccupancy() * 100.0f);
+
+        love::test::Measure("sprites packed", 100, [&]() {
+            packer.Reset();
+            Fill(packer, 4, max, 3);
+        }, rects);
+    }
+}
@@ -0,0 +1,195 @@
+#include "test.h"
+
+#include "common/distancefield.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    constexpr int SPREAD = 4;
+
+    /* Signed distance to an outline from a pixel centre, negative inside */
+    typedef std::function<double(double, double)> Outline;
+
+    /*
+    ** Reference bitmap for @outline, each pixel's coverage
+    ** from a 16 by 16 grid of samples, like FreeType's antialiasing
+    */
+    std::vector<uint8_t> Rasterize(const Outline & outline, int width, int height)
+    {
+        static constexpr int SAMPLES = 16;
+        std::vector<uint8_t> coverage(width * height);
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                int covered = 0;
+
+                for (int sy = 0; sy < SAMPLES; sy++)
+                {
+                    for (int sx = 0; sx < SAMPLES; sx++)
+                    {
+                        double px = x - 0.5 + (sx + 0.5) / SAMPLES;
+                        double py = y - 0.5 + (sy + 0.5) / SAMPLES;
+
+                        covered += (outline(px, py) < 0.0);
+                    }
+                }
+
+                coverage[y * width + x] = (uint8_t)((covered * 255 + SAMPLES * SAMPLES / 2) / (SAMPLES * SAMPLES));
+            }
+        }
+
+        return coverage;
+    }
+
+    struct Error
+    {
+        double edgeMean = 0.0; //< within a pixel of the outline
+        double edgeMax  = 0.0;
+        double max      = 0.0; //< anywhere inside the spread
+    };
+
+    /* Generate a field for @outline and compare it, in pixels, with the real distances */
+    Error Measure(const Outline & outline, int width, int height)
+    {
+        std::vector<uint8_t> coverage = Rasterize(outline, width, height);
+
+        int paddedWidth  = DistanceField::GetPadded(width, SPREAD);
+        int paddedHeight = DistanceField::GetPadded(height, SPREAD);
+
+        std::vector<uint8_t> field(paddedWidth * paddedHeight);
+        DistanceField::Generate(coverage.data(), width, width, height, SPREAD, field.data());
+
+        Error error;
+        size_t edgeCount = 0;
+
+        for (int y = 0; y < paddedHeight; y++)
+        {
+            for (int x = 0; x < paddedWidth; x++)
+            {
+                double expected = outline(x - SPREAD, y - SPREAD);
+
+                /* clamped at the spread, with half a level of rounding to spare */
+                if (std::fabs(expected) > SPREAD - 0.1)
+                    continue;
+
+                double actual = (128.0 - field[y * paddedWidth + x]) * SPREAD / 127.0;
+                double off    = std::fabs(actual - expected);
+
+                error.max = std::max(error.max, off);
+
+                if (std::fabs(expected) <= 1.0)
+                {
+                    error.edgeMean += off;
+                    error.edgeMax = std::max(error.edgeMax, off);
+                    edgeCount++;
+                }
+            }
+        }
+
+        error.edgeMean /= edgeCount;
+
+        return error;
+    }
+
+    Outline Disc(double cx, double cy, double radius)
+    {
+        return [=](double x, double y) {
+            return std::hypot(x - cx, y - cy) - radius;
+        };
+    }
+
+    Outline Box(double left, double top, double right, double bottom)
+    {
+        return [=](double x, double y) {
+            double dx = std::max(left - x, x - right);
+            double dy = std::max(top - y, y - bottom);
+
+            if (dx > 0.0 || dy > 0.0)
+                return std::hypot(std::max(dx, 0.0), std::max(dy, 0.0));
+
+            return std::max(dx, dy);
+        };
+    }
+
+    /* A ring, for concave outlines and strokes thinner than the spread */
+    Outline Ring(double cx, double cy, double radius, double thickness)
+    {
+        return [=](double x, double y) {
+            return std::fabs(std::hypot(x - cx, y - cy) - radius) - thickness * 0.5;
+        };
+    }
+}
+
+TEST(distancefield_matches_antialiased_disc)
+{
+    Error error = Measure(Disc(12.3, 11.7, 8.6), 24, 24);
+
+    printf("    disc: edge mean %.3f px, edge max %.3f px, max %.3f px\n",
+           error.edgeMean, error.edgeMax, error.max);
+
+    CHECK(error.edgeMean < 0.1);
+    CHECK(error.edgeMax < 0.35);
+    CHECK(error.max < 0.5);
+}
+
+TEST(distancefield_matches_pixel_aligned_box)
+{
+    /* hard edges on pixel boundaries, like a monochrome glyph */
+    Error error = Measure(Box(2.5, 3.5, 13.5, 9.5), 16, 13);
+
+    printf("    box: edge mean %.3f px, edge max %.3f px, max %.3f px\n",
+           error.edgeMean, error.edgeMax, error.max);
+
+    /*
+    ** Whole pixels keep one outline point, on one side, so the
+    ** pixel diagonally off a hard corner measures to a side's
+    ** midpoint rather than the corner: about 0.41 px long
+    */
+    CHECK(error.edgeMean < 0.05);
+    CHECK(error.edgeMax < 0.45);
+    CHECK(error.max < 0.5);
+}
+
+TEST(distancefield_matches_thin_ring)
+{
+    Error error = Measure(Ring(16.2, 15.8, 10.0, 1.6), 32, 32);
+
+    printf("    ring: edge mean %.3f px, edge max %.3f px, max %.3f px\n",
+           error.edgeMean, error.edgeMax, error.max);
+
+    CHECK(error.edgeMean < 0.15);
+    CHECK(error.edgeMax < 0.5);
+    CHECK(error.max < 0.75);
+}
+
+TEST(distancefield_empty_bitmap_is_outside)
+{
+    std::vector<uint8_t> coverage(8 * 8, 0);
+    std::vector<uint8_t> field(DistanceField::GetPadded(8, SPREAD) * DistanceField::GetPadded(8, SPREAD), 1);
+
+    DistanceField::Generate(coverage.data(), 8, 8, 8, SPREAD, field.data());
+
+    CHECK(std::all_of(field.begin(), field.end(), [](uint8_t value) { return value == 0; }));
+}
+
+BENCH(distancefield_glyph)
+{
+    /* roughly a 32 px glyph */
+    const int size = 28;
+    std::vector<uint8_t> coverage = Rasterize(Ring(14.0, 14.0, 10.0, 4.0), size, size);
+
+    int padded = DistanceField::GetPadded(size, SPREAD);
+    std::vector<uint8_t> field(padded * padded);
+
+    love::test::Measure("28x28 glyph, spread 4", 5000, [&]() {
+        DistanceField::Generate(coverage.data(), size, size, size, SPREAD, field.data());
+    });
+}
@@ -0,0 +1,109 @@
+#include "test.h"
+
+#include "common/kerningtable.h"
+
+#include <string>
+#include <unordered_map>
+
+using namespace love;
+
+namespace
+{
+    /* stands in for the rasterizer, which is the slow part on console */
+    float Kern(uint32_t left, uint32_t right)
+    {
+        return (float)((int)((left * 31 + right) % 5) - 2);
+    }
+
+    /* ~10 KB of English, the size of a dialogue script or help screen */
+    std::string EnglishText()
+    {
+        const std::string paragraph =
+            "The quick brown fox jumps over the lazy dog. Pack my box with five dozen "
+            "liquor jugs! How vexingly quick daft zebras jump; waltz, bad nymph, for "
+            "quick jigs vex. \"Sphinx of black quartz, judge my vow,\" said the clerk.\n";
+
+        std::string text;
+
+        while (text.size() < 10 * 1024)
+            text += paragraph;
+
+        return text;
+    }
+}
+
+TEST(kerningtable_looks_up_each_pair_once)
+{
+    KerningTable table;
+    size_t lookups = 0;
+
+    auto find = [&](uint32_t left, uint32_t right) {
+        lookups++;
+        return Kern(left, right);
+    };
+
+    /* dense pairs, including ones that kern by zero */
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (uint32_t left = 'A'; left <= 'Z'; left++)
+        {
+            for (uint32_t right = 'a'; right <= 'z'; right++)
+                CHECK_EQ(table.Get(left, right, find), Kern(left, right));
+        }
+    }
+
+    CHECK_EQ(lookups, 26u * 26u);
+
+    /* pairs past the dense table, both ways round */
+    CHECK_EQ(table.Get(0x3042, 'a', find), Kern(0x3042, 'a'));
+    CHECK_EQ(table.Get('a', 0x3042, find), Kern('a', 0x3042));
+    CHECK_EQ(table.Get(0x3042, 'a', find), Kern(0x3042, 'a'));
+    CHECK_EQ(table.Get('a', 0x3042, find), Kern('a', 0x3042));
+
+    CHECK_EQ(lookups, 26u * 26u + 2u);
+
+    /* a new fallback font means looking everything up again */
+    table.Clear();
+
+    CHECK_EQ(table.Get('A', 'v', find), Kern('A', 'v'));
+    CHECK_EQ(lookups, 26u * 26u + 3u);
+}
+
+BENCH(kerningtable_text_width)
+{
+    const std::string text = EnglishText();
+    float width = 0.0f;
+
+    /* what Font::GetWidth did before, every pair through the hash map */
+    std::unordered_map<uint64_t, float> kerning;
+
+    love::test::Measure("10 KB width, hash map kerning", 2000, [&]() {
+        uint32_t previous = 0;
+
+        for (unsigned char c : text)
+        {
+            uint64_t packed = ((uint64_t)previous << 32) | (uint64_t)c;
+            auto found      = kerning.find(packed);
+
+            if (found == kerning.end())
+                found = kerning.emplace(packed, Kern(previous, c)).first;
+
+            width += 8.0f + found->second;
+            previous = c;
+        }
+    }, text.size());
+
+    KerningTable table;
+
+    love::test::Measure("10 KB width, dense kerning", 2000, [&]() {
+        uint32_t previous = 0;
+
+        for (unsigned char c : text)
+        {
+            width += 8.0f + table.Get(previous, c, Kern);
+            previous = c;
+        }
+    }, text.size());
+
+    CHECK(width != 0.0f);
+}
@@ -0,0 +1,87 @@
+#include "test.h"
+
+#include "common/lrucache.h"
+
+#include <string>
+
+using namespace love;
+
+TEST(lrucache_evicts_least_recently_used)
+{
+    LRUCache<std::string, int> cache(3);
+
+    cache.Insert("a", 1);
+    cache.Insert("b", 2);
+    cache.Insert("c", 3);
+
+    /* touching "a" leaves "b" as the oldest */
+    CHECK(cache.Find("a") != nullptr);
+
+    cache.Insert("d", 4);
+
+    CHECK(cache.Find("b") == nullptr);
+    CHECK_EQ(*cache.Find("a"), 1);
+    CHECK_EQ(*cache.Find("c"), 3);
+    CHECK_EQ(*cache.Find("d"), 4);
+
+    CHECK_EQ(cache.GetSize(), 3u);
+    CHECK_EQ(cache.GetHits(), 4u);
+    CHECK_EQ(cache.GetMisses(), 1u);
+}
+
+TEST(lrucache_bounds_total_cost)
+{
+    /* like the 3DS text cache, where entries cost their glyph count */
+    LRUCache<std::string, int> cache(10);
+
+    cache.Insert("short", 1, 4);
+    cache.Insert("longer", 2, 5);
+
+    CHECK_EQ(cache.GetCost(), 9u);
+
+    cache.Insert("again", 3, 4);
+
+    CHECK(cache.Find("short") == nullptr);
+    CHECK_EQ(cache.GetCost(), 9u);
+
+    /* replacing an entry gives back its old cost */
+    cache.Insert("again", 4, 1);
+
+    CHECK_EQ(cache.GetCost(), 6u);
+    CHECK_EQ(*cache.Find("again"), 4);
+
+    CHECK(!cache.Fits(11));
+    CHECK(cache.Fits(10));
+
+    cache.Insert("huge", 5, 10);
+
+    CHECK_EQ(cache.GetSize(), 1u);
+    CHECK_EQ(cache.GetCost(), 10u);
+
+    cache.Clear();
+
+    CHECK(cache.IsEmpty());
+    CHECK_EQ(cache.GetCost(), 0u);
+}
+
+BENCH(lrucache_lookups)
+{
+    LRUCache<std::string, int> cache(64);
+    std::vector<std::string> keys;
+
+    for (int index = 0; index < 64; index++)
+    {
+        keys.push_back("HUD label number " + std::to_string(index));
+        cache.Insert(keys.back(), int(index));
+    }
+
+    size_t index = 0;
+
+    love::test::Measure("hits, 64 string keys", 2000000, [&]() {
+        cache.Find(keys[index++ & 63]);
+    });
+
+    love::test::Measure("insert with eviction", 500000, [&]() {
+        cache.Insert(keys[index++ & 63] + "!", 0);
+    });
+}
@@ -0,0 +1,88 @@
+#include "test.h"
+
+#include "common/streambatch.h"
+
+namespace
+{
+    struct State
+    {
+        uint32_t texture;
+        int primitive;
+
+        bool operator==(const State & other) const = default;
+    };
+
+    typedef StreamBatch<State> Batch;
+}
+
+TEST(streambatch_merges_contiguous_draws)
+{
+    std::vector<Batch::Draw> draws;
+    Batch batch([&](const Batch::Draw & draw) { draws.push_back(draw); });
+
+    /* 2000 sprites from one texture are one draw */
+    for (uint32_t sprite = 0; sprite < 2000; sprite++)
+        batch.Add({ 1, 0 }, sprite * 4, 4);
+
+    CHECK_EQ(batch.GetFlushCount(), 0u);
+
+    batch.Flush();
+    batch.Flush();
+
+    CHECK_EQ(batch.GetFlushCount(), 1u);
+    CHECK_EQ(draws.size(), 1u);
+    CHECK_EQ(draws[0].firstVertex, 0u);
+    CHECK_EQ(draws[0].vertexCount, 8000u);
+}
+
+TEST(streambatch_flushes_on_state_or_gap)
+{
+    std::vector<Batch::Draw> draws;
+    Batch batch([&](const Batch::Draw & draw) { draws.push_back(draw); });
+
+    CHECK(!batch.Add({ 1, 0 }, 0, 4));
+    CHECK(batch.Add({ 1, 0 }, 4, 4));
+
+    /* another texture, another primitive, then a gap in the vertices */
+    CHECK(!batch.Add({ 2, 0 }, 8, 4));
+    CHECK(!batch.Add({ 2, 1 }, 12, 4));
+    CHECK(!batch.Add({ 2, 1 }, 20, 4));
+
+    /* nothing to draw isn't a draw */
+    CHECK(!batch.Add({ 3, 0 }, 24, 0));
+
+    CHECK_EQ(batch.GetFlushCount(), 3u);
+
+    batch.Flush();
+
+    CHECK_EQ(draws.size(), 4u);
+    CHECK_EQ(draws[0].vertexCount, 8u);
+    CHECK_EQ(draws[1].state.texture, 2u);
+    CHECK_EQ(draws[3].firstVertex, 20u);
+
+    batch.Add({ 1, 0 }, 0, 4);
+    batch.Discard();
+    batch.Flush();
+
+    CHECK_EQ(batch.GetFlushCount(), 4u);
+}
+
+BENCH(streambatch_alternating_textures)
+{
+    size_t flushed = 0;
+    Batch batch([&](const Batch::Draw &) { flushed++; });
+
+    uint32_t vertex = 0;
+
+    love::test::Measure("add, same texture", 1000000, [&]() {
+        batch.Add({ 1, 0 }, vertex, 4);
+        vertex += 4;
+    });
+
+    love::test::Measure("add, alternating textures", 1000000, [&]() {
+        batch.Add({ vertex & 4, 0 }, vertex, 4);
+        vertex += 4;
+    });
+
+    batch.Flush();
+}
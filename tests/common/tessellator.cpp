@@ -0,0 +1,139 @@
+#include "test.h"
+
+#include "common/tessellator.h"
+#include "modules/graphics/wrap_graphics.h"
+
+#include <cmath>
+
+using namespace love;
+
+/* The per-segment trig every shape used before the tables */
+namespace reference
+{
+    void Ellipse(Vector2 * out, float x, float y, float a, float b, int points)
+    {
+        float shift = (float)(M_PI * 2) / points;
+        float phi = 0.0f;
+
+        for (int index = 0; index < points; index++, phi += shift)
+            out[index] = Vector2(x + a * cosf(phi), y + b * sinf(phi));
+
+        out[points] = out[0];
+    }
+
+    void Arc(Vector2 * out, float x, float y, float radius, float angle1, float angle2, int points)
+    {
+        float shift = (angle2 - angle1) / points;
+        float phi = angle1;
+
+        for (int index = 0; index <= points; index++, phi += shift)
+            out[index] = Vector2(x + radius * cosf(phi), y + radius * sinf(phi));
+    }
+
+    void RoundedRectangle(Vector2 * out, float x, float y, float width, float height,
+                          float rx, float ry, int points)
+    {
+        const float halfPi = (float)(M_PI / 2);
+
+        float shift = halfPi / (points + 1.0f);
+        int corner = points + 2;
+
+        for (int index = 0; index < corner; index++)
+        {
+            float phi = shift * index;
+
+            out[index]              = Vector2(x + rx * (1 - cosf(phi)), y + ry * (1 - sinf(phi)));
+            out[index + corner]     = Vector2(x + width - rx * (1 + cosf(phi + halfPi)), y + ry * (1 - sinf(phi + halfPi)));
+            out[index + corner * 2] = Vector2(x + width - rx * (1 + cosf(phi + halfPi * 2)), y + height - ry * (1 + sinf(phi + halfPi * 2)));
+            out[index + corner * 3] = Vector2(x + rx * (1 - cosf(phi + halfPi * 3)), y + height - ry * (1 + sinf(phi + halfPi * 3)));
+        }
+
+        out[corner * 4] = out[0];
+    }
+}
+
+namespace
+{
+    bool Near(const Vector2 * a, const Vector2 * b, size_t count)
+    {
+        for (size_t index = 0; index < count; index++)
+        {
+            if (fabsf(a[index].x - b[index].x) > 1e-3f || fabsf(a[index].y - b[index].y) > 1e-3f)
+                return false;
+        }
+
+        return true;
+    }
+}
+
+TEST(tessellator_matches_direct_trig)
+{
+    Tessellator tessellator;
+    Vector2 expected[256], actual[256];
+
+    for (int points : { 3, 16, 100 })
+    {
+        reference::Ellipse(expected, 40, 50, 30, 20, points);
+        tessellator.Ellipse(actual, 40, 50, 30, 20, points);
+        CHECK(Near(expected, actual, points + 1));
+
+        reference::Arc(expected, 40, 50, 30, 0.3f, 5.9f, points);
+        tessellator.Arc(actual, 40, 50, 30, 0.3f, 5.9f, points);
+        CHECK(Near(expected, actual, points + 1));
+    }
+
+    for (int points : { 1, 8, 30 })
+    {
+        size_t size = Tessellator::GetRoundedRectangleSize(points);
+
+        reference::RoundedRectangle(expected, 10, 20, 200, 100, 12, 8, points);
+        tessellator.RoundedRectangle(actual, 10, 20, 200, 100, 12, 8, points);
+        CHECK(Near(expected, actual, size));
+    }
+}
+
+BENCH(tessellator_shapes)
+{
+    Tessellator tessellator;
+    Vector2 out[256];
+    float x = 0.0f;
+
+    love::test::Measure("circle, 32 segments, per-call trig", 1000000, [&]() {
+        reference::Ellipse(out, x++, 50, 20, 20, 32);
+    });
+
+    love::test::Measure("circle, 32 segments, unit table", 1000000, [&]() {
+        tessellator.Ellipse(out, x++, 50, 20, 20, 32);
+    });
+
+    love::test::Measure("rounded rect, 8 per corner, per-call trig", 1000000, [&]() {
+        reference::RoundedRectangle(out, x++, 20, 200, 100, 12, 8, 8);
+    });
+
+    love::test::Measure("rounded rect, 8 per corner, unit table", 1000000, [&]() {
+        tessellator.RoundedRectangle(out, x++, 20, 200, 100, 12, 8, 8);
+    });
+
+    love::test::Measure("arc, 32 segments, per-call trig", 1000000, [&]() {
+        reference::Arc(out, x++, 50, 20, 0.0f, 3.0f, 32);
+    });
+
+    love::test::Measure("arc, 32 segments, rotation", 1000000, [&]() {
+        tessellator.Arc(out, x++, 50, 20, 0.0f, 3.0f, 32);
+    });
+
+    /* the whole draw, including the recorder */
+    auto * graphics = new love::recorder::Graphics();
+
+    love::test::Measure("graphics.rectangle, rounded", 200000, [&]() {
+        graphics->Rectangle(Graphics::DRAW_FILL, 10, 20, 200, 100, 12, 8, 8);
+        ::recorder::Instance().Present();
+    });
+
+    love::test::Measure("graphics.circle", 200000, [&]() {
+        graphics->Circle(Graphics::DRAW_FILL, 50, 50, 20, 32);
+        ::recorder::Instance().Present();
+    });
+
+    graphics->Release();
+}
@@ -0,0 +1,96 @@
+#include "test.h"
+
+#include "common/tintcache.h"
+
+using namespace love;
+
+namespace
+{
+    std::vector<vertex::Vertex> White(size_t count)
+    {
+        std::vector<vertex::Vertex> vertices(count);
+
+        for (auto & vertex : vertices)
+            vertex::PackColor(Colorf(1.0f, 1.0f, 1.0f, 1.0f), vertex.color);
+
+        return vertices;
+    }
+}
+
+TEST(tintcache_only_tints_what_changed)
+{
+    std::vector<vertex::Vertex> vertices = White(400);
+    TintCache cache;
+
+    const Colorf red(1.0f, 0.0f, 0.0f, 1.0f);
+
+    const vertex::Vertex * tinted = cache.Get(vertices, vertices.size(), red);
+
+    CHECK_EQ(cache.GetTintCount(), 400u);
+    CHECK_EQ(tinted[399].color[0], 255);
+    CHECK_EQ(tinted[399].color[1], 0);
+
+    /* same color, nothing changed */
+    for (int frame = 0; frame < 10; frame++)
+        cache.Get(vertices, vertices.size(), red);
+
+    CHECK_EQ(cache.GetTintCount(), 400u);
+
+    /* one sprite changed */
+    vertex::PackColor(Colorf(0.0f, 0.0f, 1.0f, 1.0f), vertices[8].color);
+    cache.Invalidate(8, 4);
+
+    tinted = cache.Get(vertices, vertices.size(), red);
+
+    CHECK_EQ(cache.GetTintCount(), 404u);
+    CHECK_EQ(tinted[8].color[0], 0);
+    CHECK_EQ(tinted[8].color[2], 0);
+
+    /* a new color redoes everything */
+    cache.Get(vertices, vertices.size(), Colorf(0.5f, 0.5f, 0.5f, 1.0f));
+
+    CHECK_EQ(cache.GetTintCount(), 804u);
+}
+
+TEST(tintcache_leaves_undrawn_changes_for_later)
+{
+    std::vector<vertex::Vertex> vertices = White(100);
+    TintCache cache;
+
+    const Colorf half(0.5f, 0.5f, 0.5f, 0.5f);
+
+    /* only the first 40 are drawn */
+    const vertex::Vertex * tinted = cache.Get(vertices, 40, half);
+
+    CHECK_EQ(cache.GetTintCount(), 40u);
+    CHECK_EQ(tinted[39].color[3], 128);
+
+    /* the rest are tinted once they're drawn */
+    tinted = cache.Get(vertices, 100, half);
+
+    CHECK_EQ(cache.GetTintCount(), 100u);
+    CHECK_EQ(tinted[99].color[3], 128);
+
+    /* growing the source starts over */
+    vertices = White(120);
+    cache.Get(vertices, 120, half);
+
+    CHECK_EQ(cache.GetTintCount(), 220u);
+}
+
+BENCH(tintcache)
+{
+    std::vector<vertex::Vertex> vertices = White(2000 * 4);
+    TintCache cache;
+
+    const Colorf color(1.0f, 0.5f, 0.25f, 1.0f);
+
+    love::test::Measure("tint 2000 sprites every draw (sprites)", 2000, [&]() {
+        cache.Invalidate(0, vertices.size());
+        cache.Get(vertices, vertices.size(), color);
+    }, 2000);
+
+    love::test::Measure("tint 2000 unchanged sprites (sprites)", 2000, [&]() {
+        cache.Get(vertices, vertices.size(), color);
+    }, 2000);
+}
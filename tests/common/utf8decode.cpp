@@ -0,0 +1,202 @@
+#include "test.h"
+
+#include "common/utf8decode.h"
+
+#include <string>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    /*
+    ** Plain utf8 library decoding, one codepoint at a time, as
+    ** the fonts did before the fast path; false if @text is bad
+    */
+    bool Reference(const std::string & text, std::vector<uint32_t> & out)
+    {
+        const char * current = text.data();
+        const char * end     = current + text.size();
+
+        try
+        {
+            while (current != end)
+                out.push_back(::utf8::next(current, end));
+        }
+        catch (::utf8::exception &)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ViaForEach(const std::string & text, std::vector<uint32_t> & out)
+    {
+        try
+        {
+            UTF8::ForEach(text.data(), text.size(), [&](uint32_t codepoint) { out.push_back(codepoint); });
+        }
+        catch (love::Exception &)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ViaDecode(const std::string & text, std::vector<uint32_t> & out)
+    {
+        try
+        {
+            UTF8::Decode(text.data(), text.size(), out);
+        }
+        catch (love::Exception &)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    /* Both fast paths agree with the reference, on the result and on what was decoded */
+    bool Matches(const std::string & text)
+    {
+        std::vector<uint32_t> expected, forEach, decoded;
+
+        bool valid = Reference(text, expected);
+
+        return ViaForEach(text, forEach) == valid && forEach == expected &&
+               ViaDecode(text, decoded) == valid && decoded == expected;
+    }
+
+    /* @length bytes of @sample, repeated, cut on a codepoint boundary */
+    std::string Repeat(const std::string & sample, size_t length)
+    {
+        std::string text;
+
+        while (text.size() + sample.size() <= length)
+            text += sample;
+
+        return text;
+    }
+}
+
+TEST(utf8decode_ascii_block_check)
+{
+    char block[UTF8::BLOCK_SIZE];
+
+    for (size_t index = 0; index < UTF8::BLOCK_SIZE; index++)
+        block[index] = 'a' + index;
+
+    CHECK(UTF8::IsASCIIBlock(block));
+
+    /* a high bit anywhere in the block counts */
+    for (size_t index = 0; index < UTF8::BLOCK_SIZE; index++)
+    {
+        block[index] |= 0x80;
+        CHECK(!UTF8::IsASCIIBlock(block));
+        block[index] &= 0x7F;
+    }
+}
+
+TEST(utf8decode_matches_scalar_on_valid_text)
+{
+    const std::string samples[] = {
+        "a", "\xC3\xA9", "\xE3\x81\x82", "\xF0\x9F\x98\x80",
+        /* the edges of each length and around the surrogates */
+        "\x7F", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF",
+        "\xF4\x8F\xBF\xBF"
+    };
+
+    /* every sequence length, at every offset around and across the 16 byte blocks */
+    for (const std::string & sample : samples)
+    {
+        for (size_t before = 0; before <= UTF8::BLOCK_SIZE * 2 + 1; before++)
+        {
+            for (size_t after = 0; after <= UTF8::BLOCK_SIZE + 1; after++)
+                CHECK(Matches(std::string(before, 'x') + sample + std::string(after, 'y')));
+        }
+    }
+
+    CHECK(Matches(""));
+    CHECK(Matches(std::string(1, '\0') + "after a nul"));
+    CHECK(Matches(Repeat("Hello, \xE4\xB8\x96\xE7\x95\x8C! caf\xC3\xA9 \xF0\x9F\x8E\xAE ", 1000)));
+}
+
+TEST(utf8decode_matches_scalar_on_invalid_text)
+{
+    const std::string samples[] = {
+        "\x80",             //< lone continuation byte
+        "\xC3",             //< truncated two byte sequence
+        "\xE3\x81",         //< truncated three byte sequence
+        "\xC3\x28",         //< bad continuation byte
+        "\xE3\x28\x82",     //< bad second byte of three
+        "\xE3\x81\x28",     //< bad third byte of three
+        "\xC0\xAF",         //< overlong '/'
+        "\xE0\x80\xAF",     //< overlong '/'
+        "\xED\xA0\x80",     //< surrogate half
+        "\xF4\x90\x80\x80", //< past U+10FFFF
+        "\xFF"              //< never valid
+    };
+
+    for (const std::string & sample : samples)
+    {
+        for (size_t before = 0; before <= UTF8::BLOCK_SIZE * 2 + 1; before++)
+        {
+            for (size_t after = 0; after <= UTF8::BLOCK_SIZE + 1; after++)
+            {
+                std::string text = std::string(before, 'x') + sample + std::string(after, 'y');
+                std::vector<uint32_t> ignored;
+
+                CHECK(!Reference(text, ignored));
+                CHECK(Matches(text));
+            }
+        }
+    }
+}
+
+BENCH(utf8decode_text)
+{
+    struct Sample
+    {
+        const char * label;
+        std::string text;
+    };
+
+    /* 10 KB each */
+    const Sample samples[] = {
+        { "ascii",  Repeat("The quick brown fox jumps over the lazy dog. ", 10240) },
+        { "mixed",  Repeat("Score: 1200 \xE2\x98\x85 Caf\xC3\xA9 na\xC3\xAFve r\xC3\xA9sum\xC3\xA9 ", 10240) },
+        { "cjk",    Repeat("\xE3\x81\x93\xE3\x82\x93\xE3\x81\xAB\xE3\x81\xA1\xE3\x81\xAF\xE4\xB8\x96\xE7\x95\x8C", 10240) }
+    };
+
+    std::vector<uint32_t> codepoints;
+    codepoints.reserve(10240);
+
+    for (const Sample & sample : samples)
+    {
+        std::string label = std::string(sample.label) + ", scalar (bytes)";
+
+        love::test::Measure(label.c_str(), 2000, [&]() {
+            codepoints.clear();
+            Reference(sample.text, codepoints);
+        }, sample.text.size());
+
+        label = std::string(sample.label) + ", Decode (bytes)";
+
+        love::test::Measure(label.c_str(), 2000, [&]() {
+            codepoints.clear();
+            UTF8::Decode(sample.text.data(), sample.text.size(), codepoints);
+        }, sample.text.size());
+
+        label = std::string(sample.label) + ", ForEach (bytes)";
+
+        love::test::Measure(label.c_str(), 2000, [&]() {
+            codepoints.clear();
+            UTF8::ForEach(sample.text.data(), sample.text.size(), [&](uint32_t codepoint) {
+                codepoints.push_back(codepoint);
+            });
+        }, sample.text.size());
+    }
+}
@@ -0,0 +1,300 @@
+#include "test.h"
+
+#include "common/variant.h"
+
+#include <set>
+#include <string>
+
+using namespace love;
+
+namespace
+{
+    class Counted : public Object
+    {};
+
+    /* A table holding @object twice, once nested, and a string too long to be small */
+    void PushTable(lua_State * L, Object * object)
+    {
+        lua_createtable(L, 2, 1);
+
+        Luax::PushType(L, Object::type, object);
+        lua_rawseti(L, -2, 1);
+
+        lua_createtable(L, 1, 0);
+        Luax::PushType(L, Object::type, object);
+        lua_rawseti(L, -2, 1);
+        lua_rawseti(L, -2, 2);
+
+        lua_pushstring(L, "a string longer than fifteen characters");
+        lua_setfield(L, -2, "name");
+    }
+
+    /* Calls Variant::FromLua on its argument, for lua_pcall */
+    int Encode(lua_State * L)
+    {
+        Variant value = Variant::FromLua(L, 1);
+        return 0;
+    }
+
+    /* A table nested @depth deep, each level holding @depth - level at [1] */
+    void PushNested(lua_State * L, int depth)
+    {
+        lua_newtable(L);
+
+        for (int level = 0; level < depth; level++)
+        {
+            lua_createtable(L, 2, 0);
+            lua_pushinteger(L, level + 1);
+            lua_rawseti(L, -2, 1);
+            lua_insert(L, -2);
+            lua_rawseti(L, -2, 2);
+        }
+    }
+
+    /*
+    ** Tables the way Variant held them before they were flattened:
+    ** a refcounted heap vector of key/value pairs per table, built
+    ** and pushed recursively; only here to benchmark against
+    */
+    class PairTable : public Object
+    {
+        public:
+            static love::Type type;
+
+            std::vector<std::pair<Variant, Variant>> pairs;
+    };
+
+    love::Type PairTable::type("PairTable", &Object::type);
+
+    Variant PairsFromLua(lua_State * L, int index, std::set<const void *> & seen)
+    {
+        if (index < 0)
+            index += lua_gettop(L) + 1;
+
+        if (lua_type(L, index) != LUA_TTABLE)
+            return Variant::FromLua(L, index);
+
+        const void * pointer = lua_topointer(L, index);
+
+        if (!seen.insert(pointer).second)
+            throw love::Exception("Cycle detected in table.");
+
+        PairTable * table = new PairTable();
+        table->pairs.reserve(lua_objlen(L, index));
+
+        lua_pushnil(L);
+
+        while (lua_next(L, index))
+        {
+            table->pairs.emplace_back(PairsFromLua(L, -2, seen), PairsFromLua(L, -1, seen));
+            lua_pop(L, 1);
+        }
+
+        seen.erase(pointer);
+
+        Variant value(&PairTable::type, table);
+        table->Release();
+
+        return value;
+    }
+
+    void PairsToLua(lua_State * L, const Variant & value)
+    {
+        if (value.GetType() != Variant::LOVE_OBJECT || value.GetValue<Variant::LOVE_OBJECT>().type != &PairTable::type)
+            return value.ToLua(L);
+
+        PairTable * table = (PairTable *)value.GetValue<Variant::LOVE_OBJECT>().object;
+
+        lua_createtable(L, 0, (int)table->pairs.size());
+
+        for (const auto & pair : table->pairs)
+        {
+            PairsToLua(L, pair.first);
+            PairsToLua(L, pair.second);
+
+            lua_settable(L, -3);
+        }
+    }
+}
+
+TEST(variant_move_leaves_source_nil)
+{
+    Variant string(std::string("a string longer than fifteen characters"));
+    CHECK_EQ(string.GetType(), Variant::STRING);
+
+    Variant moved(std::move(string));
+
+    CHECK_EQ(string.GetType(), Variant::NIL);
+    CHECK_EQ(moved.GetType(), Variant::STRING);
+    CHECK_EQ(moved.GetValue<Variant::STRING>()->GetReferenceCount(), 1);
+
+    Variant assigned(1.0);
+    assigned = std::move(moved);
+
+    CHECK_EQ(moved.GetType(), Variant::NIL);
+    CHECK_EQ(assigned.GetType(), Variant::STRING);
+    CHECK_EQ(assigned.GetValue<Variant::STRING>()->GetReferenceCount(), 1);
+}
+
+TEST(variant_table_retains_objects_once)
+{
+    lua_State * L = luaL_newstate();
+    Counted * object = new Counted();
+
+    PushTable(L, object);
+
+    /* our own reference and the Lua proxies' */
+    const int baseline = object->GetReferenceCount();
+
+    {
+        std::vector<Variant> values;
+
+        values.push_back(Variant::FromLua(L, -1));
+        CHECK_EQ(values.back().GetType(), Variant::TABLE);
+
+        /* the flat buffer holds both occurrences */
+        CHECK_EQ(object->GetReferenceCount(), baseline + 2);
+
+        /* copies share the buffer, moves and reallocation hand it over */
+        Variant copy = values.back();
+        for (int index = 0; index < 32; index++)
+            values.push_back(copy);
+
+        Variant moved(std::move(copy));
+        values.push_back(std::move(moved));
+
+        CHECK_EQ(object->GetReferenceCount(), baseline + 2);
+        CHECK_EQ(values.back().GetValue<Variant::TABLE>()->GetReferenceCount(), 34);
+    }
+
+    CHECK_EQ(object->GetReferenceCount(), baseline);
+
+    /* decoding pushes new proxies, which Lua owns until it closes */
+    Variant::FromLua(L, -1).ToLua(L);
+
+    lua_rawgeti(L, -1, 2);
+    lua_rawgeti(L, -1, 1);
+    CHECK(Variant::TryExtractProxy(L, -1)->object == object);
+    lua_pop(L, 2);
+
+    lua_getfield(L, -1, "name");
+    CHECK_EQ(std::string(lua_tostring(L, -1)), "a string longer than fifteen characters");
+    lua_pop(L, 2);
+
+    lua_close(L);
+
+    CHECK_EQ(object->GetReferenceCount(), 1);
+    object->Release();
+}
+
+TEST(variant_table_errors_leave_nothing_behind)
+{
+    lua_State * L = luaL_newstate();
+
+    /* a userdata that isn't a love object, two tables down */
+    lua_pushcfunction(L, Encode);
+    PushNested(L, 2);
+    lua_rawgeti(L, -1, 2);
+    memset(lua_newuserdata(L, sizeof(Proxy)), 0, sizeof(Proxy));
+    lua_rawseti(L, -2, 3);
+    lua_pop(L, 1);
+
+    size_t live = love::test::Allocations() - love::test::Releases();
+
+    CHECK(lua_pcall(L, 1, 0, 0) != 0);
+    CHECK(std::string(lua_tostring(L, -1)).find("love type expected") != std::string::npos);
+    CHECK_EQ(love::test::Allocations() - love::test::Releases(), live);
+
+    lua_pop(L, 1);
+
+    /* deeper than the Lua stack may grow */
+    lua_pushcfunction(L, Encode);
+    PushNested(L, 5000);
+
+    live = love::test::Allocations() - love::test::Releases();
+
+    CHECK(lua_pcall(L, 1, 0, 0) != 0);
+    CHECK(std::string(lua_tostring(L, -1)).find("too deeply nested") != std::string::npos);
+    CHECK_EQ(love::test::Allocations() - love::test::Releases(), live);
+
+    lua_close(L);
+}
+
+TEST(variant_nested_tables_round_trip)
+{
+    lua_State * L = luaL_newstate();
+
+    /* well past the slots a fresh Lua stack starts with */
+    const int depth = 1000;
+
+    PushNested(L, depth);
+    Variant value = Variant::FromLua(L, -1);
+    lua_pop(L, 1);
+
+    CHECK_EQ(value.GetType(), Variant::TABLE);
+
+    value.ToLua(L);
+
+    for (int level = depth; level > 0; level--)
+    {
+        lua_rawgeti(L, -1, 1);
+        CHECK_EQ((int)lua_tointeger(L, -1), level);
+        lua_pop(L, 1);
+
+        lua_rawgeti(L, -1, 2);
+        lua_remove(L, -2);
+    }
+
+    CHECK(lua_istable(L, -1));
+    CHECK_EQ((int)lua_objlen(L, -1), 0);
+
+    lua_close(L);
+}
+
+BENCH(variant_table_round_trip)
+{
+    lua_State * L = luaL_newstate();
+
+    lua_createtable(L, 256, 0);
+    for (int index = 1; index <= 256; index++)
+    {
+        lua_pushnumber(L, index * 0.5);
+        lua_rawseti(L, -2, index);
+    }
+
+    int table = lua_gettop(L);
+
+    love::test::Measure("encode 256 numbers", 20000, [&]() {
+        Variant value = Variant::FromLua(L, table);
+    });
+
+    Variant value = Variant::FromLua(L, table);
+
+    love::test::Measure("decode 256 numbers", 20000, [&]() {
+        value.ToLua(L);
+        lua_pop(L, 1);
+    });
+
+    std::set<const void *> seen;
+
+    love::test::Measure("encode 256 numbers, as pairs (before)", 20000, [&]() {
+        Variant value = PairsFromLua(L, table, seen);
+    });
+
+    Variant pairs = PairsFromLua(L, table, seen);
+
+    love::test::Measure("decode 256 numbers, as pairs (before)", 20000, [&]() {
+        PairsToLua(L, pairs);
+        lua_pop(L, 1);
+    });
+
+    Counted * object = new Counted();
+    PushTable(L, object);
+
+    love::test::Measure("encode nested table with objects", 200000, [&]() {
+        Variant value = Variant::FromLua(L, -1);
+    });
+
+    lua_close(L);
+    object->Release();
+}
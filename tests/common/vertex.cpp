@@ -0,0 +1,95 @@
+#include "test.h"
+
+#include "common/vertex.h"
+
+using namespace vertex;
+
+namespace
+{
+    Colorf Gray(int value, int alpha = 255)
+    {
+        return Colorf(value / 255.0f, value / 255.0f, value / 255.0f, alpha / 255.0f);
+    }
+
+    Vertex Packed(const Colorf & color)
+    {
+        Vertex out = {};
+        PackColor(color, out.color);
+
+        return out;
+    }
+}
+
+TEST(vertex_colors_round_to_the_nearest_byte)
+{
+    /* every byte survives being unpacked and packed again */
+    for (int value = 0; value < 256; value++)
+    {
+        uint8_t packed[4] = { uint8_t(value), uint8_t(255 - value), uint8_t(value), uint8_t(value) };
+        uint8_t again[4];
+
+        PackColor(UnpackColor(packed), again);
+
+        CHECK(std::equal(packed, packed + 4, again));
+    }
+
+    CHECK_EQ(normto8t(0.5f), 128);
+    CHECK_EQ(normto8t(1.49f / 255.0f), 1);
+    CHECK_EQ(normto8t(1.51f / 255.0f), 2);
+
+    /* out of range clamps instead of wrapping */
+    CHECK_EQ(normto8t(-0.25f), 0);
+    CHECK_EQ(normto8t(1.25f), 255);
+    CHECK_EQ(normto8t(300.0f), 255);
+}
+
+TEST(vertex_tint_matches_packing_the_product)
+{
+    const Colorf white(1.0f, 1.0f, 1.0f, 1.0f);
+    const Colorf black(0.0f, 0.0f, 0.0f, 0.0f);
+
+    for (int value = 0; value < 256; value++)
+    {
+        Vertex vertex = Packed(Gray(value));
+
+        /* white changes nothing */
+        Tint(vertex, white);
+        CHECK_EQ(vertex.color[0], value);
+        CHECK_EQ(vertex.color[3], 255);
+
+        /* a white vertex takes the tint exactly */
+        Vertex plain = Packed(white);
+        Tint(plain, Gray(value, value));
+
+        CHECK_EQ(plain.color[0], value);
+        CHECK_EQ(plain.color[3], value);
+
+        Tint(vertex, black);
+        CHECK_EQ(vertex.color[0], 0);
+        CHECK_EQ(vertex.color[3], 0);
+    }
+
+    /* which side is the vertex and which the tint doesn't matter */
+    for (int a = 0; a < 256; a += 5)
+    {
+        for (int b = 0; b < 256; b += 3)
+        {
+            Vertex left = Packed(Gray(a));
+            Tint(left, Gray(b));
+
+            Vertex right = Packed(Gray(b));
+            Tint(right, Gray(a));
+
+            CHECK_EQ(left.color[0], right.color[0]);
+
+            /* and it rounds like PackColor would */
+            CHECK_EQ(left.color[0], normto8t((a / 255.0f) * (b / 255.0f)));
+        }
+    }
+
+    /* half alpha over opaque is 128, not 127 */
+    Vertex half = Packed(white);
+    Tint(half, Colorf(1.0f, 1.0f, 1.0f, 0.5f));
+
+    CHECK_EQ(half.color[3], 128);
+}
@@ -0,0 +1,125 @@
+#include "test.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <new>
+
+/*
+** Every heap allocation in the test binary goes through here,
+** so a case can assert that a path does not allocate
+*/
+static thread_local size_t allocations = 0;
+static thread_local size_t releases    = 0;
+
+void * operator new(size_t size)
+{
+    allocations++;
+
+    if (void * memory = malloc(size ? size : 1))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void * operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void * memory) noexcept
+{
+    releases += (memory != nullptr);
+    free(memory);
+}
+
+void operator delete[](void * memory) noexcept
+{
+    releases += (memory != nullptr);
+    free(memory);
+}
+
+void operator delete(void * memory, size_t) noexcept
+{
+    releases += (memory != nullptr);
+    free(memory);
+}
+
+void operator delete[](void * memory, size_t) noexcept
+{
+    releases += (memory != nullptr);
+    free(memory);
+}
+
+std::vector<love::test::Case> & love::test::Cases()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+size_t love::test::Allocations()
+{
+    return allocations;
+}
+
+size_t love::test::Releases()
+{
+    return releases;
+}
+
+void love::test::Fail(const char * file, int line, const char * expression)
+{
+    printf("    %s:%d: CHECK(%s) failed\n", file, line, expression);
+    throw Failure();
+}
+
+/*
+** usage: lovepotion-tests [--bench] [filter]
+** Runs the checks, or the benchmarks with --bench,
+** whose names contain @filter
+*/
+int main(int argc, char ** argv)
+{
+    bool benchmarks = false;
+    const char * filter = nullptr;
+
+    for (int index = 1; index < argc; index++)
+    {
+        if (strcmp(argv[index], "--bench") == 0)
+            benchmarks = true;
+        else
+            filter = argv[index];
+    }
+
+    size_t run = 0, failed = 0;
+
+    for (const auto & test : love::test::Cases())
+    {
+        if (test.benchmark != benchmarks)
+            continue;
+
+        if (filter && !strstr(test.name, filter))
+            continue;
+
+        printf("%s\n", test.name);
+        run++;
+
+        try
+        {
+            test.function();
+        }
+        catch (const love::test::Failure &)
+        {
+            failed++;
+        }
+        catch (const std::exception & e)
+        {
+            printf("    uncaught exception: %s\n", e.what());
+            failed++;
+        }
+    }
+
+    printf("%zu run, %zu failed\n", run, failed);
+
+    return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,268 @@
+#include "test.h"
+
+#include "modules/event/event.h"
+#include "modules/joystick/joystick.h"
+
+#include <string>
+#include <vector>
+
+using namespace love;
+
+namespace
+{
+    typedef common::driver::Hidrv::LOVE_Event LOVE_Event;
+    typedef common::driver::Hidrv Hidrv;
+
+    /* A driver that hands out whatever the test sends it */
+    class Feed : public love::driver::Hidrv
+    {
+        public:
+            void Send(const LOVE_Event & event)
+            {
+                this->events.emplace_back() = event;
+            }
+    };
+
+    LOVE_Event Touch(uint8_t type, double x, double y)
+    {
+        LOVE_Event event {};
+
+        event.type           = type;
+        event.touch.id       = 1;
+        event.touch.x        = x;
+        event.touch.y        = y;
+        event.touch.dx       = 1.0;
+        event.touch.dy       = 1.0;
+        event.touch.pressure = 1.0;
+
+        return event;
+    }
+
+    LOVE_Event Window(uint8_t subType)
+    {
+        LOVE_Event event {};
+
+        event.type    = common::driver::Hidrv::TYPE_WINDOWEVENT;
+        event.subType = subType;
+
+        return event;
+    }
+
+    LOVE_Event Finger(uint8_t type, int64_t id, double x, double dx, double dy)
+    {
+        LOVE_Event event = Touch(type, x, 0);
+
+        event.touch.id = id;
+        event.touch.dx = dx;
+        event.touch.dy = dy;
+
+        return event;
+    }
+
+    LOVE_Event Axis(const char * axis, size_t number, float value)
+    {
+        LOVE_Event event {};
+
+        event.type        = Hidrv::TYPE_GAMEPADAXIS;
+        event.axis.axis   = axis;
+        event.axis.number = number;
+        event.axis.value  = value;
+
+        return event;
+    }
+
+    LOVE_Event Pad(uint8_t type)
+    {
+        LOVE_Event event {};
+
+        event.type        = type;
+        event.button.name = "a";
+
+        return event;
+    }
+
+    /* A message as Lua would see it: its name, string and number arguments */
+    struct Seen
+    {
+        std::string name;
+        std::string text;
+        std::vector<double> numbers;
+    };
+
+    std::vector<Seen> Drain(Event * event, lua_State * L)
+    {
+        std::vector<Seen> seen;
+        Message * message = nullptr;
+
+        while (event->Poll(message))
+        {
+            int count = message->ToLua(L);
+            Seen & entry = seen.emplace_back();
+
+            entry.name = lua_tostring(L, -count);
+
+            for (int index = -count + 1; index < 0; index++)
+            {
+                if (lua_type(L, index) == LUA_TNUMBER)
+                    entry.numbers.push_back(lua_tonumber(L, index));
+                else if (lua_type(L, index) == LUA_TSTRING)
+                    entry.text = lua_tostring(L, index);
+            }
+
+            lua_pop(L, count);
+            message->Release();
+        }
+
+        return seen;
+    }
+
+    /*
+    ** One frame of input, a swipe and a focus change; how many messages came out
+    ** Gamepads only connect through gamepadadded, so there are no gamepad events
+    */
+    size_t Frame(Event * event, Feed * feed)
+    {
+        feed->Send(Touch(common::driver::Hidrv::TYPE_TOUCHPRESS, 10, 10));
+
+        for (int step = 0; step < 8; step++)
+            feed->Send(Touch(common::driver::Hidrv::TYPE_TOUCHMOVED, 10 + step, 10));
+
+        feed->Send(Touch(common::driver::Hidrv::TYPE_TOUCHRELEASE, 18, 10));
+
+        feed->Send(Window(common::driver::Hidrv::TYPE_FOCUS_LOST));
+        feed->Send(Window(common::driver::Hidrv::TYPE_FOCUS_GAINED));
+
+        event->Pump();
+
+        size_t count = 0;
+        Message * message = nullptr;
+
+        while (event->Poll(message))
+        {
+            message->Release();
+            count++;
+        }
+
+        return count;
+    }
+}
+
+TEST(event_pump_does_not_allocate)
+{
+    auto * event = new love::Event();
+    auto * feed  = new Feed();
+
+    event->GetDriver().reset(feed);
+
+    for (bool coalescing : { false, true })
+    {
+        event->SetCoalescing(coalescing);
+
+        /* the first frame sizes the driver's queue and the event queue */
+        size_t messages = Frame(event, feed);
+
+        size_t before = love::test::Allocations();
+
+        for (int frame = 0; frame < 100; frame++)
+            CHECK_EQ(Frame(event, feed), messages);
+
+        CHECK_EQ(love::test::Allocations() - before, 0u);
+
+        /* the moves fold into one */
+        CHECK_EQ(messages, coalescing ? 5u : 12u);
+    }
+
+    event->Release();
+}
+
+TEST(event_coalescing_merges_into_the_newest_move)
+{
+    lua_State * L = luaL_newstate();
+
+    auto * joystick = new love::Joystick();
+    auto * event    = new love::Event();
+    auto * feed     = new Feed();
+
+    /* the event module finds the gamepads through the registry */
+    Module::RegisterInstance(joystick);
+
+    event->GetDriver().reset(feed);
+    event->SetCoalescing(true);
+
+    feed->Send(Pad(Hidrv::TYPE_GAMEPADADDED));
+
+    feed->Send(Finger(Hidrv::TYPE_TOUCHPRESS, 1, 0, 0, 0));
+    feed->Send(Finger(Hidrv::TYPE_TOUCHPRESS, 2, 0, 0, 0));
+
+    /* merge past the other touch and the other axis */
+    feed->Send(Finger(Hidrv::TYPE_TOUCHMOVED, 1, 1, 1, 2));
+    feed->Send(Axis("leftx", 0, 0.25f));
+    feed->Send(Finger(Hidrv::TYPE_TOUCHMOVED, 2, 5, 5, 5));
+    feed->Send(Axis("lefty", 1, 0.5f));
+    feed->Send(Finger(Hidrv::TYPE_TOUCHMOVED, 1, 3, 2, 1));
+    feed->Send(Axis("leftx", 0, 0.75f));
+
+    /* never across a release and press of that touch, or a button on that pad */
+    feed->Send(Finger(Hidrv::TYPE_TOUCHRELEASE, 1, 3, 0, 0));
+    feed->Send(Finger(Hidrv::TYPE_TOUCHPRESS, 1, 3, 0, 0));
+    feed->Send(Finger(Hidrv::TYPE_TOUCHMOVED, 1, 4, 1, 0));
+    feed->Send(Pad(Hidrv::TYPE_GAMEPADDOWN));
+    feed->Send(Axis("leftx", 0, 1.0f));
+
+    event->Pump();
+
+    std::vector<Seen> seen = Drain(event, L);
+
+    const char * names[] = {
+        "joystickadded", "touchpressed", "touchpressed", "touchmoved", "gamepadaxis", "touchmoved",
+        "gamepadaxis", "touchreleased", "touchpressed", "touchmoved", "gamepadpressed", "gamepadaxis"
+    };
+
+    CHECK_EQ(seen.size(), std::size(names));
+
+    for (size_t index = 0; index < std::min(seen.size(), std::size(names)); index++)
+        CHECK_EQ(seen[index].name, std::string(names[index]));
+
+    if (seen.size() == std::size(names))
+    {
+        /* touch 1 ends where the last move left it, with the deltas summed */
+        CHECK_EQ(seen[3].numbers[0], 3.0);
+        CHECK_EQ(seen[3].numbers[2], 3.0);
+        CHECK_EQ(seen[3].numbers[3], 3.0);
+
+        CHECK_EQ(seen[4].text, std::string("leftx"));
+        CHECK_EQ(seen[4].numbers[0], 0.75);
+
+        CHECK_EQ(seen[5].numbers[0], 5.0);
+        CHECK_EQ(seen[6].numbers[0], 0.5);
+
+        CHECK_EQ(seen[9].numbers[0], 4.0);
+        CHECK_EQ(seen[9].numbers[2], 1.0);
+        CHECK_EQ(seen[11].numbers[0], 1.0);
+    }
+
+    event->Release();
+    joystick->Release();
+
+    lua_close(L);
+}
+
+BENCH(event_pump)
+{
+    auto * event = new love::Event();
+    auto * feed  = new Feed();
+
+    event->GetDriver().reset(feed);
+
+    love::test::Measure("touch, window events (events)", 100000, [&]() {
+        Frame(event, feed);
+    }, 12);
+
+    event->SetCoalescing(true);
+
+    love::test::Measure("touch, window events, coalescing (events)", 100000, [&]() {
+        Frame(event, feed);
+    }, 12);
+
+    event->Release();
+}
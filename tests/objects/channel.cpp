@@ -0,0 +1,271 @@
+#include "test.h"
+
+#include "objects/channel/wrap_channel.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace love;
+
+namespace
+{
+    class Counted : public Object
+    {};
+
+    /* Call @function with the channel and whatever @push leaves on the stack */
+    template <typename T>
+    int Call(lua_State * L, lua_CFunction function, Channel * channel, T push)
+    {
+        int top = lua_gettop(L);
+
+        lua_pushcfunction(L, function);
+        Luax::PushType(L, Channel::type, channel);
+        push();
+
+        CHECK_EQ(lua_pcall(L, lua_gettop(L) - top - 1, LUA_MULTRET, 0), 0);
+
+        return lua_gettop(L) - top;
+    }
+
+    /* Start @producers threads pushing @count numbers each to @channel */
+    std::vector<std::thread> Produce(Channel * channel, int producers, int count)
+    {
+        std::vector<std::thread> threads;
+
+        for (int producer = 0; producer < producers; producer++)
+        {
+            threads.emplace_back([=]() {
+                for (int index = 0; index < count; index++)
+                    channel->Push(Variant((double)(producer * count + index)));
+            });
+        }
+
+        return threads;
+    }
+}
+
+TEST(channel_push_many_round_trips_shared_values)
+{
+    Channel::type.Init();
+
+    lua_State * L = luaL_newstate();
+    Channel * channel = new Channel();
+    Counted * object = new Counted();
+
+    const char * text = "a string longer than fifteen characters";
+
+    for (int round = 0; round < 4; round++)
+    {
+        Call(L, Wrap_Channel::PushMany, channel, [&]() {
+            lua_pushstring(L, text);
+
+            lua_createtable(L, 0, 1);
+            lua_pushstring(L, text);
+            lua_setfield(L, -2, "name");
+
+            Luax::PushType(L, Object::type, object);
+        });
+
+        lua_pop(L, 1);
+    }
+
+    CHECK_EQ(channel->GetCount(), 12);
+
+    int results = Call(L, Wrap_Channel::PopMany, channel, [&]() {
+        lua_pushinteger(L, 12);
+    });
+
+    CHECK_EQ(results, 12);
+    CHECK_EQ(channel->GetCount(), 0);
+
+    for (int round = 0; round < 4; round++)
+    {
+        int index = -results + round * 3;
+
+        CHECK_EQ(std::string(lua_tostring(L, index)), text);
+
+        lua_getfield(L, index + 1, "name");
+        CHECK_EQ(std::string(lua_tostring(L, -1)), text);
+        lua_pop(L, 1);
+
+        CHECK(Variant::TryExtractProxy(L, index + 2)->object == object);
+    }
+
+    lua_close(L);
+
+    /* the channel let go of everything it was handed */
+    CHECK_EQ(object->GetReferenceCount(), 1);
+    CHECK_EQ(channel->GetReferenceCount(), 1);
+
+    object->Release();
+    channel->Release();
+}
+
+TEST(channel_spsc_rejects_other_threads)
+{
+    Channel * channel = new Channel(Channel::MODE_SPSC, 8);
+    Variant value;
+
+    channel->Push(Variant(1.0));
+    CHECK(channel->Pop(&value));
+
+    bool pushRejected = false;
+    bool popRejected  = false;
+
+    std::thread([&]() {
+        try
+        {
+            channel->Push(Variant(2.0));
+        }
+        catch (love::Exception &)
+        {
+            pushRejected = true;
+        }
+
+        try
+        {
+            channel->Clear();
+        }
+        catch (love::Exception &)
+        {
+            popRejected = true;
+        }
+    }).join();
+
+    CHECK(pushRejected);
+    CHECK(popRejected);
+    CHECK_EQ(channel->GetCount(), 0);
+
+    channel->Release();
+}
+
+TEST(channel_lock_free_stress)
+{
+    const int count = 20000;
+
+    for (int producers : { 1, 2, 4 })
+    {
+        Channel::Mode mode = (producers == 1) ? Channel::MODE_SPSC : Channel::MODE_MPMC;
+        Channel * channel  = new Channel(mode, 64);
+
+        auto threads = Produce(channel, producers, count);
+
+        std::vector<bool> seen(producers * count, false);
+        Variant value;
+
+        for (int index = 0; index < producers * count; index++)
+        {
+            CHECK(channel->Demand(&value, 5.0));
+
+            size_t number = (size_t)value.GetValue<Variant::NUMBER>();
+
+            CHECK(number < seen.size() && !seen[number]);
+            seen[number] = true;
+        }
+
+        for (auto & thread : threads)
+            thread.join();
+
+        CHECK_EQ(channel->GetCount(), 0);
+        CHECK(channel->HasRead(producers * count));
+
+        channel->Release();
+    }
+}
+
+TEST(channel_lock_free_supply_waits_for_its_pop)
+{
+    for (Channel::Mode mode : { Channel::MODE_SPSC, Channel::MODE_MPMC })
+    {
+        /* one slot, so the second Supply also has to wait for room */
+        Channel * channel = new Channel(mode, 1);
+        std::atomic<int> supplied { 0 };
+
+        std::thread producer([&]() {
+            for (int index = 0; index < 2; index++)
+            {
+                channel->Supply(Variant((double)index));
+                supplied++;
+            }
+        });
+
+        /* long enough for the producer to give up spinning and sleep */
+        svcSleepThread(20000000);
+        CHECK_EQ(supplied.load(), 0);
+
+        Variant value;
+
+        for (int index = 0; index < 2; index++)
+        {
+            CHECK(channel->Demand(&value, 5.0));
+            CHECK_EQ(value.GetValue<Variant::NUMBER>(), (double)index);
+        }
+
+        producer.join();
+
+        CHECK_EQ(supplied.load(), 2);
+        CHECK(channel->HasRead(2));
+
+        channel->Release();
+    }
+}
+
+BENCH(channel_producers)
+{
+    const int count = 100000;
+
+    for (int producers : { 1, 2, 4 })
+    {
+        for (Channel::Mode mode : { Channel::MODE_LOCKED, Channel::MODE_SPSC, Channel::MODE_MPMC })
+        {
+            /* an spsc Channel only ever has the one producer */
+            if (mode == Channel::MODE_SPSC && producers > 1)
+                continue;
+
+            Channel * channel = (mode == Channel::MODE_LOCKED) ? new Channel() : new Channel(mode, 256);
+
+            const char * name = "locked";
+            Channel::GetConstant(mode, name);
+
+            char label[64];
+            snprintf(label, sizeof(label), "%s, %d producer(s)", name, producers);
+
+            /* starting the producers is part of the run, so nobody gets a head start */
+            love::test::Measure(label, 1, [&]() {
+                auto threads = Produce(channel, producers, count);
+                Variant value;
+
+                for (int index = 0; index < producers * count; index++)
+                    channel->Demand(&value);
+
+                for (auto & thread : threads)
+                    thread.join();
+            }, producers * count);
+
+            channel->Release();
+        }
+    }
+}
+
+BENCH(channel_push_many_against_single)
+{
+    Channel * channel = new Channel();
+
+    std::vector<Variant> values(64, Variant(1.0));
+    Variant popped[64];
+
+    love::test::Measure("push + pop 64 one at a time", 20000, [&]() {
+        for (const auto & value : values)
+            channel->Push(value);
+
+        for (size_t index = 0; index < values.size(); index++)
+            channel->Pop(&popped[index]);
+    });
+
+    love::test::Measure("pushMany + popMany of 64", 20000, [&]() {
+        channel->Push(values.data(), values.size());
+        channel->Pop(popped, values.size());
+    });
+
+    channel->Release();
+}
@@ -0,0 +1,125 @@
+#include "test.h"
+
+#include "modules/graphics/wrap_graphics.h"
+#include "objects/font/font.h"
+
+#include "common/utf8decode.h"
+
+using namespace love;
+
+namespace
+{
+    /* @count distinct glyphs starting at @first, as one string */
+    std::vector<Font::ColoredString> Glyphs(uint32_t first, size_t count)
+    {
+        std::string text;
+
+        for (uint32_t codepoint = first; codepoint < first + count; codepoint++)
+            utf8::append(codepoint, std::back_inserter(text));
+
+        return { { text, Colorf(1.0f, 1.0f, 1.0f, 1.0f) } };
+    }
+
+    size_t UploadsFor(Graphics * graphics, Font * font, const std::vector<Font::ColoredString> & text)
+    {
+        font->Print(graphics, text, Matrix4(), Colorf(1.0f, 1.0f, 1.0f, 1.0f));
+        ::recorder::Instance().Present();
+
+        return ::recorder::Instance().GetLastFrame().uploads;
+    }
+}
+
+TEST(font_uploads_once_per_frame)
+{
+    auto * graphics = new love::recorder::Graphics();
+    ::recorder::Instance().Present();
+
+    Font * font = new Font({ 16, nullptr }, Texture::Filter());
+
+    CHECK_EQ(UploadsFor(graphics, font, Glyphs('A', 10)), 1u);
+    CHECK_EQ(UploadsFor(graphics, font, Glyphs(0x4E00, 500)), 1u);
+
+    /* nothing new, nothing to send */
+    CHECK_EQ(UploadsFor(graphics, font, Glyphs('A', 10)), 0u);
+
+    font->Release();
+    graphics->Release();
+}
+
+TEST(font_layout_cache_hits_unchanged_text)
+{
+    auto * graphics = new love::recorder::Graphics();
+    Font * font = new Font({ 16, nullptr }, Texture::Filter());
+
+    const Colorf white(1.0f, 1.0f, 1.0f, 1.0f);
+    const Colorf red(1.0f, 0.0f, 0.0f, 1.0f);
+
+    std::vector<Font::ColoredString> label = { { "Lives: 3", white } };
+
+    for (int frame = 0; frame < 3; frame++)
+        font->Print(graphics, label, Matrix4(), white);
+
+    CHECK_EQ(font->GetLayoutCacheMisses(), 1u);
+    CHECK_EQ(font->GetLayoutCacheHits(), 2u);
+
+    /* the transform is applied after the cache */
+    Matrix4 moved;
+    moved.Translate(100, 0);
+
+    font->Print(graphics, label, moved, white);
+    CHECK_EQ(font->GetLayoutCacheHits(), 3u);
+
+    /* anything else that shapes the layout is a different entry */
+    font->Print(graphics, label, Matrix4(), red);
+    font->Printf(graphics, label, 40.0f, Font::ALIGN_LEFT, Matrix4(), white);
+    font->Printf(graphics, label, 40.0f, Font::ALIGN_RIGHT, Matrix4(), white);
+    font->Printf(graphics, label, 80.0f, Font::ALIGN_RIGHT, Matrix4(), white);
+
+    label[0].string = "Lives: 2";
+    font->Print(graphics, label, Matrix4(), white);
+
+    CHECK_EQ(font->GetLayoutCacheMisses(), 6u);
+    CHECK_EQ(font->GetLayoutCacheHits(), 3u);
+
+    ::recorder::Instance().Present();
+
+    font->Release();
+    graphics->Release();
+}
+
+BENCH(font_hud_frame)
+{
+    auto * graphics = new love::recorder::Graphics();
+    Font * font = new Font({ 16, nullptr }, Texture::Filter());
+
+    const Colorf white(1.0f, 1.0f, 1.0f, 1.0f);
+
+    std::vector<std::vector<Font::ColoredString>> labels(50);
+    int frame = 0;
+
+    /* one label changes every frame, like a timer */
+    auto drawHud = [&](bool allChanging) {
+        for (size_t index = 0; index < labels.size(); index++)
+        {
+            char text[64];
+            int value = (allChanging || index == 0) ? frame : (int)index;
+
+            snprintf(text, sizeof(text), "Label %zu: %d", index, value);
+            labels[index] = { { text, white } };
+
+            Matrix4 transform;
+            transform.Translate(10, index * 16.0f);
+
+            font->Print(graphics, labels[index], transform, white);
+        }
+
+        ::recorder::Instance().Present();
+        frame++;
+    };
+
+    love::test::Measure("50-label HUD frames, 1 label changing", 5000, [&]() { drawHud(false); });
+    love::test::Measure("50-label HUD frames, all changing", 5000, [&]() { drawHud(true); });
+
+    font->Release();
+    graphics->Release();
+}
@@ -0,0 +1,483 @@
+#include "test.h"
+
+#include "objects/canvas/canvas.h"
+#include "objects/font/glyphatlas.h"
+#include "objects/text/textvertices.h"
+
+#include "common/framearena.h"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace love;
+
+namespace
+{
+    struct Counts
+    {
+        std::atomic<size_t> rasterized { 0 };
+        std::atomic<size_t> measured { 0 };
+
+        /* rasterized off the thread that made these */
+        std::atomic<size_t> offThread { 0 };
+        std::thread::id owner = std::this_thread::get_id();
+
+        /* rasterizers alive, the loader's copies included */
+        std::atomic<int> live { 0 };
+    };
+
+    /* Square glyphs of one size, counting what gets asked of it */
+    class StubRasterizer : public Rasterizer
+    {
+        public:
+            StubRasterizer(Counts & counts, int height, int glyphWidth, int glyphHeight) : counts(counts),
+                                                                                             glyphWidth(glyphWidth),
+                                                                                             glyphHeight(glyphHeight)
+            {
+                this->metrics = { glyphWidth + 2, height, 0, height };
+                this->counts.live++;
+            }
+
+            ~StubRasterizer()
+            {
+                this->counts.live--;
+            }
+
+            int GetLineHeight() const override
+            {
+                return this->metrics.height;
+            }
+
+            GlyphData * GetGlyphData(uint32_t glyph) const override
+            {
+                this->counts.rasterized++;
+
+                if (std::this_thread::get_id() != this->counts.owner)
+                    this->counts.offThread++;
+
+                /* no tab glyph, spaces are blank */
+                int width  = (glyph == 32) ? 0 : this->glyphWidth;
+                int height = (glyph == 32) ? 0 : this->glyphHeight;
+
+                return new GlyphData(glyph, { height, width, this->metrics.advance, 0, height });
+            }
+
+            int GetGlyphAdvance(uint32_t) const override
+            {
+                this->counts.measured++;
+                return this->metrics.advance;
+            }
+
+            int GetGlyphCount() const override
+            {
+                return 0x10000;
+            }
+
+            bool HasGlyph(uint32_t glyph) const override
+            {
+                return glyph != 9;
+            }
+
+            DataType GetDataType() const override
+            {
+                return DATA_TRUETYPE;
+            }
+
+            Rasterizer * Clone() const override
+            {
+                return new StubRasterizer(this->counts, this->metrics.height, this->glyphWidth, this->glyphHeight);
+            }
+
+        private:
+            Counts & counts;
+
+            int glyphWidth;
+            int glyphHeight;
+    };
+
+    /* Canvases stand in for the GPU images */
+    class StubTextures : public GlyphAtlas::Textures
+    {
+        public:
+            size_t created = 0;
+            size_t grown = 0;
+            size_t uploads = 0;
+
+            love::Texture * Create(int width, int height, love::Texture * previous) override
+            {
+                Canvas::Settings settings;
+                settings.width  = width;
+                settings.height = height;
+
+                this->created++;
+
+                if (previous != nullptr)
+                    this->grown++;
+
+                return new Canvas(settings);
+            }
+
+            void Upload(love::Texture *, const std::vector<uint8_t> &, const std::vector<GlyphAtlas::Region> &) override
+            {
+                this->uploads++;
+            }
+    };
+
+    /* Publish what the loader finishes until @atlas holds @count glyphs */
+    bool WaitForGlyphs(GlyphAtlas & atlas, size_t count)
+    {
+        for (int tries = 0; tries < 5000 && atlas.GetGlyphCount() < count; tries++)
+        {
+            if (!atlas.PublishPreloaded())
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return atlas.GetGlyphCount() == count;
+    }
+}
+
+TEST(glyphatlas_growing_keeps_glyphs_in_place)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 30, 30);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+
+        /* 32px cells with the padding, nine of them fill the first 128x128 */
+        std::vector<GlyphAtlas::Glyph> before;
+
+        for (uint32_t glyph = 'A'; glyph < 'A' + 9; glyph++)
+            before.push_back(atlas.FindGlyph(glyph));
+
+        CHECK_EQ(textures.created, 1u);
+        CHECK_EQ(before[8].texture->GetWidth(), 128);
+
+        uint32_t cacheID = atlas.GetCacheID();
+
+        atlas.FindGlyph('A' + 9);
+
+        CHECK_EQ(textures.grown, 1u);
+        CHECK(atlas.GetCacheID() != cacheID);
+
+        for (uint32_t glyph = 'A'; glyph < 'A' + 9; glyph++)
+        {
+            const GlyphAtlas::Glyph & old   = before[glyph - 'A'];
+            const GlyphAtlas::Glyph & found = atlas.FindGlyph(glyph);
+
+            CHECK(found.texture != old.texture);
+            CHECK_EQ(found.texture->GetWidth(), 256);
+
+            CHECK_EQ(memcmp(&found.rect, &old.rect, sizeof(Rect)), 0);
+            CHECK_EQ(found.spacing, old.spacing);
+
+            for (int corner = 0; corner < 4; corner++)
+            {
+                CHECK_EQ(found.vertices[corner].x, old.vertices[corner].x);
+                CHECK_EQ(found.vertices[corner].y, old.vertices[corner].y);
+
+                /* twice as wide, the same height */
+                CHECK(found.vertices[corner].s < old.vertices[corner].s);
+                CHECK_EQ(found.vertices[corner].t, old.vertices[corner].t);
+            }
+        }
+
+        /* growing re-used what was rasterized */
+        CHECK_EQ(counts.rasterized, 10u);
+    }
+
+    rasterizer->Release();
+}
+
+TEST(glyphatlas_rasterizes_each_glyph_once)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 30, 30);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+
+        /* enough to grow to the largest texture and start another */
+        for (int pass = 0; pass < 3; pass++)
+        {
+            for (uint32_t glyph = 0x4E00; glyph < 0x4E00 + 5000; glyph++)
+                atlas.FindGlyph(glyph);
+
+            atlas.Flush();
+        }
+
+        CHECK_EQ(counts.rasterized, 5000u);
+        CHECK_EQ(atlas.GetGlyphCount(), 5000u);
+        CHECK(textures.created > textures.grown + 1);
+    }
+
+    rasterizer->Release();
+}
+
+TEST(glyphatlas_rejects_glyphs_too_large_for_a_texture)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 4000, 4);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+
+        std::string message;
+
+        try
+        {
+            atlas.FindGlyph('A');
+        }
+        catch (love::Exception & e)
+        {
+            message = e.what();
+        }
+
+        CHECK_EQ(message, std::string("Glyph 65 is too large for the font texture."));
+        CHECK_EQ(atlas.GetGlyphCount(), 0u);
+
+        /* it grew as far as it could before giving up */
+        CHECK(textures.grown > 0);
+    }
+
+    rasterizer->Release();
+}
+
+TEST(glyphatlas_publishes_preloaded_glyphs_without_rasterizing_again)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 8, 8);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+
+        std::vector<uint32_t> codepoints;
+
+        for (uint32_t glyph = 'A'; glyph <= 'Z'; glyph++)
+            codepoints.push_back(glyph);
+
+        atlas.Preload(codepoints);
+
+        /* the loader works on its own copy */
+        CHECK_EQ(counts.live, 2);
+        CHECK(WaitForGlyphs(atlas, 26));
+
+        for (uint32_t glyph : codepoints)
+            CHECK(atlas.FindGlyph(glyph).texture != nullptr);
+
+        CHECK_EQ(counts.rasterized, 26u);
+        CHECK_EQ(counts.offThread, 26u);
+
+        /* already there, nothing to queue */
+        atlas.Preload(codepoints);
+        atlas.PublishPreloaded();
+
+        CHECK_EQ(counts.rasterized, 26u);
+    }
+
+    /* the loader was joined and let go of its copy */
+    CHECK_EQ(counts.live, 1);
+
+    rasterizer->Release();
+}
+
+TEST(glyphatlas_destroying_joins_a_busy_loader)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 8, 8);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+
+        std::vector<uint32_t> codepoints;
+
+        for (uint32_t glyph = 0x4E00; glyph < 0x4E00 + 20000; glyph++)
+            codepoints.push_back(glyph);
+
+        atlas.Preload(codepoints);
+    }
+
+    /* stopped without finishing the queue, and let go of its copy */
+    CHECK_EQ(counts.live, 1);
+
+    rasterizer->Release();
+}
+
+TEST(glyphatlas_auto_preload_leaves_glyphs_out_until_they_arrive)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 8, 8);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+        atlas.SetAutoPreload(true);
+
+        uint32_t cacheID = atlas.GetCacheID();
+
+        /* laid out with the right spacing, but nothing to draw yet */
+        const GlyphAtlas::Glyph & waiting = atlas.FindGlyph('A');
+
+        CHECK(waiting.texture == nullptr);
+        CHECK_EQ(waiting.spacing, 10);
+
+        /* asking again doesn't queue it twice */
+        atlas.FindGlyph('A');
+
+        CHECK(WaitForGlyphs(atlas, 1));
+        CHECK(atlas.GetCacheID() != cacheID);
+
+        CHECK(atlas.FindGlyph('A').texture != nullptr);
+
+        CHECK_EQ(counts.rasterized, 1u);
+        CHECK_EQ(counts.offThread, 1u);
+    }
+
+    rasterizer->Release();
+}
+
+TEST(glyphatlas_measuring_leaves_the_atlas_alone)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 8, 8);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+
+        const std::vector<uint32_t> line = { 'T', 'a', 'b', '\t', 'x', ' ', 0x4E00, '\t' };
+
+        int measured = 0;
+
+        for (int pass = 0; pass < 2; pass++)
+        {
+            measured = 0;
+
+            for (uint32_t glyph : line)
+                measured += atlas.GetGlyphSpacing(glyph);
+        }
+
+        CHECK_EQ(atlas.GetGlyphCount(), 0u);
+        CHECK_EQ(textures.created, 0u);
+        CHECK_EQ(counts.rasterized, 0u);
+
+        /* measured once per glyph, tabs as four spaces */
+        CHECK_EQ(counts.measured, 7u);
+        CHECK_EQ(atlas.GetGlyphSpacing('\t'), GlyphAtlas::SPACES_PER_TAB * atlas.GetGlyphSpacing(' '));
+
+        int drawn = 0;
+
+        for (uint32_t glyph : line)
+            drawn += atlas.FindGlyph(glyph).spacing;
+
+        CHECK_EQ(drawn, measured);
+        CHECK_EQ(atlas.FindGlyph('\t').spacing, atlas.GetGlyphSpacing('\t'));
+
+        /* the drawn glyphs answer from then on */
+        CHECK_EQ(counts.measured, 7u);
+    }
+
+    rasterizer->Release();
+}
+
+/*
+** The Switch side of drawing a cached label: finding its glyphs,
+** then transforming them into the frame arena as Font::PrintV does,
+** and a Text with nothing new to upload
+*/
+TEST(glyphatlas_cached_text_draws_without_allocating)
+{
+    Counts counts;
+    StubTextures textures;
+
+    StubRasterizer * rasterizer = new StubRasterizer(counts, 16, 8, 8);
+
+    {
+        GlyphAtlas atlas(rasterizer, textures, 4);
+        FrameArena arena;
+        TextVertices text;
+
+        const std::vector<uint32_t> label = { 'S', 'c', 'o', 'r', 'e', ':', ' ', '1', '2', '0', '0' };
+
+        std::vector<vertex::GlyphVertex> glyphs;
+        std::vector<GlyphAtlas::DrawCommand> commands;
+
+        int x = 0;
+
+        for (uint32_t codepoint : label)
+        {
+            const GlyphAtlas::Glyph & glyph = atlas.FindGlyph(codepoint);
+
+            if (glyph.texture != nullptr)
+            {
+                if (commands.empty())
+                    commands.push_back({ 0, 0, glyph.texture });
+
+                for (int corner = 0; corner < 4; corner++)
+                {
+                    vertex::GlyphVertex vertex = glyph.vertices[corner];
+                    vertex.x += x;
+
+                    glyphs.push_back(vertex);
+                }
+
+                commands.back().vertexCount += 4;
+            }
+
+            x += glyph.spacing;
+        }
+
+        text.Append(glyphs, commands, nullptr);
+
+        const Matrix4 transform(10.0f, 20.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+
+        auto drawFrame = [&]()
+        {
+            for (uint32_t codepoint : label)
+                atlas.FindGlyph(codepoint);
+
+            atlas.PublishPreloaded();
+            atlas.Flush();
+
+            for (const GlyphAtlas::DrawCommand & command : commands)
+            {
+                vertex::GlyphVertex * glyphData = arena.Allocate<vertex::GlyphVertex>(command.vertexCount);
+                transform.TransformXY(glyphData, &glyphs[command.startVertex], command.vertexCount);
+
+                vertex::Vertex * vertices = arena.Allocate<vertex::Vertex>(command.vertexCount);
+                vertex::GenerateTextureFromGlyphs(vertices, glyphData, command.vertexCount);
+            }
+
+            text.TakeUpload(glyphs.size(), true);
+            text.MarkDrawn();
+
+            arena.Reset();
+        };
+
+        /* the first frame uploads the glyphs and sizes the arena */
+        drawFrame();
+
+        size_t before = love::test::Allocations();
+
+        for (int frame = 0; frame < 10; frame++)
+            drawFrame();
+
+        CHECK_EQ(love::test::Allocations() - before, 0u);
+        CHECK_EQ(textures.uploads, 1u);
+    }
+
+    rasterizer->Release();
+}
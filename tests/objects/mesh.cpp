@@ -0,0 +1,145 @@
+#include "test.h"
+
+#include "objects/mesh/meshgeometry.h"
+#include "common/exception.h"
+
+#include <functional>
+
+using namespace love;
+
+namespace
+{
+    MeshGeometry NewGeometry(size_t count)
+    {
+        return MeshGeometry(MeshGeometry::GetDefaultVertexFormat(), count,
+                            MeshGeometry::DRAWMODE_TRIANGLES, MeshGeometry::USAGE_STATIC);
+    }
+
+    /* @count white vertices at (@x, 0) in the default format */
+    std::vector<float> Points(size_t count, float x)
+    {
+        std::vector<float> data;
+
+        for (size_t index = 0; index < count; index++)
+            data.insert(data.end(), { x, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f });
+
+        return data;
+    }
+
+    bool Rejected(std::function<void()> function)
+    {
+        try
+        {
+            function();
+        }
+        catch (love::Exception &)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+    void CheckUpload(const MeshGeometry::Upload & upload, bool orphan, size_t start, size_t count)
+    {
+        CHECK_EQ(upload.orphan, orphan);
+        CHECK_EQ(upload.start, start);
+        CHECK_EQ(upload.count, count);
+    }
+}
+
+TEST(mesh_uploads_only_modified_vertices)
+{
+    MeshGeometry geometry = NewGeometry(100);
+
+    /* nothing in GPU memory yet */
+    CheckUpload(geometry.TakeVertexUpload(0, false), true, 0, 100);
+    CHECK_EQ(geometry.TakeVertexUpload(100, false).count, 0u);
+
+    geometry.SetVertices(Points(2, 1.0f), 10);
+    CheckUpload(geometry.TakeVertexUpload(100, false), false, 10, 2);
+
+    /* separate changes are uploaded as one span */
+    geometry.SetVertex(50, Points(1, 2.0f));
+    geometry.SetVertices(Points(5, 3.0f), 20);
+    CheckUpload(geometry.TakeVertexUpload(100, false), false, 20, 31);
+
+    /* a rejected write changes nothing */
+    CHECK(Rejected([&]() { geometry.SetVertices(Points(3, 4.0f), 98); }));
+    CHECK(Rejected([&]() { geometry.SetVertex(100, Points(1, 4.0f)); }));
+    CHECK_EQ(geometry.TakeVertexUpload(100, false).count, 0u);
+
+    CHECK_EQ(geometry.GetVertex(50)[0], 2.0f);
+    CHECK_EQ(geometry.GetVertex(98)[0], 0.0f);
+}
+
+TEST(mesh_orphans_buffers_the_gpu_may_be_reading)
+{
+    MeshGeometry geometry = NewGeometry(100);
+    geometry.TakeVertexUpload(0, false);
+
+    /* one vertex changed, but the buffer is still in use: all of it goes to new memory */
+    geometry.SetVertex(7, Points(1, 1.0f));
+    CheckUpload(geometry.TakeVertexUpload(100, true), true, 0, 100);
+
+    /* in use but unchanged, it stays where it is */
+    CHECK_EQ(geometry.TakeVertexUpload(100, true).count, 0u);
+
+    /* too small for the vertices is replaced the same way */
+    geometry.SetVertex(7, Points(1, 2.0f));
+    CheckUpload(geometry.TakeVertexUpload(50, false), true, 0, 100);
+}
+
+TEST(mesh_draw_range_follows_the_vertex_map)
+{
+    MeshGeometry geometry = NewGeometry(100);
+
+    int start = -1, count = -1;
+
+    geometry.GetDrawSpan(start, count);
+    CHECK(start == 0 && count == 100);
+    CHECK(!geometry.GetDrawRange(start, count));
+
+    geometry.SetVertexMap({ 0, 1, 2, 2, 3, 0 });
+
+    CHECK(geometry.IsIndexed());
+    CHECK(geometry.TakeVertexMapUpload());
+    CHECK(!geometry.TakeVertexMapUpload());
+
+    /* invalid maps leave the old one alone */
+    CHECK(Rejected([&]() { geometry.SetVertexMap({ 0, 100 }); }));
+    CHECK(!geometry.TakeVertexMapUpload());
+
+    std::vector<uint32_t> map;
+    CHECK(geometry.GetVertexMap(map));
+    CHECK_EQ(map.size(), 6u);
+
+    /* ranges count map entries, clamped to the map */
+    geometry.GetDrawSpan(start, count);
+    CHECK(start == 0 && count == 6);
+
+    geometry.SetDrawRange(2, 10);
+    geometry.GetDrawSpan(start, count);
+    CHECK(start == 2 && count == 4);
+
+    geometry.SetDrawRange(10, 5);
+    geometry.GetDrawSpan(start, count);
+    CHECK(start == 6 && count == 0);
+
+    /* without the map they count vertices again */
+    geometry.SetVertexMap();
+    CHECK(!geometry.IsIndexed());
+
+    geometry.GetDrawSpan(start, count);
+    CHECK(start == 10 && count == 5);
+
+    CHECK(Rejected([&]() { geometry.SetDrawRange(-1, 5); }));
+    CHECK(Rejected([&]() { geometry.SetDrawRange(0, 0); }));
+
+    CHECK(geometry.GetDrawRange(start, count));
+    CHECK(start == 10 && count == 5);
+
+    geometry.SetDrawRange();
+    geometry.GetDrawSpan(start, count);
+    CHECK(start == 0 && count == 100);
+}
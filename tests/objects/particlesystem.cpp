@@ -0,0 +1,83 @@
+#include "test.h"
+
+#include "modules/graphics/wrap_graphics.h"
+
+#include "objects/canvas/canvas.h"
+#include "objects/particlesystem/particlesystem.h"
+
+using namespace love;
+
+namespace
+{
+    /* A system with every integrator term in use */
+    ParticleSystem * NewSystem(Texture * texture, uint32_t size)
+    {
+        ParticleSystem * system = new ParticleSystem(texture, size);
+
+        system->SetParticleLifetime(1.0e6f, 1.0e6f);
+        system->SetSpeed(10.0f, 50.0f);
+        system->SetSpread(6.28f);
+        system->SetLinearAcceleration(-5.0f, -5.0f, 5.0f, 5.0f);
+        system->SetRadialAcceleration(-2.0f, 2.0f);
+        system->SetTangentialAcceleration(-2.0f, 2.0f);
+        system->SetLinearDamping(0.1f, 0.2f);
+        system->SetSizes({ 1.0f, 2.0f, 0.5f });
+        system->SetColors({ Colorf(1.0f, 1.0f, 1.0f, 1.0f), Colorf(1.0f, 0.0f, 0.0f, 0.0f) });
+
+        return system;
+    }
+}
+
+TEST(particlesystem_particles_expire)
+{
+    Canvas * canvas = new Canvas(Canvas::Settings());
+    ParticleSystem * system = NewSystem(canvas, 256);
+
+    system->SetParticleLifetime(1.0f, 1.0f);
+    system->Emit(300);
+
+    CHECK(system->IsFull());
+    CHECK_EQ(system->GetCount(), 256u);
+
+    system->Update(0.5f);
+    CHECK_EQ(system->GetCount(), 256u);
+
+    system->Update(0.6f);
+    CHECK(system->IsEmpty());
+
+    system->Release();
+    canvas->Release();
+}
+
+BENCH(particlesystem_update)
+{
+    auto * graphics = new love::recorder::Graphics();
+    Canvas * canvas = new Canvas(Canvas::Settings());
+
+    for (uint32_t count : { 1000u, 10000u, 100000u })
+    {
+        ParticleSystem * system = NewSystem(canvas, count);
+        system->Emit(count);
+
+        char label[64];
+        size_t iterations = 20000000 / count;
+
+        snprintf(label, sizeof(label), "particles updated, %u alive", count);
+        love::test::Measure(label, iterations, [&]() {
+            system->Update(1.0f / 60.0f);
+        }, count);
+
+        snprintf(label, sizeof(label), "particles drawn, %u alive", count);
+        love::test::Measure(label, iterations / 10, [&]() {
+            system->Draw(graphics, Matrix4());
+            ::recorder::Instance().Present();
+        }, count);
+
+        CHECK_EQ(system->GetCount(), count);
+
+        system->Release();
+    }
+
+    canvas->Release();
+    graphics->Release();
+}
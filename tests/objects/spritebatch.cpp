@@ -0,0 +1,46 @@
+#include "test.h"
+
+#include "objects/canvas/canvas.h"
+#include "objects/spritebatch/spritebatch.h"
+
+using namespace love;
+
+TEST(spritebatch_replaces_only_added_sprites)
+{
+    Canvas::Settings settings;
+    settings.width  = 16;
+    settings.height = 16;
+
+    Canvas * canvas = new Canvas(settings);
+    SpriteBatch * batch = new SpriteBatch(canvas, 2);
+
+    Matrix4 transform;
+
+    CHECK_EQ(batch->Add(transform), 0);
+    CHECK_EQ(batch->Add(transform, 0), 0);
+
+    int rejected = 0;
+
+    for (int index : { -2, 1, 2 })
+    {
+        try
+        {
+            batch->Add(transform, index);
+        }
+        catch (love::Exception &)
+        {
+            rejected++;
+        }
+    }
+
+    CHECK_EQ(rejected, 3);
+
+    /* appending past the end still grows the buffer */
+    CHECK_EQ(batch->Add(transform), 1);
+    CHECK_EQ(batch->Add(transform), 2);
+    CHECK_EQ(batch->Add(transform, 2), 2);
+    CHECK_EQ(batch->GetCount(), 3);
+
+    batch->Release();
+    canvas->Release();
+}
@@ -0,0 +1,179 @@
+#include "test.h"
+
+#include "objects/canvas/canvas.h"
+#include "objects/text/textvertices.h"
+
+using namespace love;
+
+namespace
+{
+    typedef TextVertices::DrawCommand DrawCommand;
+
+    Canvas * NewPage()
+    {
+        Canvas::Settings settings;
+        settings.width  = 64;
+        settings.height = 64;
+
+        return new Canvas(settings);
+    }
+
+    /* @count glyph quads in a row, the way Font lays them out */
+    std::vector<vertex::GlyphVertex> Quads(size_t count)
+    {
+        std::vector<vertex::GlyphVertex> glyphs(count * 4);
+
+        for (size_t index = 0; index < glyphs.size(); index++)
+            glyphs[index].x = float(index / 4) * 8.0f;
+
+        return glyphs;
+    }
+
+    /* Stands in for Text's GPU buffer, counting what gets copied */
+    struct Buffer
+    {
+        size_t capacity = 0;
+        size_t copied = 0;
+        size_t allocations = 0;
+
+        TextVertices::Upload Flush(TextVertices & vertices, bool busy)
+        {
+            TextVertices::Upload upload = vertices.TakeUpload(this->capacity, busy);
+
+            if (upload.orphan)
+            {
+                size_t count = vertices.GetVertices().size();
+
+                this->capacity = count + count / 2;
+                this->allocations++;
+            }
+
+            this->copied += upload.count;
+
+            return upload;
+        }
+    };
+}
+
+TEST(text_appending_uploads_and_draws_only_what_is_new)
+{
+    Canvas * page = NewPage();
+
+    TextVertices vertices;
+    Buffer buffer;
+
+    for (int line = 0; line < 100; line++)
+    {
+        std::vector<vertex::GlyphVertex> glyphs = Quads(10);
+        vertices.Append(glyphs, { { 0, 40, page } }, nullptr);
+
+        size_t before = buffer.copied;
+
+        /* the previous frame may still be drawing */
+        TextVertices::Upload upload = buffer.Flush(vertices, true);
+        vertices.MarkDrawn();
+
+        CHECK_EQ(upload.start + upload.count, vertices.GetVertices().size());
+
+        if (!upload.orphan)
+            CHECK_EQ(buffer.copied - before, 40u);
+
+        /* however many lines, one draw for the one texture */
+        CHECK_EQ(vertices.GetDrawCommands().size(), 1u);
+    }
+
+    CHECK_EQ(vertices.GetDrawCommands()[0].vertexCount, 4000);
+
+    /* growth takes fresh memory now and then, never every line, so copies stay linear */
+    CHECK(buffer.allocations < 15);
+    CHECK(buffer.copied < 4000 * 4);
+
+    /* drawing again sends nothing */
+    CHECK_EQ(buffer.Flush(vertices, true).count, 0u);
+
+    page->Release();
+}
+
+TEST(text_draw_commands_start_after_earlier_pieces)
+{
+    Canvas * first  = NewPage();
+    Canvas * second = NewPage();
+
+    TextVertices vertices;
+
+    std::vector<vertex::GlyphVertex> glyphs = Quads(2);
+    vertices.Append(glyphs, { { 0, 8, first } }, nullptr);
+
+    glyphs = Quads(3);
+    vertices.Append(glyphs, { { 0, 4, second }, { 4, 8, first } }, nullptr);
+
+    const std::vector<DrawCommand> & commands = vertices.GetDrawCommands();
+
+    CHECK_EQ(commands.size(), 3u);
+
+    CHECK(commands[0].texture == first && commands[0].startVertex == 0 && commands[0].vertexCount == 8);
+    CHECK(commands[1].texture == second && commands[1].startVertex == 8 && commands[1].vertexCount == 4);
+    CHECK(commands[2].texture == first && commands[2].startVertex == 12 && commands[2].vertexCount == 8);
+
+    /* continues the last run */
+    glyphs = Quads(1);
+    vertices.Append(glyphs, { { 0, 4, first } }, nullptr);
+
+    CHECK_EQ(commands.size(), 3u);
+    CHECK_EQ(commands[2].vertexCount, 12);
+
+    /* transforms apply to the new piece only */
+    Matrix4 transform;
+    transform.Translate(100.0f, 0.0f);
+
+    glyphs = Quads(1);
+    vertices.Append(glyphs, { { 0, 4, second } }, &transform);
+
+    CHECK_EQ(commands.size(), 4u);
+    CHECK_EQ(commands[3].startVertex, 24);
+
+    CHECK_EQ(vertices.GetVertices()[0].position[0], 0.0f);
+    CHECK_EQ(vertices.GetVertices()[24].position[0], 100.0f);
+
+    second->Release();
+    first->Release();
+}
+
+TEST(text_rewriting_drawn_vertices_takes_fresh_memory)
+{
+    Canvas * page = NewPage();
+
+    TextVertices vertices;
+    Buffer buffer;
+
+    std::vector<vertex::GlyphVertex> glyphs = Quads(10);
+    vertices.Append(glyphs, { { 0, 40, page } }, nullptr);
+
+    buffer.Flush(vertices, false);
+    vertices.MarkDrawn();
+
+    /* Set replaces what the last frame drew */
+    vertices.Clear();
+
+    glyphs = Quads(5);
+    vertices.Append(glyphs, { { 0, 20, page } }, nullptr);
+
+    TextVertices::Upload upload = buffer.Flush(vertices, true);
+
+    CHECK(upload.orphan);
+    CHECK(upload.start == 0 && upload.count == 20);
+
+    /* once that frame is done it goes in place */
+    vertices.MarkDrawn();
+    vertices.Clear();
+
+    glyphs = Quads(5);
+    vertices.Append(glyphs, { { 0, 20, page } }, nullptr);
+
+    upload = buffer.Flush(vertices, false);
+
+    CHECK(!upload.orphan);
+    CHECK(upload.start == 0 && upload.count == 20);
+
+    page->Release();
+}
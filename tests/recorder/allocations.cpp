@@ -0,0 +1,56 @@
+#include "test.h"
+
+#include "modules/graphics/wrap_graphics.h"
+#include "objects/font/font.h"
+
+using namespace love;
+
+namespace
+{
+    void DrawFrame(Graphics * graphics, Font * font, const std::vector<Font::ColoredString> & text)
+    {
+        const Vector2 points[4] = { { 0, 0 }, { 40, 0 }, { 40, 40 }, { 0, 40 } };
+        const Colorf color = graphics->GetColor();
+
+        graphics->Rectangle(Graphics::DRAW_FILL, 0, 0, 10, 10);
+        graphics->Rectangle(Graphics::DRAW_LINE, 0, 0, 100, 40, 6, 6, 8);
+        graphics->Circle(Graphics::DRAW_FILL, 50, 50, 8, 32);
+        graphics->Ellipse(Graphics::DRAW_LINE, 50, 50, 8, 4, 24);
+        graphics->Arc(Graphics::DRAW_FILL, Graphics::ARC_PIE, 50, 50, 8, 0, 2, 16);
+        graphics->Polygon(Graphics::DRAW_FILL, points, 4);
+        graphics->Line(points, 4);
+        graphics->Points(points, 4, &color, 1);
+
+        font->Print(graphics, text, Matrix4(), Colorf(1.0f, 1.0f, 1.0f, 1.0f));
+        font->Printf(graphics, text, 40.0f, Font::ALIGN_CENTER, Matrix4(), Colorf(1.0f, 1.0f, 1.0f, 1.0f));
+
+        ::recorder::Instance().Present();
+    }
+}
+
+/*
+** Covers the shared Graphics shape code and the headless Font; the
+** Switch glyph path is checked in tests/objects/glyphatlas.cpp, and
+** the deko3d command building doesn't build on the host at all
+*/
+TEST(recorder_draws_without_allocating)
+{
+    auto * graphics = new love::recorder::Graphics();
+    Font * font = new Font({ 16, nullptr }, Texture::Filter());
+
+    std::vector<Font::ColoredString> text = { { "Score: 1200", Colorf(1.0f, 1.0f, 1.0f, 1.0f) } };
+
+    /* the first frames size the scratch buffers, the arena and the glyph cache */
+    for (int frame = 0; frame < 3; frame++)
+        DrawFrame(graphics, font, text);
+
+    size_t before = love::test::Allocations();
+
+    for (int frame = 0; frame < 10; frame++)
+        DrawFrame(graphics, font, text);
+
+    CHECK_EQ(love::test::Allocations() - before, 0u);
+
+    font->Release();
+    graphics->Release();
+}
@@ -0,0 +1,70 @@
+#include "test.h"
+
+#include "modules/graphics/wrap_graphics.h"
+
+using namespace love;
+
+static size_t CountDraws(::recorder::Primitive primitive)
+{
+    size_t draws = 0;
+
+    for (const auto & command : ::recorder::Instance().GetCommands())
+    {
+        if (command.type == ::recorder::COMMAND_DRAW && command.primitive == primitive)
+            draws++;
+    }
+
+    return draws;
+}
+
+TEST(recorder_records_shapes_as_polygons)
+{
+    auto * graphics = new love::recorder::Graphics();
+    ::recorder::Instance().Present();
+
+    graphics->Rectangle(Graphics::DRAW_FILL, 0, 0, 10, 10);
+    graphics->Circle(Graphics::DRAW_FILL, 50, 50, 8, 16);
+    graphics->Arc(Graphics::DRAW_LINE, Graphics::ARC_OPEN, 50, 50, 8, 0, 1, 4);
+
+    CHECK_EQ(CountDraws(::recorder::PRIMITIVE_TRIANGLE_FAN), 2u);
+    CHECK_EQ(CountDraws(::recorder::PRIMITIVE_LINE_STRIP), 1u);
+
+    /* rectangle skips its closing vertex, the circle keeps its centre and closing one */
+    CHECK_EQ(::recorder::Instance().GetVertices().size(), size_t(4 + (16 + 2) + (4 + 1)));
+
+    ::recorder::Instance().Present();
+
+    const auto & frame = ::recorder::Instance().GetLastFrame();
+
+    CHECK_EQ(frame.draws, 3u);
+    CHECK_EQ(frame.vertices, size_t(4 + 18 + 5));
+    CHECK(::recorder::Instance().GetVertices().empty());
+
+    Graphics::Stats stats = graphics->GetStats();
+
+    CHECK_EQ(stats.drawCalls, 3);
+    CHECK_EQ(stats.drawCallsBatched, 0);
+    CHECK_EQ(stats.vertexOverflows, 0);
+
+    graphics->Release();
+}
+
+TEST(recorder_transforms_polygons)
+{
+    auto * graphics = new love::recorder::Graphics();
+    ::recorder::Instance().Present();
+
+    graphics->Translate(100, 200);
+    graphics->Rectangle(Graphics::DRAW_FILL, 0, 0, 10, 10);
+
+    const auto & vertices = ::recorder::Instance().GetVertices();
+
+    CHECK_EQ(vertices.size(), 4u);
+    CHECK_EQ(vertices[0].position[0], 100.0f);
+    CHECK_EQ(vertices[0].position[1], 200.0f);
+    CHECK_EQ(vertices[2].position[0], 110.0f);
+    CHECK_EQ(vertices[2].position[1], 210.0f);
+
+    ::recorder::Instance().Present();
+    graphics->Release();
+}
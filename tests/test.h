@@ -0,0 +1,87 @@
+/*
+** tests/test.h
+** @brief : Host checks and benchmarks, built and run by the headless `make check`
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace love::test
+{
+    struct Case
+    {
+        const char * name;
+        void (* function)();
+
+        bool benchmark;
+    };
+
+    std::vector<Case> & Cases();
+
+    struct Register
+    {
+        Register(const char * name, void (* function)(), bool benchmark)
+        {
+            Cases().push_back({ name, function, benchmark });
+        }
+    };
+
+    /* Thrown by CHECK, ends the current case */
+    struct Failure
+    {};
+
+    void Fail(const char * file, int line, const char * expression);
+
+    /* Heap allocations made by the calling thread so far */
+    size_t Allocations();
+
+    /* Heap blocks the calling thread has freed so far */
+    size_t Releases();
+
+    /*
+    ** Run @function @iterations times and print how many
+    ** calls it managed per millisecond under @label, or how
+    ** many @items when every call handles that many
+    */
+    template <typename T>
+    double Measure(const char * label, size_t iterations, T && function, size_t items = 1)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        Clock::time_point start = Clock::now();
+
+        for (size_t iteration = 0; iteration < iterations; iteration++)
+            function();
+
+        double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        double perMs   = (elapsed > 0) ? (iterations * items) / elapsed : 0;
+
+        printf("    %-40s %12.1f / ms\n", label, perMs);
+
+        return perMs;
+    }
+}
+
+#define LOVE_TEST_CASE(name, benchmark)                                                   \
+    static void name();                                                                   \
+    static love::test::Register name##_register(#name, name, benchmark);                  \
+    static void name()
+
+/* A check, run by `make check` */
+#define TEST(name) LOVE_TEST_CASE(test_##name, false)
+
+/* A benchmark, run by `make bench` */
+#define BENCH(name) LOVE_TEST_CASE(bench_##name, true)
+
+#define CHECK(expression)                                                                 \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(expression))                                                                \
+            love::test::Fail(__FILE__, __LINE__, #expression);                            \
+    } while (0)
+
+#define CHECK_EQ(a, b) CHECK((a) == (b))